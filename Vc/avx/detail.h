@@ -716,6 +716,23 @@ Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,   uint) { return AVX::mullo_epi32
 Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  short) { return AVX::mullo_epi16(a, b); }
 Vc_INTRINSIC __m256i mul(__m256i a, __m256i b, ushort) { return AVX::mullo_epi16(a, b); }
 
+#ifdef Vc_IMPL_AVX2
+// mulhi{{{1
+// High half of the double-width product, i.e. (a * b) >> (8 * sizeof(T)).
+Vc_INTRINSIC __m256i mulhi(__m256i a, __m256i b,    int) {
+    const __m256i ab02 = _mm256_mul_epi32(a, b);
+    const __m256i ab13 = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    return _mm256_blend_epi32(_mm256_srli_epi64(ab02, 32), ab13, 0xaa);
+}
+Vc_INTRINSIC __m256i mulhi(__m256i a, __m256i b,   uint) {
+    const __m256i ab02 = _mm256_mul_epu32(a, b);
+    const __m256i ab13 = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    return _mm256_blend_epi32(_mm256_srli_epi64(ab02, 32), ab13, 0xaa);
+}
+Vc_INTRINSIC __m256i mulhi(__m256i a, __m256i b,  short) { return _mm256_mulhi_epi16(a, b); }
+Vc_INTRINSIC __m256i mulhi(__m256i a, __m256i b, ushort) { return _mm256_mulhi_epu16(a, b); }
+#endif  // Vc_IMPL_AVX2
+
 // mul{{{1
 Vc_INTRINSIC __m256  div(__m256  a, __m256  b,  float) { return _mm256_div_ps(a, b); }
 Vc_INTRINSIC __m256d div(__m256d a, __m256d b, double) { return _mm256_div_pd(a, b); }
@@ -940,7 +957,10 @@ template <Vc::Implementation Impl, typename T,
 Vc_CONST_L AVX2::Vector<T> sorted(AVX2::Vector<T> x) Vc_CONST_R;
 template <typename T> Vc_INTRINSIC Vc_CONST AVX2::Vector<T> sorted(AVX2::Vector<T> x)
 {
-    return sorted<CurrentImplementation::current()>(x);
+    // AVX512 reuses the AVX2 sorting networks compiled into libVc
+    return sorted<CurrentImplementation::is(AVX512Impl) ? AVX2Impl
+                                                        : CurrentImplementation::current()>(
+        x);
 }
 
 // shifted{{{1
@@ -1314,17 +1334,173 @@ template <> Vc_INTRINSIC Vc_CONST int mask_to_int<8>(__m256i k)
 {
     return movemask(AVX::avx_cast<__m256>(k));
 }
-#ifdef Vc_IMPL_BMI2
 template <> Vc_INTRINSIC Vc_CONST int mask_to_int<16>(__m256i k)
 {
+#ifdef Vc_IMPL_BMI2
     return _pext_u32(movemask(k), 0x55555555u);
-}
+#else
+    return movemask(_mm_packs_epi16(AVX::lo128(k), AVX::hi128(k)));
 #endif
+}
 template <> Vc_INTRINSIC Vc_CONST int mask_to_int<32>(__m256i k)
 {
     return movemask(k);
 }
 
+// compress/expand{{{1
+/**\internal
+ * Stores the low \p bytes bytes of \p v to \p mem and leaves the memory after it untouched.
+ */
+Vc_INTRINSIC void partial_store32(void *mem, __m256i v, std::size_t bytes)
+{
+    char *p = static_cast<char *>(mem);
+    if (bytes >= 16) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(p), AVX::lo128(v));
+        partial_store16(p + 16, AVX::hi128(v), bytes - 16);
+    } else {
+        partial_store16(p, AVX::lo128(v), bytes);
+    }
+}
+
+/**\internal
+ * Loads \p bytes bytes from \p mem without reading past them. The remaining bytes are zero.
+ */
+Vc_INTRINSIC __m256i partial_load32(const void *mem, std::size_t bytes)
+{
+    const char *p = static_cast<const char *>(mem);
+    if (bytes > 16) {
+        return AVX::concat(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p)),
+                           partial_load16(p + 16, bytes - 16));
+    }
+    return AVX::zeroExtend(partial_load16(p, bytes));
+}
+
+// Without a lane-crossing permute the two 128-bit halves are handled separately.
+template <typename T, std::size_t N>
+Vc_INTRINSIC int compress_store32(T *mem, __m256i v, int bits,
+                                std::integral_constant<std::size_t, N>)
+{
+    constexpr int HalfSize = 16 / sizeof(T);
+    const int n = compress_store16(mem, AVX::lo128(v), bits & ((1 << HalfSize) - 1));
+    return n + compress_store16(mem + n, AVX::hi128(v), bits >> HalfSize);
+}
+template <typename T, std::size_t N>
+Vc_INTRINSIC __m256i expand_load32(const T *mem, int bits,
+                                 std::integral_constant<std::size_t, N>)
+{
+    constexpr int HalfSize = 16 / sizeof(T);
+    const int lo = bits & ((1 << HalfSize) - 1);
+    return AVX::concat(expand_load16(mem, lo),
+                       expand_load16(mem + popcnt8(lo), bits >> HalfSize));
+}
+
+#ifdef Vc_IMPL_AVX2
+// 32-bit and 64-bit lanes are moved with a single vpermd; a 64-bit lane is a pair of
+// 32-bit lanes, i.e. every mask bit is duplicated.
+Vc_INTRINSIC Vc_CONST int dword_lane_bits(int bits, std::integral_constant<std::size_t, 4>)
+{
+    return bits;
+}
+Vc_INTRINSIC Vc_CONST int dword_lane_bits(int bits, std::integral_constant<std::size_t, 8>)
+{
+    bits = (bits | (bits << 2)) & 0x33;
+    bits = (bits | (bits << 1)) & 0x55;
+    return bits | (bits << 1);
+}
+Vc_INTRINSIC __m256i dword_lane_permutation(const unsigned long long *lanes)
+{
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(lanes)));
+}
+
+template <typename T> Vc_INTRINSIC int compress_store32_dwords(T *mem, __m256i v, int dwords)
+{
+    const int n = popcnt8(dwords);
+    partial_store32(mem,
+                    _mm256_permutevar8x32_epi32(
+                        v, dword_lane_permutation(&SSE::c_compress::compress[dwords])),
+                    n * 4);
+    return n * 4 / sizeof(T);
+}
+template <typename T> Vc_INTRINSIC __m256i expand_load32_dwords(const T *mem, int dwords)
+{
+    return _mm256_permutevar8x32_epi32(
+        partial_load32(mem, popcnt8(dwords) * 4),
+        dword_lane_permutation(&SSE::c_compress::expand[dwords]));
+}
+template <typename T>
+Vc_INTRINSIC int compress_store32(T *mem, __m256i v, int bits,
+                                  std::integral_constant<std::size_t, 4> size)
+{
+    return compress_store32_dwords(mem, v, dword_lane_bits(bits, size));
+}
+template <typename T>
+Vc_INTRINSIC int compress_store32(T *mem, __m256i v, int bits,
+                                  std::integral_constant<std::size_t, 8> size)
+{
+    return compress_store32_dwords(mem, v, dword_lane_bits(bits, size));
+}
+template <typename T>
+Vc_INTRINSIC __m256i expand_load32(const T *mem, int bits,
+                                   std::integral_constant<std::size_t, 4> size)
+{
+    return expand_load32_dwords(mem, dword_lane_bits(bits, size));
+}
+template <typename T>
+Vc_INTRINSIC __m256i expand_load32(const T *mem, int bits,
+                                   std::integral_constant<std::size_t, 8> size)
+{
+    return expand_load32_dwords(mem, dword_lane_bits(bits, size));
+}
+#endif  // Vc_IMPL_AVX2
+
+template <typename T> Vc_INTRINSIC int compress_store32(T *mem, __m256i v, int bits)
+{
+    return compress_store32(mem, v, bits, std::integral_constant<std::size_t, sizeof(T)>());
+}
+template <typename T> Vc_INTRINSIC __m256i expand_load32(const T *mem, int bits)
+{
+    return expand_load32(mem, bits, std::integral_constant<std::size_t, sizeof(T)>());
+}
+
+#ifdef Vc_IMPL_AVX512
+Vc_INTRINSIC int compress_store32(float *mem, __m256i v, int bits)
+{
+    _mm256_mask_compressstoreu_ps(mem, __mmask8(bits), _mm256_castsi256_ps(v));
+    return popcnt8(bits);
+}
+Vc_INTRINSIC int compress_store32(double *mem, __m256i v, int bits)
+{
+    _mm256_mask_compressstoreu_pd(mem, __mmask8(bits), _mm256_castsi256_pd(v));
+    return popcnt4(bits);
+}
+Vc_INTRINSIC int compress_store32(int *mem, __m256i v, int bits)
+{
+    _mm256_mask_compressstoreu_epi32(mem, __mmask8(bits), v);
+    return popcnt8(bits);
+}
+Vc_INTRINSIC int compress_store32(uint *mem, __m256i v, int bits)
+{
+    _mm256_mask_compressstoreu_epi32(mem, __mmask8(bits), v);
+    return popcnt8(bits);
+}
+Vc_INTRINSIC __m256i expand_load32(const float *mem, int bits)
+{
+    return _mm256_castps_si256(_mm256_maskz_expandloadu_ps(__mmask8(bits), mem));
+}
+Vc_INTRINSIC __m256i expand_load32(const double *mem, int bits)
+{
+    return _mm256_castpd_si256(_mm256_maskz_expandloadu_pd(__mmask8(bits), mem));
+}
+Vc_INTRINSIC __m256i expand_load32(const int *mem, int bits)
+{
+    return _mm256_maskz_expandloadu_epi32(__mmask8(bits), mem);
+}
+Vc_INTRINSIC __m256i expand_load32(const uint *mem, int bits)
+{
+    return _mm256_maskz_expandloadu_epi32(__mmask8(bits), mem);
+}
+#endif  // Vc_IMPL_AVX512
+
 //InterleaveImpl{{{1
 template<typename V> struct InterleaveImpl<V, 16, 32> {
     template<typename I> static inline void interleave(typename V::EntryType *const data, const I &i,/*{{{*/
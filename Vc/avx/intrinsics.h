@@ -486,6 +486,29 @@ static Vc_INTRINSIC m256i cmpgt_epu8(__m256i a, __m256i b) {
     }
 #endif
 
+#ifdef Vc_IMPL_AVX512
+// AVX-512VL/BW provide write-masked stores for every element size. The vector mask is
+// converted into a k-register, which avoids vmaskmov (slow on stores) and the
+// non-temporal maskmovdqu for 16-bit elements.
+static Vc_INTRINSIC void _mm256_maskstore(float *mem, const __m256 mask, const __m256 v) {
+    _mm256_mask_storeu_ps(mem, _mm256_movepi32_mask(_mm256_castps_si256(mask)), v);
+}
+static Vc_INTRINSIC void _mm256_maskstore(double *mem, const __m256d mask, const __m256d v) {
+    _mm256_mask_storeu_pd(mem, _mm256_movepi64_mask(_mm256_castpd_si256(mask)), v);
+}
+static Vc_INTRINSIC void _mm256_maskstore(int *mem, const __m256i mask, const __m256i v) {
+    _mm256_mask_storeu_epi32(mem, _mm256_movepi32_mask(mask), v);
+}
+static Vc_INTRINSIC void _mm256_maskstore(unsigned int *mem, const __m256i mask, const __m256i v) {
+    _mm256_maskstore(reinterpret_cast<int *>(mem), mask, v);
+}
+static Vc_INTRINSIC void _mm256_maskstore(short *mem, const __m256i mask, const __m256i v) {
+    _mm256_mask_storeu_epi16(mem, _mm256_movepi16_mask(mask), v);
+}
+static Vc_INTRINSIC void _mm256_maskstore(unsigned short *mem, const __m256i mask, const __m256i v) {
+    _mm256_maskstore(reinterpret_cast<short *>(mem), mask, v);
+}
+#else  // Vc_IMPL_AVX512
 static Vc_INTRINSIC void _mm256_maskstore(float *mem, const __m256 mask, const __m256 v) {
     _mm256_maskstore_ps(mem, _mm256_castps_si256(mask), v);
 }
@@ -510,6 +533,7 @@ static Vc_INTRINSIC void _mm256_maskstore(short *mem, const __m256i mask, const
 static Vc_INTRINSIC void _mm256_maskstore(unsigned short *mem, const __m256i mask, const __m256i v) {
     _mm256_maskstore(reinterpret_cast<short *>(mem), mask, v);
 }
+#endif  // Vc_IMPL_AVX512
 
 #undef Vc_AVX_TO_SSE_1
 #undef Vc_AVX_TO_SSE_1_128
@@ -591,7 +615,10 @@ template <int Scale> __m256 gather(const float *addr, __m256i idx)
 }
 template <int Scale> __m256d gather(const double *addr, __m128i idx)
 {
-    return _mm256_i32gather_pd(addr, idx, Scale);
+    // the unmasked intrinsic starts from an undefined register, which GCC 12 reports as
+    // uninitialized; a zero source with a full mask is the same instruction
+    return _mm256_mask_i32gather_pd(_mm256_setzero_pd(), addr, idx,
+                                    _mm256_castsi256_pd(_mm256_set1_epi64x(-1)), Scale);
 }
 template <int Scale> __m256i gather(const int *addr, __m256i idx)
 {
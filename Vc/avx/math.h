@@ -169,14 +169,15 @@ inline AVX2::double_v frexp(AVX2::double_v::AsArg v, SimdArray<int, 4> *e)
     AVX2::double_v ret =
         _mm256_and_pd(exponentMaximized,
                       _mm256_broadcast_sd(reinterpret_cast<const double *>(&AVX::c_general::frexpMask)));
-    const double_m zeroMask = v == AVX2::double_v::Zero();
+    const AVX2::double_m zeroMask = v == AVX2::double_v::Zero();
     ret(isnan(v) || !isfinite(v) || zeroMask) = v;
     exponent.setZero(simd_cast<SSE::int_m>(zeroMask));
     internal_data(*e) = exponent;
     return ret;
 }
 
-#ifdef Vc_IMPL_AVX2
+// With AVX512, SimdArray<double, 8> wraps a single AVX512::double_v instead.
+#if defined Vc_IMPL_AVX2 && !defined Vc_IMPL_AVX512
 inline SimdArray<double, 8> frexp(const SimdArray<double, 8> &v, SimdArray<int, 8> *e)
 {
     const __m256d exponentBits = AVX::Const<double>::exponentMask().dataD();
@@ -210,13 +211,13 @@ inline SimdArray<double, 8> frexp(const SimdArray<double, 8> &v, SimdArray<int,
         Detail::andnot_(simd_cast<AVX2::int_m>(zeroMask).dataI(), exponent);
     return ret;
 }
-#endif  // Vc_IMPL_AVX2
+#endif  // Vc_IMPL_AVX2 && !Vc_IMPL_AVX512
 
 namespace Detail
 {
 Vc_INTRINSIC AVX2::float_v::IndexType extractExponent(__m256 e)
 {
-    SimdArray<uint, float_v::Size> exponentPart;
+    SimdArray<uint, AVX2::float_v::Size> exponentPart;
     const auto ee = AVX::avx_cast<__m256i>(e);
 #ifdef Vc_IMPL_AVX2
     exponentPart = AVX2::uint_v(ee);
@@ -332,6 +332,22 @@ Vc_INTRINSIC void Vector<T, VectorAbi::Avx>::store(U *mem, Mask mask, Flags flag
     HV::template store<Flags>(mem, data(), mask.data());
 }
 
+template <typename T>
+Vc_INTRINSIC int Vector<T, VectorAbi::Avx>::compress_store(EntryType *mem, Mask mask) const
+{
+    return Detail::compress_store32(mem, AVX::avx_cast<__m256i>(data()), mask.toInt());
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+// expand_load {{{1
+template <typename T>
+Vc_INTRINSIC int Vector<T, VectorAbi::Avx>::expand_load(const EntryType *mem, Mask mask)
+{
+    const int bits = mask.toInt();
+    assign(AVX::avx_cast<VectorType>(Detail::expand_load32(mem, bits)), mask);
+    return Detail::popcnt16(bits);
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////
 // integer ops {{{1
 #ifdef Vc_IMPL_AVX2
@@ -445,6 +461,8 @@ inline void Vector<T, VectorAbi::Avx>::gatherImplementation(
                                             Common::GatherScatterImplementation::BitScanLoop
 #elif defined Vc_USE_POPCNT_BSF_GATHERS
               Common::GatherScatterImplementation::PopcntSwitch
+#elif defined Vc_USE_ADAPTIVE_GATHERS
+              Common::GatherScatterImplementation::Adaptive
 #else
               Common::GatherScatterImplementation::SimpleLoop
 #endif
@@ -452,11 +470,98 @@ inline void Vector<T, VectorAbi::Avx>::gatherImplementation(
     Common::executeGather(Selector(), *this, mem, indexes, mask);
 }
 
+// native scatters {{{1
+#ifdef Vc_IMPL_AVX512
+namespace Detail
+{
+// AVX-512VL provides write-masked scatters for 32- and 64-bit entries with 32-bit
+// indexes. They are used if no conversion of the entries is required and the index
+// argument is a SIMD vector of integers.
+// The number of indexes in IT, or 0 if IT is not a SIMD vector (e.g. SuccessiveEntries).
+template <class IT, bool = Traits::is_simd_vector<IT>::value>
+struct scatter_index_count : std::integral_constant<std::size_t, 0> {
+};
+template <class IT>
+struct scatter_index_count<IT, true>
+    : std::integral_constant<std::size_t, Traits::decay<IT>::Size> {
+};
+template <class T, class MT, class IT>
+using is_avx512_scatter = std::integral_constant<
+    bool, std::is_same<T, MT>::value && sizeof(T) >= 4 &&
+              Traits::is_simd_vector<IT>::value &&
+              std::is_integral<Traits::entry_type_of<IT>>::value &&
+              (scatter_index_count<IT>::value >= AVX2::Vector<T>::Size)>;
+
+template <class IT> Vc_INTRINSIC __m256i avx512_scatter_index(const IT &i, __m256)
+{
+    return simd_cast<AVX2::int_v>(i).data();
+}
+template <class IT> Vc_INTRINSIC __m256i avx512_scatter_index(const IT &i, __m256i)
+{
+    return simd_cast<AVX2::int_v>(i).data();
+}
+template <class IT> Vc_INTRINSIC __m128i avx512_scatter_index(const IT &i, __m256d)
+{
+    return simd_cast<SSE::int_v>(i).data();
+}
+
+Vc_INTRINSIC void avx512_scatter(double *mem, __m128i i, __m256d v, __mmask8 k)
+{
+    _mm256_mask_i32scatter_pd(mem, k, i, v, 8);
+}
+Vc_INTRINSIC void avx512_scatter(float *mem, __m256i i, __m256 v, __mmask8 k)
+{
+    _mm256_mask_i32scatter_ps(mem, k, i, v, 4);
+}
+Vc_INTRINSIC void avx512_scatter(int *mem, __m256i i, __m256i v, __mmask8 k)
+{
+    _mm256_mask_i32scatter_epi32(mem, k, i, v, 4);
+}
+Vc_INTRINSIC void avx512_scatter(uint *mem, __m256i i, __m256i v, __mmask8 k)
+{
+    _mm256_mask_i32scatter_epi32(mem, k, i, v, 4);
+}
+
+template <class V, class MT, class IT, class Selector>
+Vc_INTRINSIC void avx512_scatter(std::true_type, Selector, const V &v, MT *mem,
+                                 const IT &indexes, typename V::MaskArgument mask)
+{
+    avx512_scatter(mem, avx512_scatter_index(indexes, v.data()), v.data(),
+                   static_cast<__mmask8>(mask.toInt()));
+}
+template <class V, class MT, class IT, class Selector>
+Vc_INTRINSIC void avx512_scatter(std::false_type, Selector, const V &v, MT *mem,
+                                 IT &&indexes, typename V::MaskArgument mask)
+{
+    Common::executeScatter(Selector(), v, mem, std::forward<IT>(indexes), mask);
+}
+
+// unmasked overloads
+template <class V, class MT, class IT>
+Vc_INTRINSIC void avx512_scatter(std::true_type, const V &v, MT *mem, const IT &indexes)
+{
+    avx512_scatter(mem, avx512_scatter_index(indexes, v.data()), v.data(),
+                   static_cast<__mmask8>((1u << V::Size) - 1));
+}
+template <class V, class MT, class IT>
+Vc_INTRINSIC void avx512_scatter(std::false_type, const V &v, MT *mem, const IT &indexes)
+{
+    Common::unrolled_loop<std::size_t, 0, V::Size>(
+        [&](std::size_t i) { mem[indexes[i]] = v[i]; });
+}
+}  // namespace Detail
+#endif  // Vc_IMPL_AVX512
+
+// scatters {{{1
 template <typename T>
 template <typename MT, typename IT>
 inline void Vector<T, VectorAbi::Avx>::scatterImplementation(MT *mem, IT &&indexes) const
 {
+#ifdef Vc_IMPL_AVX512
+    Detail::avx512_scatter(Detail::is_avx512_scatter<T, MT, IT>(), *this, mem, indexes);
+#else
     Common::unrolled_loop<std::size_t, 0, Size>([&](std::size_t i) { mem[indexes[i]] = d.m(i); });
+#endif
 }
 
 template <typename T>
@@ -471,11 +576,18 @@ inline void Vector<T, VectorAbi::Avx>::scatterImplementation(MT *mem, IT &&index
                                             Common::GatherScatterImplementation::BitScanLoop
 #elif defined Vc_USE_POPCNT_BSF_GATHERS
               Common::GatherScatterImplementation::PopcntSwitch
+#elif defined Vc_USE_ADAPTIVE_GATHERS
+              Common::GatherScatterImplementation::Adaptive
 #else
               Common::GatherScatterImplementation::SimpleLoop
 #endif
                                                 > ;
+#ifdef Vc_IMPL_AVX512
+    Detail::avx512_scatter(Detail::is_avx512_scatter<T, MT, IT>(), Selector(), *this, mem,
+                           std::forward<IT>(indexes), mask);
+#else
     Common::executeScatter(Selector(), *this, mem, std::forward<IT>(indexes), mask);
+#endif
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////
@@ -538,7 +650,7 @@ template <> Vc_INTRINSIC std::pair<AVX2::float_v, int> AVX2::float_v::minIndex()
 
     // 28 cycles Latency:
     __m256 x = d.v();
-    __m256 idx = Vector<float>::IndexesFromZero().data();
+    __m256 idx = AVX2::Vector<float>::IndexesFromZero().data();
     __m256 y = Mem::permute128<X1, X0>(x);
     __m256 idy = Mem::permute128<X1, X0>(idx);
     __m256 less = AVX::cmplt_ps(x, y);
@@ -0,0 +1,509 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_AVX512_DETAIL_H_
+#define VC_AVX512_DETAIL_H_
+
+#include "../avx/detail.h"
+#include "types.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// load64{{{1
+Vc_INTRINSIC __m512 load64(const float *mem, when_aligned) { return _mm512_load_ps(mem); }
+Vc_INTRINSIC __m512 load64(const float *mem, when_unaligned) { return _mm512_loadu_ps(mem); }
+Vc_INTRINSIC __m512 load64(const float *mem, when_streaming)
+{
+    return _mm512_castsi512_ps(_mm512_stream_load_si512(const_cast<float *>(mem)));
+}
+Vc_INTRINSIC __m512d load64(const double *mem, when_aligned) { return _mm512_load_pd(mem); }
+Vc_INTRINSIC __m512d load64(const double *mem, when_unaligned) { return _mm512_loadu_pd(mem); }
+Vc_INTRINSIC __m512d load64(const double *mem, when_streaming)
+{
+    return _mm512_castsi512_pd(_mm512_stream_load_si512(const_cast<double *>(mem)));
+}
+template <class T> Vc_INTRINSIC __m512i load64(const T *mem, when_aligned)
+{
+    static_assert(std::is_integral<T>::value, "load64<T> is only intended for integral T");
+    return _mm512_load_si512(mem);
+}
+template <class T> Vc_INTRINSIC __m512i load64(const T *mem, when_unaligned)
+{
+    static_assert(std::is_integral<T>::value, "load64<T> is only intended for integral T");
+    return _mm512_loadu_si512(mem);
+}
+template <class T> Vc_INTRINSIC __m512i load64(const T *mem, when_streaming)
+{
+    static_assert(std::is_integral<T>::value, "load64<T> is only intended for integral T");
+    return _mm512_stream_load_si512(const_cast<T *>(mem));
+}
+
+// masked loads (zero in the masked-off entries) {{{1
+Vc_INTRINSIC __m512 load64(const float *mem, __mmask16 k)
+{
+    return _mm512_maskz_loadu_ps(k, mem);
+}
+Vc_INTRINSIC __m512d load64(const double *mem, __mmask8 k)
+{
+    return _mm512_maskz_loadu_pd(k, mem);
+}
+template <class T> Vc_INTRINSIC __m512i load64(const T *mem, __mmask16 k)
+{
+    static_assert(std::is_integral<T>::value && sizeof(T) == 4,
+                  "masked load64<T> is only intended for 32-bit integral T");
+    return _mm512_maskz_loadu_epi32(k, mem);
+}
+
+// store64{{{1
+Vc_INTRINSIC void store64(__m512 v, float *mem, when_aligned) { _mm512_store_ps(mem, v); }
+Vc_INTRINSIC void store64(__m512 v, float *mem, when_unaligned) { _mm512_storeu_ps(mem, v); }
+Vc_INTRINSIC void store64(__m512 v, float *mem, when_streaming) { _mm512_stream_ps(mem, v); }
+Vc_INTRINSIC void store64(__m512d v, double *mem, when_aligned) { _mm512_store_pd(mem, v); }
+Vc_INTRINSIC void store64(__m512d v, double *mem, when_unaligned) { _mm512_storeu_pd(mem, v); }
+Vc_INTRINSIC void store64(__m512d v, double *mem, when_streaming) { _mm512_stream_pd(mem, v); }
+template <class T> Vc_INTRINSIC void store64(__m512i v, T *mem, when_aligned)
+{
+    _mm512_store_si512(mem, v);
+}
+template <class T> Vc_INTRINSIC void store64(__m512i v, T *mem, when_unaligned)
+{
+    _mm512_storeu_si512(mem, v);
+}
+template <class T> Vc_INTRINSIC void store64(__m512i v, T *mem, when_streaming)
+{
+    _mm512_stream_si512(reinterpret_cast<__m512i *>(mem), v);
+}
+
+// masked stores: AVX512F write-masks every element size we support, independent of alignment
+Vc_INTRINSIC void store64(__m512 v, float *mem, __mmask16 k) { _mm512_mask_storeu_ps(mem, k, v); }
+Vc_INTRINSIC void store64(__m512d v, double *mem, __mmask8 k) { _mm512_mask_storeu_pd(mem, k, v); }
+template <class T> Vc_INTRINSIC void store64(__m512i v, T *mem, __mmask16 k)
+{
+    _mm512_mask_storeu_epi32(mem, k, v);
+}
+
+// compress_store64 / expand_load64 {{{1
+Vc_INTRINSIC void compress_store64(__m512 v, float *mem, __mmask16 k)
+{
+    _mm512_mask_compressstoreu_ps(mem, k, v);
+}
+Vc_INTRINSIC void compress_store64(__m512d v, double *mem, __mmask8 k)
+{
+    _mm512_mask_compressstoreu_pd(mem, k, v);
+}
+template <class T> Vc_INTRINSIC void compress_store64(__m512i v, T *mem, __mmask16 k)
+{
+    _mm512_mask_compressstoreu_epi32(mem, k, v);
+}
+Vc_INTRINSIC __m512 expand_load64(__m512 src, const float *mem, __mmask16 k)
+{
+    return _mm512_mask_expandloadu_ps(src, k, mem);
+}
+Vc_INTRINSIC __m512d expand_load64(__m512d src, const double *mem, __mmask8 k)
+{
+    return _mm512_mask_expandloadu_pd(src, k, mem);
+}
+template <class T> Vc_INTRINSIC __m512i expand_load64(__m512i src, const T *mem, __mmask16 k)
+{
+    return _mm512_mask_expandloadu_epi32(src, k, mem);
+}
+
+// avx512_zero / avx512_allone / avx512_broadcast {{{1
+template <class V> Vc_INTRINSIC V avx512_zero();
+template <> Vc_INTRINSIC __m512 avx512_zero<__m512>() { return _mm512_setzero_ps(); }
+template <> Vc_INTRINSIC __m512d avx512_zero<__m512d>() { return _mm512_setzero_pd(); }
+template <> Vc_INTRINSIC __m512i avx512_zero<__m512i>() { return _mm512_setzero_si512(); }
+
+template <class V> Vc_INTRINSIC V avx512_allone();
+template <> Vc_INTRINSIC __m512i avx512_allone<__m512i>() { return _mm512_set1_epi32(-1); }
+template <> Vc_INTRINSIC __m512 avx512_allone<__m512>()
+{
+    return _mm512_castsi512_ps(_mm512_set1_epi32(-1));
+}
+template <> Vc_INTRINSIC __m512d avx512_allone<__m512d>()
+{
+    return _mm512_castsi512_pd(_mm512_set1_epi32(-1));
+}
+
+Vc_INTRINSIC __m512 avx512_broadcast(float x) { return _mm512_set1_ps(x); }
+Vc_INTRINSIC __m512d avx512_broadcast(double x) { return _mm512_set1_pd(x); }
+Vc_INTRINSIC __m512i avx512_broadcast(int x) { return _mm512_set1_epi32(x); }
+Vc_INTRINSIC __m512i avx512_broadcast(uint x) { return _mm512_set1_epi32(x); }
+
+// lo256 / hi256 / avx512_concat / avx512_zero_extend {{{1
+Vc_INTRINSIC __m256  lo256(__m512  v) { return _mm512_castps512_ps256(v); }
+Vc_INTRINSIC __m256d lo256(__m512d v) { return _mm512_castpd512_pd256(v); }
+Vc_INTRINSIC __m256i lo256(__m512i v) { return _mm512_castsi512_si256(v); }
+Vc_INTRINSIC __m256  hi256(__m512  v) { return _mm512_extractf32x8_ps(v, 1); }
+Vc_INTRINSIC __m256d hi256(__m512d v) { return _mm512_extractf64x4_pd(v, 1); }
+Vc_INTRINSIC __m256i hi256(__m512i v) { return _mm512_extracti64x4_epi64(v, 1); }
+
+Vc_INTRINSIC __m512 avx512_concat(__m256 a, __m256 b)
+{
+    return _mm512_insertf32x8(_mm512_castps256_ps512(a), b, 1);
+}
+Vc_INTRINSIC __m512d avx512_concat(__m256d a, __m256d b)
+{
+    return _mm512_insertf64x4(_mm512_castpd256_pd512(a), b, 1);
+}
+Vc_INTRINSIC __m512i avx512_concat(__m256i a, __m256i b)
+{
+    return _mm512_inserti64x4(_mm512_castsi256_si512(a), b, 1);
+}
+
+Vc_INTRINSIC __m512 avx512_zero_extend(__m256 v)
+{
+    return _mm512_insertf32x8(_mm512_setzero_ps(), v, 0);
+}
+Vc_INTRINSIC __m512d avx512_zero_extend(__m256d v)
+{
+    return _mm512_insertf64x4(_mm512_setzero_pd(), v, 0);
+}
+Vc_INTRINSIC __m512i avx512_zero_extend(__m256i v)
+{
+    return _mm512_inserti64x4(_mm512_setzero_si512(), v, 0);
+}
+
+// k-masks <-> vector masks {{{1
+// SSE and AVX masks set all bits of an entry; the k-mask holds the sign bit of every entry.
+template <std::size_t EntrySize> using MaskEntrySize = std::integral_constant<std::size_t, EntrySize>;
+Vc_INTRINSIC __mmask8  to_kmask(__m128i m, MaskEntrySize<8>) { return _mm_movepi64_mask(m); }
+Vc_INTRINSIC __mmask8  to_kmask(__m128i m, MaskEntrySize<4>) { return _mm_movepi32_mask(m); }
+Vc_INTRINSIC __mmask8  to_kmask(__m128i m, MaskEntrySize<2>) { return _mm_movepi16_mask(m); }
+Vc_INTRINSIC __mmask8  to_kmask(__m256i m, MaskEntrySize<8>) { return _mm256_movepi64_mask(m); }
+Vc_INTRINSIC __mmask8  to_kmask(__m256i m, MaskEntrySize<4>) { return _mm256_movepi32_mask(m); }
+Vc_INTRINSIC __mmask16 to_kmask(__m256i m, MaskEntrySize<2>) { return _mm256_movepi16_mask(m); }
+
+Vc_INTRINSIC __m128i from_kmask(__mmask16 k, __m128i, MaskEntrySize<8>) { return _mm_movm_epi64(k); }
+Vc_INTRINSIC __m128i from_kmask(__mmask16 k, __m128i, MaskEntrySize<4>) { return _mm_movm_epi32(k); }
+Vc_INTRINSIC __m128i from_kmask(__mmask16 k, __m128i, MaskEntrySize<2>) { return _mm_movm_epi16(k); }
+Vc_INTRINSIC __m256i from_kmask(__mmask16 k, __m256i, MaskEntrySize<8>) { return _mm256_movm_epi64(k); }
+Vc_INTRINSIC __m256i from_kmask(__mmask16 k, __m256i, MaskEntrySize<4>) { return _mm256_movm_epi32(k); }
+Vc_INTRINSIC __m256i from_kmask(__mmask16 k, __m256i, MaskEntrySize<2>) { return _mm256_movm_epi16(k); }
+
+// lane indexes {{{1
+// {offset, offset + 1, ...} in lanes of sizeof(T), for the permute instructions
+Vc_INTRINSIC __m512i avx512_lane_index(int offset, std::integral_constant<std::size_t, 4>)
+{
+    return _mm512_add_epi32(
+        _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+        _mm512_set1_epi32(offset));
+}
+Vc_INTRINSIC __m512i avx512_lane_index(int offset, std::integral_constant<std::size_t, 8>)
+{
+    return _mm512_add_epi64(_mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0),
+                            _mm512_set1_epi64(offset));
+}
+Vc_INTRINSIC __m512i avx512_reversed_index(std::integral_constant<std::size_t, 4>)
+{
+    return _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+}
+Vc_INTRINSIC __m512i avx512_reversed_index(std::integral_constant<std::size_t, 8>)
+{
+    return _mm512_set_epi64(0, 1, 2, 3, 4, 5, 6, 7);
+}
+// the lanes of idx that index into a vector with N entries
+Vc_INTRINSIC __mmask16 avx512_index_in_range(__m512i idx, std::integral_constant<std::size_t, 4>)
+{
+    return _mm512_cmplt_epu32_mask(idx, _mm512_set1_epi32(16));
+}
+Vc_INTRINSIC __mmask8 avx512_index_in_range(__m512i idx, std::integral_constant<std::size_t, 8>)
+{
+    return _mm512_cmplt_epu64_mask(idx, _mm512_set1_epi64(8));
+}
+// -Size <= idx < 2 * Size, i.e. idx selects an entry of concat(shiftIn, v, shiftIn)
+Vc_INTRINSIC __mmask16 avx512_index_in_range2(__m512i idx, std::integral_constant<std::size_t, 4>)
+{
+    return _mm512_cmplt_epu32_mask(_mm512_add_epi32(idx, _mm512_set1_epi32(16)),
+                                   _mm512_set1_epi32(48));
+}
+Vc_INTRINSIC __mmask8 avx512_index_in_range2(__m512i idx, std::integral_constant<std::size_t, 8>)
+{
+    return _mm512_cmplt_epu64_mask(_mm512_add_epi64(idx, _mm512_set1_epi64(8)),
+                                   _mm512_set1_epi64(24));
+}
+
+// permute: r[i] = v[idx[i] % Size]; permute2: r[i] = concat(a, b)[idx[i] % (2 * Size)]
+Vc_INTRINSIC __m512 permute(__m512 v, __m512i idx) { return _mm512_permutexvar_ps(idx, v); }
+Vc_INTRINSIC __m512d permute(__m512d v, __m512i idx) { return _mm512_permutexvar_pd(idx, v); }
+Vc_INTRINSIC __m512i permute(__m512i v, __m512i idx) { return _mm512_permutexvar_epi32(idx, v); }
+Vc_INTRINSIC __m512 permute(__m512 v, __m512i idx, __mmask16 k)
+{
+    return _mm512_maskz_permutexvar_ps(k, idx, v);
+}
+Vc_INTRINSIC __m512d permute(__m512d v, __m512i idx, __mmask8 k)
+{
+    return _mm512_maskz_permutexvar_pd(k, idx, v);
+}
+Vc_INTRINSIC __m512i permute(__m512i v, __m512i idx, __mmask16 k)
+{
+    return _mm512_maskz_permutexvar_epi32(k, idx, v);
+}
+Vc_INTRINSIC __m512 permute2(__m512 a, __m512 b, __m512i idx)
+{
+    return _mm512_permutex2var_ps(a, idx, b);
+}
+Vc_INTRINSIC __m512d permute2(__m512d a, __m512d b, __m512i idx)
+{
+    return _mm512_permutex2var_pd(a, idx, b);
+}
+Vc_INTRINSIC __m512i permute2(__m512i a, __m512i b, __m512i idx)
+{
+    return _mm512_permutex2var_epi32(a, idx, b);
+}
+Vc_INTRINSIC __m512 permute2(__m512 a, __m512 b, __m512i idx, __mmask16 k)
+{
+    return _mm512_maskz_permutex2var_ps(k, a, idx, b);
+}
+Vc_INTRINSIC __m512d permute2(__m512d a, __m512d b, __m512i idx, __mmask8 k)
+{
+    return _mm512_maskz_permutex2var_pd(k, a, idx, b);
+}
+Vc_INTRINSIC __m512i permute2(__m512i a, __m512i b, __m512i idx, __mmask16 k)
+{
+    return _mm512_maskz_permutex2var_epi32(k, a, idx, b);
+}
+
+// blend: k ? b : a {{{1
+Vc_INTRINSIC __m512 blend(__m512 a, __m512 b, __mmask16 k) { return _mm512_mask_blend_ps(k, a, b); }
+Vc_INTRINSIC __m512d blend(__m512d a, __m512d b, __mmask8 k) { return _mm512_mask_blend_pd(k, a, b); }
+Vc_INTRINSIC __m512i blend(__m512i a, __m512i b, __mmask16 k) { return _mm512_mask_blend_epi32(k, a, b); }
+
+// bitwise {{{1
+Vc_INTRINSIC __m512  and_(__m512  a, __m512  b) { return _mm512_and_ps(a, b); }
+Vc_INTRINSIC __m512d and_(__m512d a, __m512d b) { return _mm512_and_pd(a, b); }
+Vc_INTRINSIC __m512i and_(__m512i a, __m512i b) { return _mm512_and_si512(a, b); }
+Vc_INTRINSIC __m512  or_ (__m512  a, __m512  b) { return _mm512_or_ps(a, b); }
+Vc_INTRINSIC __m512d or_ (__m512d a, __m512d b) { return _mm512_or_pd(a, b); }
+Vc_INTRINSIC __m512i or_ (__m512i a, __m512i b) { return _mm512_or_si512(a, b); }
+Vc_INTRINSIC __m512  xor_(__m512  a, __m512  b) { return _mm512_xor_ps(a, b); }
+Vc_INTRINSIC __m512d xor_(__m512d a, __m512d b) { return _mm512_xor_pd(a, b); }
+Vc_INTRINSIC __m512i xor_(__m512i a, __m512i b) { return _mm512_xor_si512(a, b); }
+Vc_INTRINSIC __m512  andnot_(__m512  a, __m512  b) { return _mm512_andnot_ps(a, b); }
+Vc_INTRINSIC __m512d andnot_(__m512d a, __m512d b) { return _mm512_andnot_pd(a, b); }
+Vc_INTRINSIC __m512i andnot_(__m512i a, __m512i b) { return _mm512_andnot_si512(a, b); }
+
+// add{{{1
+Vc_INTRINSIC __m512  add(__m512  a, __m512  b,  float) { return _mm512_add_ps(a, b); }
+Vc_INTRINSIC __m512d add(__m512d a, __m512d b, double) { return _mm512_add_pd(a, b); }
+Vc_INTRINSIC __m512i add(__m512i a, __m512i b,    int) { return _mm512_add_epi32(a, b); }
+Vc_INTRINSIC __m512i add(__m512i a, __m512i b,   uint) { return _mm512_add_epi32(a, b); }
+
+// sub{{{1
+Vc_INTRINSIC __m512  sub(__m512  a, __m512  b,  float) { return _mm512_sub_ps(a, b); }
+Vc_INTRINSIC __m512d sub(__m512d a, __m512d b, double) { return _mm512_sub_pd(a, b); }
+Vc_INTRINSIC __m512i sub(__m512i a, __m512i b,    int) { return _mm512_sub_epi32(a, b); }
+Vc_INTRINSIC __m512i sub(__m512i a, __m512i b,   uint) { return _mm512_sub_epi32(a, b); }
+
+// mul{{{1
+Vc_INTRINSIC __m512  mul(__m512  a, __m512  b,  float) { return _mm512_mul_ps(a, b); }
+Vc_INTRINSIC __m512d mul(__m512d a, __m512d b, double) { return _mm512_mul_pd(a, b); }
+Vc_INTRINSIC __m512i mul(__m512i a, __m512i b,    int) { return _mm512_mullo_epi32(a, b); }
+Vc_INTRINSIC __m512i mul(__m512i a, __m512i b,   uint) { return _mm512_mullo_epi32(a, b); }
+
+// mulhi{{{1
+// High half of the double-width product, i.e. (a * b) >> (8 * sizeof(T)).
+Vc_INTRINSIC __m512i mulhi(__m512i a, __m512i b,    int) {
+    const __m512i ab02 = _mm512_mul_epi32(a, b);
+    const __m512i ab13 = _mm512_mul_epi32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32));
+    return _mm512_mask_blend_epi32(0xaaaa, _mm512_srli_epi64(ab02, 32), ab13);
+}
+Vc_INTRINSIC __m512i mulhi(__m512i a, __m512i b,   uint) {
+    const __m512i ab02 = _mm512_mul_epu32(a, b);
+    const __m512i ab13 = _mm512_mul_epu32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32));
+    return _mm512_mask_blend_epi32(0xaaaa, _mm512_srli_epi64(ab02, 32), ab13);
+}
+
+// div{{{1
+Vc_INTRINSIC __m512  div(__m512  a, __m512  b,  float) { return _mm512_div_ps(a, b); }
+Vc_INTRINSIC __m512d div(__m512d a, __m512d b, double) { return _mm512_div_pd(a, b); }
+// There is no integer division. Every 32-bit integer is exactly representable as double,
+// and AVX512F converts unsigned integers directly, so the quotient is exact after
+// truncation.
+Vc_INTRINSIC __m512i div(__m512i a, __m512i b, int)
+{
+    const __m512d lo = _mm512_div_pd(_mm512_cvtepi32_pd(_mm512_castsi512_si256(a)),
+                                     _mm512_cvtepi32_pd(_mm512_castsi512_si256(b)));
+    const __m512d hi = _mm512_div_pd(_mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(a, 1)),
+                                     _mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(b, 1)));
+    return _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvttpd_epi32(lo)),
+                              _mm512_cvttpd_epi32(hi), 1);
+}
+Vc_INTRINSIC __m512i div(__m512i a, __m512i b, uint)
+{
+    const __m512d lo = _mm512_div_pd(_mm512_cvtepu32_pd(_mm512_castsi512_si256(a)),
+                                     _mm512_cvtepu32_pd(_mm512_castsi512_si256(b)));
+    const __m512d hi = _mm512_div_pd(_mm512_cvtepu32_pd(_mm512_extracti64x4_epi64(a, 1)),
+                                     _mm512_cvtepu32_pd(_mm512_extracti64x4_epi64(b, 1)));
+    return _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvttpd_epu32(lo)),
+                              _mm512_cvttpd_epu32(hi), 1);
+}
+
+// min / max{{{1
+Vc_INTRINSIC __m512  min(__m512  a, __m512  b,  float) { return _mm512_min_ps(a, b); }
+Vc_INTRINSIC __m512d min(__m512d a, __m512d b, double) { return _mm512_min_pd(a, b); }
+Vc_INTRINSIC __m512i min(__m512i a, __m512i b,    int) { return _mm512_min_epi32(a, b); }
+Vc_INTRINSIC __m512i min(__m512i a, __m512i b,   uint) { return _mm512_min_epu32(a, b); }
+Vc_INTRINSIC __m512  max(__m512  a, __m512  b,  float) { return _mm512_max_ps(a, b); }
+Vc_INTRINSIC __m512d max(__m512d a, __m512d b, double) { return _mm512_max_pd(a, b); }
+Vc_INTRINSIC __m512i max(__m512i a, __m512i b,    int) { return _mm512_max_epi32(a, b); }
+Vc_INTRINSIC __m512i max(__m512i a, __m512i b,   uint) { return _mm512_max_epu32(a, b); }
+
+// horizontal add / mul / min / max{{{1
+Vc_INTRINSIC  float add(__m512  a,  float) { return _mm512_reduce_add_ps(a); }
+Vc_INTRINSIC double add(__m512d a, double) { return _mm512_reduce_add_pd(a); }
+Vc_INTRINSIC    int add(__m512i a,    int) { return _mm512_reduce_add_epi32(a); }
+Vc_INTRINSIC   uint add(__m512i a,   uint) { return _mm512_reduce_add_epi32(a); }
+Vc_INTRINSIC  float mul(__m512  a,  float) { return _mm512_reduce_mul_ps(a); }
+Vc_INTRINSIC double mul(__m512d a, double) { return _mm512_reduce_mul_pd(a); }
+Vc_INTRINSIC    int mul(__m512i a,    int) { return _mm512_reduce_mul_epi32(a); }
+Vc_INTRINSIC   uint mul(__m512i a,   uint) { return _mm512_reduce_mul_epi32(a); }
+Vc_INTRINSIC  float min(__m512  a,  float) { return _mm512_reduce_min_ps(a); }
+Vc_INTRINSIC double min(__m512d a, double) { return _mm512_reduce_min_pd(a); }
+Vc_INTRINSIC    int min(__m512i a,    int) { return _mm512_reduce_min_epi32(a); }
+Vc_INTRINSIC   uint min(__m512i a,   uint) { return _mm512_reduce_min_epu32(a); }
+Vc_INTRINSIC  float max(__m512  a,  float) { return _mm512_reduce_max_ps(a); }
+Vc_INTRINSIC double max(__m512d a, double) { return _mm512_reduce_max_pd(a); }
+Vc_INTRINSIC    int max(__m512i a,    int) { return _mm512_reduce_max_epi32(a); }
+Vc_INTRINSIC   uint max(__m512i a,   uint) { return _mm512_reduce_max_epu32(a); }
+
+// masked horizontal add / mul / min / max: masked-off entries take the identity element
+Vc_INTRINSIC  float add(__m512  a, __mmask16 k,  float) { return _mm512_mask_reduce_add_ps(k, a); }
+Vc_INTRINSIC double add(__m512d a, __mmask8  k, double) { return _mm512_mask_reduce_add_pd(k, a); }
+Vc_INTRINSIC    int add(__m512i a, __mmask16 k,    int) { return _mm512_mask_reduce_add_epi32(k, a); }
+Vc_INTRINSIC   uint add(__m512i a, __mmask16 k,   uint) { return _mm512_mask_reduce_add_epi32(k, a); }
+Vc_INTRINSIC  float mul(__m512  a, __mmask16 k,  float) { return _mm512_mask_reduce_mul_ps(k, a); }
+Vc_INTRINSIC double mul(__m512d a, __mmask8  k, double) { return _mm512_mask_reduce_mul_pd(k, a); }
+Vc_INTRINSIC    int mul(__m512i a, __mmask16 k,    int) { return _mm512_mask_reduce_mul_epi32(k, a); }
+Vc_INTRINSIC   uint mul(__m512i a, __mmask16 k,   uint) { return _mm512_mask_reduce_mul_epi32(k, a); }
+Vc_INTRINSIC  float min(__m512  a, __mmask16 k,  float) { return _mm512_mask_reduce_min_ps(k, a); }
+Vc_INTRINSIC double min(__m512d a, __mmask8  k, double) { return _mm512_mask_reduce_min_pd(k, a); }
+Vc_INTRINSIC    int min(__m512i a, __mmask16 k,    int) { return _mm512_mask_reduce_min_epi32(k, a); }
+Vc_INTRINSIC   uint min(__m512i a, __mmask16 k,   uint) { return _mm512_mask_reduce_min_epu32(k, a); }
+Vc_INTRINSIC  float max(__m512  a, __mmask16 k,  float) { return _mm512_mask_reduce_max_ps(k, a); }
+Vc_INTRINSIC double max(__m512d a, __mmask8  k, double) { return _mm512_mask_reduce_max_pd(k, a); }
+Vc_INTRINSIC    int max(__m512i a, __mmask16 k,    int) { return _mm512_mask_reduce_max_epi32(k, a); }
+Vc_INTRINSIC   uint max(__m512i a, __mmask16 k,   uint) { return _mm512_mask_reduce_max_epu32(k, a); }
+
+// compares{{{1
+// The floating-point predicates are the ordered/unordered variants that match the
+// scalar operators: only != is true for NaN.
+Vc_INTRINSIC __mmask16 cmpeq (__m512  a, __m512  b,  float) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+Vc_INTRINSIC __mmask8  cmpeq (__m512d a, __m512d b, double) { return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ); }
+Vc_INTRINSIC __mmask16 cmpeq (__m512i a, __m512i b,    int) { return _mm512_cmpeq_epi32_mask(a, b); }
+Vc_INTRINSIC __mmask16 cmpeq (__m512i a, __m512i b,   uint) { return _mm512_cmpeq_epu32_mask(a, b); }
+Vc_INTRINSIC __mmask16 cmpneq(__m512  a, __m512  b,  float) { return _mm512_cmp_ps_mask(a, b, _CMP_NEQ_UQ); }
+Vc_INTRINSIC __mmask8  cmpneq(__m512d a, __m512d b, double) { return _mm512_cmp_pd_mask(a, b, _CMP_NEQ_UQ); }
+Vc_INTRINSIC __mmask16 cmpneq(__m512i a, __m512i b,    int) { return _mm512_cmpneq_epi32_mask(a, b); }
+Vc_INTRINSIC __mmask16 cmpneq(__m512i a, __m512i b,   uint) { return _mm512_cmpneq_epu32_mask(a, b); }
+Vc_INTRINSIC __mmask16 cmplt (__m512  a, __m512  b,  float) { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+Vc_INTRINSIC __mmask8  cmplt (__m512d a, __m512d b, double) { return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ); }
+Vc_INTRINSIC __mmask16 cmplt (__m512i a, __m512i b,    int) { return _mm512_cmplt_epi32_mask(a, b); }
+Vc_INTRINSIC __mmask16 cmplt (__m512i a, __m512i b,   uint) { return _mm512_cmplt_epu32_mask(a, b); }
+Vc_INTRINSIC __mmask16 cmple (__m512  a, __m512  b,  float) { return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ); }
+Vc_INTRINSIC __mmask8  cmple (__m512d a, __m512d b, double) { return _mm512_cmp_pd_mask(a, b, _CMP_LE_OQ); }
+Vc_INTRINSIC __mmask16 cmple (__m512i a, __m512i b,    int) { return _mm512_cmple_epi32_mask(a, b); }
+Vc_INTRINSIC __mmask16 cmple (__m512i a, __m512i b,   uint) { return _mm512_cmple_epu32_mask(a, b); }
+
+// gather / scatter{{{1
+template <int Scale> Vc_INTRINSIC __m512 gather(const float *addr, __m512i idx)
+{
+    return _mm512_i32gather_ps(idx, addr, Scale);
+}
+template <int Scale> Vc_INTRINSIC __m512d gather(const double *addr, __m256i idx)
+{
+    return _mm512_i32gather_pd(idx, addr, Scale);
+}
+template <int Scale, class T> Vc_INTRINSIC __m512i gather(const T *addr, __m512i idx)
+{
+    return _mm512_i32gather_epi32(idx, addr, Scale);
+}
+template <int Scale>
+Vc_INTRINSIC __m512 gather(__m512 src, __mmask16 k, const float *addr, __m512i idx)
+{
+    return _mm512_mask_i32gather_ps(src, k, idx, addr, Scale);
+}
+template <int Scale>
+Vc_INTRINSIC __m512d gather(__m512d src, __mmask8 k, const double *addr, __m256i idx)
+{
+    return _mm512_mask_i32gather_pd(src, k, idx, addr, Scale);
+}
+template <int Scale, class T>
+Vc_INTRINSIC __m512i gather(__m512i src, __mmask16 k, const T *addr, __m512i idx)
+{
+    return _mm512_mask_i32gather_epi32(src, k, idx, addr, Scale);
+}
+
+Vc_INTRINSIC void scatter(float *addr, __m512i idx, __m512 v, __mmask16 k)
+{
+    _mm512_mask_i32scatter_ps(addr, k, idx, v, sizeof(float));
+}
+Vc_INTRINSIC void scatter(double *addr, __m256i idx, __m512d v, __mmask8 k)
+{
+    _mm512_mask_i32scatter_pd(addr, k, idx, v, sizeof(double));
+}
+template <class T> Vc_INTRINSIC void scatter(T *addr, __m512i idx, __m512i v, __mmask16 k)
+{
+    _mm512_mask_i32scatter_epi32(addr, k, idx, v, sizeof(T));
+}
+
+// InterleaveImpl{{{1
+// There is no transpose network for zmm registers yet: copy the struct members one
+// entry at a time.
+template <typename V, size_t Size, size_t VSize> struct InterleaveImpl;
+template <typename T, size_t Size> struct InterleaveImpl<AVX512::Vector<T>, Size, 64> {
+    template <typename I, typename... Vs>
+    static inline void interleave(T *const data, const I &i, const Vs &... vs)
+    {
+        for (size_t lane = 0; lane < Size; ++lane) {
+            const T values[] = {vs[lane]...};
+            for (size_t k = 0; k < sizeof...(Vs); ++k) {
+                data[i[lane] + k] = values[k];
+            }
+        }
+    }
+    template <typename I, typename... Vs>
+    static inline void deinterleave(T const *const data, const I &i, Vs &... vs)
+    {
+        for (size_t lane = 0; lane < Size; ++lane) {
+            const T *const values = &data[i[lane]];
+            size_t k = 0;
+            const int unused[] = {(vs[lane] = values[k++], 0)...};
+            (void)unused;
+        }
+    }
+};
+//}}}1
+}  // namespace Detail
+}  // namespace Vc
+
+#endif  // VC_AVX512_DETAIL_H_
+
+// vim: foldmethod=marker
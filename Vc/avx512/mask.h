@@ -0,0 +1,235 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_AVX512_MASK_H_
+#define VC_AVX512_MASK_H_
+
+#include <array>
+
+#include "detail.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**\internal
+ * AVX-512 masks are k-registers with one bit per entry. Conversions between the masks of
+ * the 32-bit types are therefore free, and all mask logic is plain integer logic.
+ */
+template <typename T> class Mask<T, VectorAbi::Avx512>
+{
+    static_assert(AVX512::is_valid_entry_type<T>::value,
+                  "Mask<T, VectorAbi::Avx512> only supports double, float, int, and uint.");
+
+public:
+    using abi = VectorAbi::Avx512;
+
+    /**
+     * The \c EntryType of masks is always bool, independent of \c T.
+     */
+    typedef bool EntryType;
+    using value_type = EntryType;
+
+    /**
+     * The \c VectorEntryType, in contrast to \c EntryType, reveals information about the SIMD
+     * implementation. This type is useful for the \c sizeof operator in generic functions.
+     */
+    typedef bool VectorEntryType;
+
+    /**
+     * The \c VectorType reveals the implementation-specific internal type used for the
+     * SIMD type.
+     */
+    using VectorType = AVX512::MaskTypeHelper<T>;
+
+    /**
+     * The associated Vector<T> type.
+     */
+    using Vector = AVX512::Vector<T>;
+
+    static constexpr size_t Size = 64 / sizeof(T);
+    static constexpr size_t MemoryAlignment = Size;
+    static constexpr std::size_t size() { return Size; }
+
+    using EntryReference = Vc::Detail::ElementReference<Mask>;
+    using reference = EntryReference;
+
+    typedef const Mask AsArg;
+
+private:
+    static constexpr VectorType AllBits = VectorType((1ull << Size) - 1);
+
+public:
+    Vc_INTRINSIC Mask() = default;
+    Vc_INTRINSIC Mask(VectorType kk) : k(kk) {}
+    Vc_INTRINSIC explicit Mask(VectorSpecialInitializerZero) : k(0) {}
+    Vc_INTRINSIC explicit Mask(VectorSpecialInitializerOne) : k(AllBits) {}
+    Vc_INTRINSIC explicit Mask(bool b) : k(b ? AllBits : VectorType(0)) {}
+    Vc_INTRINSIC static Mask Zero() { return Mask{Vc::Zero}; }
+    Vc_INTRINSIC static Mask One() { return Mask{Vc::One}; }
+
+    // implicit cast between the masks of the 32-bit types
+    template <typename U>
+    Vc_INTRINSIC Mask(
+        U &&rhs, Common::enable_if_mask_converts_implicitly<Mask, T, U> = nullarg,
+        enable_if<std::is_same<typename Traits::decay<U>::abi, abi>::value> = nullarg)
+        : k(rhs.data())
+    {
+    }
+
+#if Vc_IS_VERSION_1
+    // explicit cast, implemented via simd_cast (in avx512/simd_cast_caller.tcc)
+    template <typename U>
+    Vc_DEPRECATED("use simd_cast instead of explicit type casting to convert between "
+                  "mask types") Vc_INTRINSIC
+        explicit Mask(U &&rhs, Common::enable_if_mask_converts_explicitly<T, U> = nullarg);
+#endif
+
+    template <typename Flags = DefaultLoadTag>
+    Vc_INTRINSIC explicit Mask(const bool *mem, Flags f = Flags())
+    {
+        load(mem, f);
+    }
+
+    template <typename Flags = DefaultLoadTag>
+    Vc_INTRINSIC void load(const bool *mem, Flags = Flags())
+    {
+        k = Size == 16 ? _mm_test_epi8_mask(_mm_loadu_si128(reinterpret_cast<const __m128i *>(mem)),
+                                            _mm_set1_epi8(1))
+                       : _mm_test_epi8_mask(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(mem)),
+                                            _mm_set1_epi8(1));
+    }
+
+    template <typename Flags = DefaultLoadTag>
+    Vc_INTRINSIC void store(bool *mem, Flags = Flags()) const
+    {
+        const __m128i bools = _mm_maskz_mov_epi8(k, _mm_set1_epi8(1));
+        if (Size == 16) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(mem), bools);
+        } else {
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(mem), bools);
+        }
+    }
+
+    Vc_INTRINSIC Mask &operator=(const Mask &) = default;
+    Vc_INTRINSIC Mask &operator=(const std::array<bool, Size> &values)
+    {
+        load(values.data());
+        return *this;
+    }
+    Vc_INTRINSIC operator std::array<bool, Size>() const
+    {
+        std::array<bool, Size> r;
+        store(r.data());
+        return r;
+    }
+
+    Vc_INTRINSIC Vc_PURE bool operator==(const Mask &rhs) const { return k == rhs.k; }
+    Vc_INTRINSIC Vc_PURE bool operator!=(const Mask &rhs) const { return k != rhs.k; }
+
+    Vc_INTRINSIC Vc_PURE Mask operator!() const { return VectorType(~k & AllBits); }
+
+    Vc_INTRINSIC Mask &operator&=(const Mask &rhs) { k &= rhs.k; return *this; }
+    Vc_INTRINSIC Mask &operator|=(const Mask &rhs) { k |= rhs.k; return *this; }
+    Vc_INTRINSIC Mask &operator^=(const Mask &rhs) { k ^= rhs.k; return *this; }
+
+    Vc_INTRINSIC Vc_PURE Mask operator&(const Mask &rhs) const { return VectorType(k & rhs.k); }
+    Vc_INTRINSIC Vc_PURE Mask operator|(const Mask &rhs) const { return VectorType(k | rhs.k); }
+    Vc_INTRINSIC Vc_PURE Mask operator^(const Mask &rhs) const { return VectorType(k ^ rhs.k); }
+
+    Vc_INTRINSIC Vc_PURE Mask operator&&(const Mask &rhs) const { return VectorType(k & rhs.k); }
+    Vc_INTRINSIC Vc_PURE Mask operator||(const Mask &rhs) const { return VectorType(k | rhs.k); }
+
+    Vc_INTRINSIC Vc_PURE bool isFull() const { return k == AllBits; }
+    Vc_INTRINSIC Vc_PURE bool isNotEmpty() const { return k != 0; }
+    Vc_INTRINSIC Vc_PURE bool isEmpty() const { return k == 0; }
+    Vc_INTRINSIC Vc_PURE bool isMix() const { return k != 0 && k != AllBits; }
+
+    Vc_INTRINSIC Vc_PURE int shiftMask() const { return k; }
+    Vc_INTRINSIC Vc_PURE int toInt() const { return k; }
+
+    Vc_INTRINSIC VectorType data() const { return k; }
+    Vc_INTRINSIC VectorType dataI() const { return k; }
+
+private:
+    friend reference;
+    static Vc_INTRINSIC Vc_PURE value_type get(const Mask &m, int i) noexcept
+    {
+        return m.k & (1u << i);
+    }
+    template <typename U>
+    static Vc_INTRINSIC void set(Mask &m, int i, U &&v) noexcept(noexcept(bool(std::declval<U>())))
+    {
+        m.k = bool(std::forward<U>(v)) ? VectorType(m.k | (1u << i))
+                                       : VectorType(m.k & ~(1u << i));
+    }
+
+public:
+    /**
+     * \note the returned object models the concept of a reference and
+     * as such it can exist longer than the data it is referencing.
+     * \note to avoid lifetime issues, we strongly advice not to store
+     * any reference objects.
+     */
+    Vc_ALWAYS_INLINE reference operator[](size_t index) noexcept
+    {
+        return {*this, int(index)};
+    }
+    Vc_ALWAYS_INLINE Vc_PURE value_type operator[](size_t index) const noexcept
+    {
+        return get(*this, index);
+    }
+
+    Vc_INTRINSIC Vc_PURE int count() const { return Detail::popcnt16(k); }
+    Vc_INTRINSIC Vc_PURE int firstOne() const { return _bit_scan_forward(k); }
+
+    template <typename G> static Vc_INTRINSIC Mask generate(G &&gen)
+    {
+        VectorType r = 0;
+        Common::unrolled_loop<std::size_t, 0, Size>(
+            [&](std::size_t i) { r |= VectorType(gen(i) ? 1u << i : 0u); });
+        return r;
+    }
+
+    Vc_INTRINSIC Vc_PURE Mask shifted(int amount) const
+    {
+        if (amount >= int(Size) || amount <= -int(Size)) {
+            return Zero();
+        }
+        return VectorType((amount >= 0 ? k >> amount : k << -amount) & AllBits);
+    }
+
+private:
+    VectorType k = 0;
+};
+template <typename T> constexpr size_t Mask<T, VectorAbi::Avx512>::Size;
+template <typename T> constexpr size_t Mask<T, VectorAbi::Avx512>::MemoryAlignment;
+template <typename T>
+constexpr typename Mask<T, VectorAbi::Avx512>::VectorType Mask<T, VectorAbi::Avx512>::AllBits;
+
+}  // namespace Vc
+
+#endif // VC_AVX512_MASK_H_
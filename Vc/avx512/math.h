@@ -0,0 +1,262 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_AVX512_MATH_H_
+#define VC_AVX512_MATH_H_
+
+#include "vector.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+// min & max {{{1
+Vc_ALWAYS_INLINE AVX512::double_v min(const AVX512::double_v &x, const AVX512::double_v &y) { return Detail::min(x.data(), y.data(), double()); }
+Vc_ALWAYS_INLINE AVX512::float_v min(const AVX512::float_v &x, const AVX512::float_v &y) { return Detail::min(x.data(), y.data(), float()); }
+Vc_ALWAYS_INLINE AVX512::int_v   min(const AVX512::int_v   &x, const AVX512::int_v   &y) { return Detail::min(x.data(), y.data(), int()); }
+Vc_ALWAYS_INLINE AVX512::uint_v  min(const AVX512::uint_v  &x, const AVX512::uint_v  &y) { return Detail::min(x.data(), y.data(), uint()); }
+Vc_ALWAYS_INLINE AVX512::double_v max(const AVX512::double_v &x, const AVX512::double_v &y) { return Detail::max(x.data(), y.data(), double()); }
+Vc_ALWAYS_INLINE AVX512::float_v max(const AVX512::float_v &x, const AVX512::float_v &y) { return Detail::max(x.data(), y.data(), float()); }
+Vc_ALWAYS_INLINE AVX512::int_v   max(const AVX512::int_v   &x, const AVX512::int_v   &y) { return Detail::max(x.data(), y.data(), int()); }
+Vc_ALWAYS_INLINE AVX512::uint_v  max(const AVX512::uint_v  &x, const AVX512::uint_v  &y) { return Detail::max(x.data(), y.data(), uint()); }
+
+// sqrt / rsqrt / reciprocal {{{1
+Vc_ALWAYS_INLINE AVX512::float_v sqrt(const AVX512::float_v &x) { return _mm512_sqrt_ps(x.data()); }
+Vc_ALWAYS_INLINE AVX512::double_v sqrt(const AVX512::double_v &x) { return _mm512_sqrt_pd(x.data()); }
+// vrsqrt14 / vrcp14 have a relative error of at most 2^-14, better than the 1.5 * 2^-12
+// of the SSE/AVX approximations. As with SSE/AVX, double precision divides exactly.
+Vc_ALWAYS_INLINE AVX512::float_v rsqrt(const AVX512::float_v &x) { return _mm512_rsqrt14_ps(x.data()); }
+Vc_ALWAYS_INLINE AVX512::double_v rsqrt(const AVX512::double_v &x) { return _mm512_div_pd(_mm512_set1_pd(1.), _mm512_sqrt_pd(x.data())); }
+Vc_ALWAYS_INLINE AVX512::float_v reciprocal(const AVX512::float_v &x) { return _mm512_rcp14_ps(x.data()); }
+Vc_ALWAYS_INLINE AVX512::double_v reciprocal(const AVX512::double_v &x) { return _mm512_div_pd(_mm512_set1_pd(1.), x.data()); }
+
+// abs {{{1
+Vc_INTRINSIC Vc_CONST AVX512::float_v abs(AVX512::float_v x) { return _mm512_abs_ps(x.data()); }
+Vc_INTRINSIC Vc_CONST AVX512::double_v abs(AVX512::double_v x) { return _mm512_abs_pd(x.data()); }
+Vc_INTRINSIC Vc_CONST AVX512::int_v abs(AVX512::int_v x) { return _mm512_abs_epi32(x.data()); }
+
+// round / trunc / floor / ceil {{{1
+Vc_ALWAYS_INLINE AVX512::float_v round(const AVX512::float_v &x)
+{
+    return _mm512_roundscale_ps(x.data(), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+}
+Vc_ALWAYS_INLINE AVX512::double_v round(const AVX512::double_v &x)
+{
+    return _mm512_roundscale_pd(x.data(), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+}
+Vc_ALWAYS_INLINE AVX512::float_v trunc(const AVX512::float_v &x)
+{
+    return _mm512_roundscale_ps(x.data(), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+}
+Vc_ALWAYS_INLINE AVX512::double_v trunc(const AVX512::double_v &x)
+{
+    return _mm512_roundscale_pd(x.data(), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+}
+Vc_ALWAYS_INLINE AVX512::float_v floor(const AVX512::float_v &x)
+{
+    return _mm512_roundscale_ps(x.data(), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+}
+Vc_ALWAYS_INLINE AVX512::double_v floor(const AVX512::double_v &x)
+{
+    return _mm512_roundscale_pd(x.data(), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+}
+Vc_ALWAYS_INLINE AVX512::float_v ceil(const AVX512::float_v &x)
+{
+    return _mm512_roundscale_ps(x.data(), _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+}
+Vc_ALWAYS_INLINE AVX512::double_v ceil(const AVX512::double_v &x)
+{
+    return _mm512_roundscale_pd(x.data(), _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+}
+
+// fma {{{1
+Vc_ALWAYS_INLINE AVX512::float_v fma(AVX512::float_v a, AVX512::float_v b, AVX512::float_v c)
+{
+    return _mm512_fmadd_ps(a.data(), b.data(), c.data());
+}
+Vc_ALWAYS_INLINE AVX512::double_v fma(AVX512::double_v a, AVX512::double_v b,
+                                      AVX512::double_v c)
+{
+    return _mm512_fmadd_pd(a.data(), b.data(), c.data());
+}
+Vc_ALWAYS_INLINE AVX512::int_v fma(AVX512::int_v a, AVX512::int_v b, AVX512::int_v c)
+{
+    return _mm512_add_epi32(_mm512_mullo_epi32(a.data(), b.data()), c.data());
+}
+Vc_ALWAYS_INLINE AVX512::uint_v fma(AVX512::uint_v a, AVX512::uint_v b, AVX512::uint_v c)
+{
+    return _mm512_add_epi32(_mm512_mullo_epi32(a.data(), b.data()), c.data());
+}
+
+// isfinite / isinf / isnan {{{1
+// vfpclass categories: 0x01 QNaN, 0x08 +inf, 0x10 -inf, 0x80 SNaN
+Vc_ALWAYS_INLINE AVX512::float_m isfinite(const AVX512::float_v &x)
+{
+    return AVX512::float_m(__mmask16(~_mm512_fpclass_ps_mask(x.data(), 0x99)));
+}
+Vc_ALWAYS_INLINE AVX512::double_m isfinite(const AVX512::double_v &x)
+{
+    return AVX512::double_m(__mmask8(~_mm512_fpclass_pd_mask(x.data(), 0x99)));
+}
+Vc_ALWAYS_INLINE AVX512::float_m isinf(const AVX512::float_v &x)
+{
+    return AVX512::float_m(_mm512_fpclass_ps_mask(x.data(), 0x18));
+}
+Vc_ALWAYS_INLINE AVX512::double_m isinf(const AVX512::double_v &x)
+{
+    return AVX512::double_m(_mm512_fpclass_pd_mask(x.data(), 0x18));
+}
+Vc_ALWAYS_INLINE AVX512::float_m isnan(const AVX512::float_v &x)
+{
+    return AVX512::float_m(_mm512_cmp_ps_mask(x.data(), x.data(), _CMP_UNORD_Q));
+}
+Vc_ALWAYS_INLINE AVX512::double_m isnan(const AVX512::double_v &x)
+{
+    return AVX512::double_m(_mm512_cmp_pd_mask(x.data(), x.data(), _CMP_UNORD_Q));
+}
+
+// copysign {{{1
+Vc_INTRINSIC Vc_CONST AVX512::float_v copysign(AVX512::float_v mag, AVX512::float_v sign)
+{
+    // 0xe4: (sign & signbit) | (mag & ~signbit)
+    return _mm512_castsi512_ps(_mm512_ternarylogic_epi32(
+        _mm512_castps_si512(sign.data()), _mm512_castps_si512(mag.data()),
+        _mm512_set1_epi32(0x80000000u), 0xe4));
+}
+Vc_INTRINSIC Vc_CONST AVX512::double_v copysign(AVX512::double_v mag, AVX512::double_v sign)
+{
+    return _mm512_castsi512_pd(_mm512_ternarylogic_epi64(
+        _mm512_castpd_si512(sign.data()), _mm512_castpd_si512(mag.data()),
+        _mm512_set1_epi64(0x8000000000000000ull), 0xe4));
+}
+
+// exponent {{{1
+// vgetexp computes floor(log2(|x|)) for normal and denormal inputs.
+Vc_INTRINSIC Vc_CONST AVX512::float_v exponent(AVX512::float_v x)
+{
+    Vc_ASSERT(AVX512::float_m(Detail::cmple(x.Zero().data(), x.data(), float())).isFull());
+    return _mm512_getexp_ps(x.data());
+}
+Vc_INTRINSIC Vc_CONST AVX512::double_v exponent(AVX512::double_v x)
+{
+    Vc_ASSERT(AVX512::double_m(Detail::cmple(x.Zero().data(), x.data(), double())).isFull());
+    return _mm512_getexp_pd(x.data());
+}
+
+// frexp {{{1
+// vgetmant normalizes to [½, 1[ keeping the sign, vgetexp returns floor(log2(|x|)).
+// vfpclass 0x9f selects ±0, ±inf, and NaN, which are returned unchanged with exponent 0.
+inline AVX512::float_v frexp(AVX512::float_v::AsArg v, SimdArray<int, 16> *e)
+{
+    const __mmask16 regular = ~_mm512_fpclass_ps_mask(v.data(), 0x9f);
+    internal_data(*e) = _mm512_maskz_add_epi32(
+        regular, _mm512_cvttps_epi32(_mm512_getexp_ps(v.data())), _mm512_set1_epi32(1));
+    return _mm512_mask_getmant_ps(v.data(), regular, v.data(), _MM_MANT_NORM_p5_1,
+                                  _MM_MANT_SIGN_src);
+}
+inline AVX512::double_v frexp(AVX512::double_v::AsArg v, SimdArray<int, 8> *e)
+{
+    const __mmask8 regular = ~_mm512_fpclass_pd_mask(v.data(), 0x9f);
+    internal_data(*e) = _mm256_maskz_add_epi32(
+        regular, _mm512_cvttpd_epi32(_mm512_getexp_pd(v.data())), _mm256_set1_epi32(1));
+    return _mm512_mask_getmant_pd(v.data(), regular, v.data(), _MM_MANT_NORM_p5_1,
+                                  _MM_MANT_SIGN_src);
+}
+
+// ldexp {{{1
+// vscalef computes x * 2^floor(y) and passes zero, inf, and NaN through.
+inline AVX512::float_v ldexp(AVX512::float_v::AsArg v, const SimdArray<int, 16> &e)
+{
+    return _mm512_scalef_ps(v.data(), _mm512_cvtepi32_ps(internal_data(e).data()));
+}
+inline AVX512::double_v ldexp(AVX512::double_v::AsArg v, const SimdArray<int, 8> &e)
+{
+    return _mm512_scalef_pd(v.data(), _mm512_cvtepi32_pd(internal_data(e).data()));
+}
+
+// transcendental functions {{{1
+// There are no zmm kernels for these yet. Evaluate the AVX2 kernels on both halves.
+#define Vc_AVX512_SPLIT_FUNCTION_(name_)                                                 \
+    template <typename T>                                                                \
+    inline AVX512::Vector<T> name_(const AVX512::Vector<T> &x)                           \
+    {                                                                                    \
+        return simd_cast<AVX512::Vector<T>>(name_(simd_cast<AVX2::Vector<T>, 0>(x)),     \
+                                            name_(simd_cast<AVX2::Vector<T>, 1>(x)));    \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+Vc_AVX512_SPLIT_FUNCTION_(sin);
+Vc_AVX512_SPLIT_FUNCTION_(cos);
+Vc_AVX512_SPLIT_FUNCTION_(tan);
+Vc_AVX512_SPLIT_FUNCTION_(asin);
+Vc_AVX512_SPLIT_FUNCTION_(acos);
+Vc_AVX512_SPLIT_FUNCTION_(atan);
+Vc_AVX512_SPLIT_FUNCTION_(sinh);
+Vc_AVX512_SPLIT_FUNCTION_(cosh);
+Vc_AVX512_SPLIT_FUNCTION_(tanh);
+Vc_AVX512_SPLIT_FUNCTION_(asinh);
+Vc_AVX512_SPLIT_FUNCTION_(atanh);
+Vc_AVX512_SPLIT_FUNCTION_(exp);
+Vc_AVX512_SPLIT_FUNCTION_(exp2);
+Vc_AVX512_SPLIT_FUNCTION_(expm1);
+Vc_AVX512_SPLIT_FUNCTION_(log);
+Vc_AVX512_SPLIT_FUNCTION_(log2);
+Vc_AVX512_SPLIT_FUNCTION_(log10);
+Vc_AVX512_SPLIT_FUNCTION_(log1p);
+Vc_AVX512_SPLIT_FUNCTION_(cbrt);
+#undef Vc_AVX512_SPLIT_FUNCTION_
+
+template <typename T>
+inline AVX512::Vector<T> atan2(const AVX512::Vector<T> &y, const AVX512::Vector<T> &x)
+{
+    using V = AVX2::Vector<T>;
+    return simd_cast<AVX512::Vector<T>>(
+        atan2(simd_cast<V, 0>(y), simd_cast<V, 0>(x)),
+        atan2(simd_cast<V, 1>(y), simd_cast<V, 1>(x)));
+}
+template <typename T>
+inline AVX512::Vector<T> pow(const AVX512::Vector<T> &x, const AVX512::Vector<T> &y)
+{
+    using V = AVX2::Vector<T>;
+    return simd_cast<AVX512::Vector<T>>(pow(simd_cast<V, 0>(x), simd_cast<V, 0>(y)),
+                                        pow(simd_cast<V, 1>(x), simd_cast<V, 1>(y)));
+}
+template <typename T>
+inline void sincos(const AVX512::Vector<T> &x, AVX512::Vector<T> *sin,
+                   AVX512::Vector<T> *cos)
+{
+    using V = AVX2::Vector<T>;
+    V s[2], c[2];
+    sincos(simd_cast<V, 0>(x), &s[0], &c[0]);
+    sincos(simd_cast<V, 1>(x), &s[1], &c[1]);
+    *sin = simd_cast<AVX512::Vector<T>>(s[0], s[1]);
+    *cos = simd_cast<AVX512::Vector<T>>(c[0], c[1]);
+}
+// }}}1
+}  // namespace Vc
+
+#endif  // VC_AVX512_MATH_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,276 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_AVX512_SIMD_CAST_H_
+#define VC_AVX512_SIMD_CAST_H_
+
+#include "../avx/simd_cast.h"
+#include "vector.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace AVX512
+{
+/**\internal
+ * The casts below that have a dedicated implementation. All other casts from or to an
+ * AVX512 type fall back to converting the entries one by one.
+ */
+template <typename Return, typename From, std::size_t N>
+struct has_native_cast
+    : public std::integral_constant<
+          bool,
+          // between AVX512 types
+          ((is_vector<Return>::value && is_vector<From>::value) ||
+           (is_mask<Return>::value && is_mask<From>::value)) ||
+              // between k-masks and SSE/AVX vector masks
+              (N == 1 && ((is_mask<Return>::value &&
+                           (AVX2::is_mask<From>::value || SSE::is_mask<From>::value)) ||
+                          (is_mask<From>::value &&
+                           (AVX2::is_mask<Return>::value || SSE::is_mask<Return>::value)))) ||
+              // between AVX512 and AVX2 vectors of equal EntryType
+              (is_vector<Return>::value && AVX2::is_vector<From>::value && N <= 2 &&
+               std::is_same<Traits::entry_type_of<Return>, Traits::entry_type_of<From>>::value) ||
+              (AVX2::is_vector<Return>::value && is_vector<From>::value && N == 1 &&
+               std::is_same<Traits::entry_type_of<Return>, Traits::entry_type_of<From>>::value)> {
+};
+
+// casts with an offset that have a dedicated implementation
+template <typename Return, typename From>
+struct has_native_offset_cast
+    : public std::integral_constant<
+          bool, (is_vector<Return>::value && is_vector<From>::value) ||
+                    (is_mask<Return>::value && is_mask<From>::value) ||
+                    (AVX2::is_vector<Return>::value && is_vector<From>::value &&
+                     std::is_same<Traits::entry_type_of<Return>,
+                                  Traits::entry_type_of<From>>::value)> {
+};
+
+template <typename... Ts> struct all_same;
+template <typename T> struct all_same<T> : public std::true_type {};
+template <typename T, typename... Ts>
+struct all_same<T, T, Ts...> : public all_same<T, Ts...> {};
+template <typename T, typename U, typename... Ts>
+struct all_same<T, U, Ts...> : public std::false_type {};
+
+template <typename Return, typename From, typename... Froms>
+using is_generic_cast = std::integral_constant<bool,
+    (is_vector<Return>::value || is_vector<From>::value || is_mask<Return>::value ||
+     is_mask<From>::value) &&
+        ((Traits::is_simd_vector<Return>::value && !Traits::isSimdArray<Return>::value &&
+          Traits::is_simd_vector<From>::value && !Traits::isSimdArray<From>::value) ||
+         (Traits::is_simd_mask<Return>::value && !Traits::isSimdMaskArray<Return>::value &&
+          Traits::is_simd_mask<From>::value && !Traits::isSimdMaskArray<From>::value)) &&
+        all_same<From, Froms...>::value>;
+
+template <typename Return, typename From, typename... Froms>
+using enable_if_generic_cast = enable_if<
+    is_generic_cast<Return, From, Froms...>::value &&
+        !has_native_cast<Return, From, 1 + sizeof...(Froms)>::value,
+    Return>;
+}  // namespace AVX512
+
+// vector casts between entry types of equal size {{{1
+#define Vc_SIMD_CAST_AVX512(from_, to_)                                                  \
+    template <typename To>                                                               \
+    Vc_INTRINSIC Vc_CONST To simd_cast(                                                  \
+        AVX512::from_ x, enable_if<std::is_same<To, AVX512::to_>::value> = nullarg)
+Vc_SIMD_CAST_AVX512( float_v,    int_v) { return _mm512_cvttps_epi32(x.data()); }
+Vc_SIMD_CAST_AVX512( float_v,   uint_v) { return _mm512_cvttps_epu32(x.data()); }
+Vc_SIMD_CAST_AVX512(   int_v,  float_v) { return _mm512_cvtepi32_ps(x.data()); }
+Vc_SIMD_CAST_AVX512(  uint_v,  float_v) { return _mm512_cvtepu32_ps(x.data()); }
+Vc_SIMD_CAST_AVX512(   int_v,   uint_v) { return x.data(); }
+Vc_SIMD_CAST_AVX512(  uint_v,    int_v) { return x.data(); }
+
+// vector casts from and to double_v {{{1
+Vc_SIMD_CAST_AVX512(double_v,  float_v) { return Detail::avx512_zero_extend(_mm512_cvtpd_ps(x.data())); }
+Vc_SIMD_CAST_AVX512(double_v,    int_v) { return Detail::avx512_zero_extend(_mm512_cvttpd_epi32(x.data())); }
+Vc_SIMD_CAST_AVX512(double_v,   uint_v) { return Detail::avx512_zero_extend(_mm512_cvttpd_epu32(x.data())); }
+Vc_SIMD_CAST_AVX512( float_v, double_v) { return _mm512_cvtps_pd(Detail::lo256(x.data())); }
+Vc_SIMD_CAST_AVX512(   int_v, double_v) { return _mm512_cvtepi32_pd(Detail::lo256(x.data())); }
+Vc_SIMD_CAST_AVX512(  uint_v, double_v) { return _mm512_cvtepu32_pd(Detail::lo256(x.data())); }
+#undef Vc_SIMD_CAST_AVX512
+
+#define Vc_SIMD_CAST_AVX512_2(from_, to_)                                                \
+    template <typename To>                                                               \
+    Vc_INTRINSIC Vc_CONST To simd_cast(                                                  \
+        AVX512::from_ x0, AVX512::from_ x1,                                              \
+        enable_if<std::is_same<To, AVX512::to_>::value> = nullarg)
+Vc_SIMD_CAST_AVX512_2(double_v, float_v)
+{
+    return Detail::avx512_concat(_mm512_cvtpd_ps(x0.data()), _mm512_cvtpd_ps(x1.data()));
+}
+Vc_SIMD_CAST_AVX512_2(double_v, int_v)
+{
+    return Detail::avx512_concat(_mm512_cvttpd_epi32(x0.data()), _mm512_cvttpd_epi32(x1.data()));
+}
+Vc_SIMD_CAST_AVX512_2(double_v, uint_v)
+{
+    return Detail::avx512_concat(_mm512_cvttpd_epu32(x0.data()), _mm512_cvttpd_epu32(x1.data()));
+}
+#undef Vc_SIMD_CAST_AVX512_2
+
+#define Vc_SIMD_CAST_AVX512_OFFSET(from_, to_)                                           \
+    template <typename Return, int offset>                                               \
+    Vc_INTRINSIC Vc_CONST Return simd_cast(                                              \
+        AVX512::from_ x,                                                                 \
+        enable_if<(offset == 1 && std::is_same<Return, AVX512::to_>::value)> = nullarg)
+Vc_SIMD_CAST_AVX512_OFFSET( float_v, double_v) { return _mm512_cvtps_pd(Detail::hi256(x.data())); }
+Vc_SIMD_CAST_AVX512_OFFSET(   int_v, double_v) { return _mm512_cvtepi32_pd(Detail::hi256(x.data())); }
+Vc_SIMD_CAST_AVX512_OFFSET(  uint_v, double_v) { return _mm512_cvtepu32_pd(Detail::hi256(x.data())); }
+#undef Vc_SIMD_CAST_AVX512_OFFSET
+
+// vector casts between AVX512 and AVX2 of equal EntryType {{{1
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::Vector<T> x,
+          enable_if<std::is_same<Return, AVX512::Vector<T>>::value> = nullarg)
+{
+    return Detail::avx512_zero_extend(x.data());
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1,
+          enable_if<std::is_same<Return, AVX512::Vector<T>>::value> = nullarg)
+{
+    return Detail::avx512_concat(x0.data(), x1.data());
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX512::Vector<T> x,
+          enable_if<std::is_same<Return, AVX2::Vector<T>>::value> = nullarg)
+{
+    return Detail::lo256(x.data());
+}
+template <typename Return, int offset, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX512::Vector<T> x,
+          enable_if<(offset == 1 && std::is_same<Return, AVX2::Vector<T>>::value)> = nullarg)
+{
+    return Detail::hi256(x.data());
+}
+
+// mask casts {{{1
+// The k-register holds one bit per entry, so the casts only truncate or zero-extend it.
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(const AVX512::Mask<T> &k,
+          enable_if<AVX512::is_mask<Return>::value &&
+                    !std::is_same<Return, AVX512::Mask<T>>::value> = nullarg)
+{
+    return Return(typename Return::VectorType(k.data()));
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(const AVX512::Mask<T> &k0, const AVX512::Mask<T> &k1,
+          enable_if<AVX512::is_mask<Return>::value &&
+                    Return::Size == 2 * AVX512::Mask<T>::Size> = nullarg)
+{
+    return Return(typename Return::VectorType(k0.data() | (k1.data() << AVX512::Mask<T>::Size)));
+}
+template <typename Return, int offset, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(const AVX512::Mask<T> &k,
+          enable_if<(offset != 0 && AVX512::is_mask<Return>::value)> = nullarg)
+{
+    return Return(typename Return::VectorType(k.data() >> (offset * Return::Size)));
+}
+
+// SSE and AVX2 masks to k-masks and back
+template <typename Return, typename M>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(const M &m, enable_if<AVX512::is_mask<Return>::value &&
+                                (AVX2::is_mask<M>::value || SSE::is_mask<M>::value)> = nullarg)
+{
+    using EntrySize = Detail::MaskEntrySize<sizeof(typename M::Vector::EntryType)>;
+    return Return(typename Return::VectorType(Detail::to_kmask(m.dataI(), EntrySize())));
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(const AVX512::Mask<T> &k,
+          enable_if<AVX2::is_mask<Return>::value || SSE::is_mask<Return>::value> = nullarg)
+{
+    using EntrySize = Detail::MaskEntrySize<sizeof(typename Return::Vector::EntryType)>;
+    return Detail::from_kmask(k.data(), decltype(Return().dataI())(), EntrySize());
+}
+
+// generic conversions {{{1
+// Everything else that involves AVX512 types (mostly casts from and to SSE, Scalar, or AVX2
+// vectors of a different EntryType) copies the entries one by one.
+template <typename Return, typename From, typename... Froms>
+Vc_INTRINSIC Vc_CONST AVX512::enable_if_generic_cast<Return, From, Froms...> simd_cast(
+    From x0, Froms... xs)
+{
+    using R = typename Return::EntryType;
+    const From x[] = {x0, xs...};
+    constexpr std::size_t N = From::Size * (1 + sizeof...(Froms));
+    return Return::generate([&](std::size_t i) {
+        return i < N ? static_cast<R>(x[i / From::Size][i % From::Size]) : R();
+    });
+}
+
+// offset == 0 forwards to the casts above; generic conversions with an offset
+template <typename Return, int offset, typename From>
+Vc_INTRINSIC Vc_CONST enable_if<
+    (offset == 0 && (AVX512::is_vector<From>::value || AVX512::is_mask<From>::value) &&
+     !Scalar::is_vector<Return>::value && !Scalar::is_mask<Return>::value &&
+     !Traits::isSimdArray<Return>::value && !Traits::isSimdMaskArray<Return>::value),
+    Return>
+simd_cast(const From &x)
+{
+    return simd_cast<Return>(x);
+}
+template <typename Return, int offset, typename From>
+Vc_INTRINSIC Vc_CONST enable_if<
+    (offset == 0 && (AVX512::is_vector<Return>::value || AVX512::is_mask<Return>::value) &&
+     (SSE::is_vector<From>::value || SSE::is_mask<From>::value)),
+    Return>
+simd_cast(const From &x)
+{
+    return simd_cast<Return>(x);
+}
+template <typename Return, int offset, typename From>
+Vc_INTRINSIC Vc_CONST
+    enable_if<(offset != 0 && !Scalar::is_vector<Return>::value &&
+               !Scalar::is_mask<Return>::value &&
+               AVX512::is_generic_cast<Return, From>::value &&
+               !AVX512::has_native_offset_cast<Return, From>::value),
+              Return>
+    simd_cast(const From &x)
+{
+    using R = typename Return::EntryType;
+    return Return::generate([&](std::size_t i) {
+        const std::size_t j = offset * Return::Size + i;
+        return j < From::Size ? static_cast<R>(x[j]) : R();
+    });
+}
+// }}}1
+}  // namespace Vc
+
+#endif  // VC_AVX512_SIMD_CAST_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,98 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_AVX512_TYPES_H_
+#define VC_AVX512_TYPES_H_
+
+#include "../avx/types.h"
+#include "macros.h"
+
+#ifdef Vc_DEFAULT_IMPL_AVX512
+#define Vc_DOUBLE_V_SIZE 8
+#define Vc_FLOAT_V_SIZE 16
+#define Vc_INT_V_SIZE 16
+#define Vc_UINT_V_SIZE 16
+#define Vc_SHORT_V_SIZE 16
+#define Vc_USHORT_V_SIZE 16
+#endif
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace AVX512
+{
+template <typename T> using Vector = Vc::Vector<T, VectorAbi::Avx512>;
+using double_v = Vector<double>;
+using  float_v = Vector< float>;
+using    int_v = Vector<   int>;
+using   uint_v = Vector<  uint>;
+
+template <typename T> using Mask = Vc::Mask<T, VectorAbi::Avx512>;
+using double_m = Mask<double>;
+using  float_m = Mask< float>;
+using    int_m = Mask<   int>;
+using   uint_m = Mask<  uint>;
+
+template <typename T> struct VectorTypeHelper;
+template <> struct VectorTypeHelper<         int> { using Type = __m512i; };
+template <> struct VectorTypeHelper<unsigned int> { using Type = __m512i; };
+template <> struct VectorTypeHelper<       float> { using Type = __m512 ; };
+template <> struct VectorTypeHelper<      double> { using Type = __m512d; };
+
+// one bit per entry: 16 entries of 4 Bytes or 8 entries of 8 Bytes fill a zmm register
+template <typename T>
+using MaskTypeHelper = typename std::conditional<sizeof(T) == 8, __mmask8, __mmask16>::type;
+
+/**\internal
+ * The entry types Vector<T, VectorAbi::Avx512> supports: the 32-bit and 64-bit types that
+ * AVX512F handles natively.
+ */
+template <typename T>
+struct is_valid_entry_type
+    : public std::integral_constant<bool, std::is_same<T, double>::value ||
+                                              std::is_same<T, float>::value ||
+                                              std::is_same<T, int>::value ||
+                                              std::is_same<T, uint>::value> {
+};
+
+template <typename T> struct is_vector : public std::false_type {};
+template <typename T> struct is_vector<Vector<T>> : public std::true_type {};
+template <typename T> struct is_mask : public std::false_type {};
+template <typename T> struct is_mask<Mask<T>> : public std::true_type {};
+}  // namespace AVX512
+
+namespace Traits
+{
+template <class T> struct
+is_simd_vector_internal<Vector<T, VectorAbi::Avx512>>
+  : public AVX512::is_valid_entry_type<T> {};
+
+template<typename T> struct is_simd_mask_internal<Mask<T, VectorAbi::Avx512>>
+  : public std::true_type {};
+}  // namespace Traits
+}  // namespace Vc
+
+#endif // VC_AVX512_TYPES_H_
@@ -0,0 +1,380 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_AVX512_VECTOR_H_
+#define VC_AVX512_VECTOR_H_
+
+#include "../avx/vector.h"
+#include "detail.h"
+#include "mask.h"
+#include "../common/where.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+#define Vc_CURRENT_CLASS_NAME Vector
+/**\internal
+ * Vector<T, VectorAbi::Avx512> uses a full zmm register: 16 entries of float, int, and uint
+ * or 8 entries of double. Masks are k-registers (see Mask<T, VectorAbi::Avx512>), which
+ * makes masked loads, stores, gathers, scatters, and blends single instructions.
+ */
+template <typename T> class Vector<T, VectorAbi::Avx512>
+{
+    static_assert(AVX512::is_valid_entry_type<T>::value,
+                  "Vector<T, VectorAbi::Avx512> only supports double, float, int, and uint.");
+
+public:
+    using abi = VectorAbi::Avx512;
+
+    using VectorType = typename AVX512::VectorTypeHelper<T>::Type;
+    using vector_type = VectorType;
+
+    using mask_type = Vc::Mask<T, abi>;
+    using Mask = mask_type;
+    using MaskType = mask_type;
+    using MaskArgument = typename Mask::AsArg;
+    using reference = Detail::ElementReference<Vector>;
+
+    Vc_FREE_STORE_OPERATORS_ALIGNED(alignof(VectorType));
+
+    using EntryType = T;
+    using value_type = EntryType;
+    typedef EntryType VectorEntryType;
+    static constexpr size_t Size = sizeof(VectorType) / sizeof(EntryType);
+    static constexpr size_t MemoryAlignment = alignof(VectorType);
+    using IndexType = fixed_size_simd<int, Size>;
+    typedef Vector<T, abi> AsArg;
+    typedef VectorType VectorTypeArg;
+
+protected:
+    template <typename U> using V = Vector<U, abi>;
+    using EntrySize = std::integral_constant<std::size_t, sizeof(T)>;
+
+    // zero like the Storage of the SSE and AVX vectors: the default constructor and the
+    // masked gather constructor rely on it
+    VectorType m_data = Detail::avx512_zero<VectorType>();
+
+public:
+#include "../common/generalinterface.h"
+
+    static Vc_ALWAYS_INLINE_L Vector Random() Vc_ALWAYS_INLINE_R;
+
+    ///////////////////////////////////////////////////////////////////////////////////////////
+    // internal: required to enable returning objects of VectorType
+    Vc_ALWAYS_INLINE Vector(VectorTypeArg x) : m_data(x) {}
+
+    // implict conversion between int and uint vectors
+    template <typename U>
+    Vc_INTRINSIC Vector(
+        V<U> x, typename std::enable_if<Traits::is_implicit_cast_allowed<U, T>::value,
+                                        void *>::type = nullptr)
+        : m_data(x.data())
+    {
+    }
+
+#if Vc_IS_VERSION_1
+    // static_cast from the remaining Vector<U, abi>
+    template <typename U>
+    Vc_DEPRECATED("use simd_cast instead of explicit type casting to convert between "
+                  "vector types") Vc_INTRINSIC explicit Vector(
+        V<U> x,
+        typename std::enable_if<!Traits::is_implicit_cast_allowed<U, T>::value,
+                                void *>::type = nullptr)
+        : m_data(simd_cast<Vector>(x).data())
+    {
+    }
+
+    // static_cast from other types, implemented via the non-member simd_cast function in
+    // simd_cast_caller.tcc
+    template <typename U,
+              typename = enable_if<Traits::is_simd_vector<U>::value &&
+                                   !std::is_same<Vector, Traits::decay<U>>::value>>
+    Vc_DEPRECATED("use simd_cast instead of explicit type casting to convert between "
+                  "vector types") Vc_INTRINSIC_L
+        explicit Vector(U &&x) Vc_INTRINSIC_R;
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////////////////////
+    // broadcast
+    Vc_INTRINSIC Vector(EntryType a) : m_data(Detail::avx512_broadcast(a)) {}
+    template <typename U>
+    Vc_INTRINSIC Vector(U a,
+                        typename std::enable_if<std::is_same<U, int>::value &&
+                                                    !std::is_same<U, EntryType>::value,
+                                                void *>::type = nullptr)
+        : Vector(static_cast<EntryType>(a))
+    {
+    }
+
+    explicit Vector(std::initializer_list<EntryType>)
+    {
+        static_assert(std::is_same<EntryType, void>::value,
+                      "A SIMD vector object cannot be initialized from an initializer list "
+                      "because the number of entries in the vector is target-dependent.");
+    }
+
+#include "../common/loadinterface.h"
+#include "../common/storeinterface.h"
+
+    ///////////////////////////////////////////////////////////////////////////////////////////
+    // zeroing
+    Vc_INTRINSIC void setZero() { m_data = Detail::avx512_zero<VectorType>(); }
+    Vc_INTRINSIC void setZero(const Mask &k)
+    {
+        m_data = Detail::blend(m_data, Detail::avx512_zero<VectorType>(), k.data());
+    }
+    Vc_INTRINSIC void setZeroInverted(const Mask &k)
+    {
+        m_data = Detail::blend(Detail::avx512_zero<VectorType>(), m_data, k.data());
+    }
+
+    Vc_INTRINSIC_L void setQnan() Vc_INTRINSIC_R;
+    Vc_INTRINSIC_L void setQnan(MaskArgument k) Vc_INTRINSIC_R;
+
+#include "../common/gatherinterface.h"
+#include "../common/scatterinterface.h"
+
+    ///////////////////////////////////////////////////////////////////////////////////////////
+    //prefix
+    Vc_ALWAYS_INLINE Vector &operator++() { m_data = Detail::add(m_data, Detail::avx512_broadcast(T(1)), T()); return *this; }
+    Vc_ALWAYS_INLINE Vector &operator--() { m_data = Detail::sub(m_data, Detail::avx512_broadcast(T(1)), T()); return *this; }
+    //postfix
+    Vc_ALWAYS_INLINE Vector operator++(int) { const Vector r = *this; ++*this; return r; }
+    Vc_ALWAYS_INLINE Vector operator--(int) { const Vector r = *this; --*this; return r; }
+
+private:
+    friend reference;
+    Vc_INTRINSIC static value_type get(const Vector &o, int i) noexcept
+    {
+        return aliasing_cast<EntryType>(&o.m_data)[i];
+    }
+    template <typename U>
+    Vc_INTRINSIC static void set(Vector &o, int i, U &&v) noexcept(
+        noexcept(std::declval<value_type &>() = v))
+    {
+        aliasing_cast<EntryType>(&o.m_data)[i] = v;
+    }
+
+public:
+    /**
+     * \note the returned object models the concept of a reference and
+     * as such it can exist longer than the data it is referencing.
+     * \note to avoid lifetime issues, we strongly advice not to store
+     * any reference objects.
+     */
+    Vc_ALWAYS_INLINE reference operator[](size_t index) noexcept
+    {
+        static_assert(noexcept(reference{std::declval<Vector &>(), int()}), "");
+        return {*this, int(index)};
+    }
+    Vc_ALWAYS_INLINE value_type operator[](size_t index) const noexcept
+    {
+        return get(*this, int(index));
+    }
+
+    Vc_INTRINSIC Vc_PURE Vector operator[](Permutation::ReversedTag) const
+    {
+        return reversed();
+    }
+    Vc_INTRINSIC_L Vc_PURE_L Vector operator[](const IndexType &perm) const Vc_INTRINSIC_R Vc_PURE_R;
+
+    Vc_INTRINSIC Vc_PURE Mask operator!() const
+    {
+        return Detail::cmpeq(m_data, Detail::avx512_zero<VectorType>(), T());
+    }
+    Vc_ALWAYS_INLINE Vector operator~() const
+    {
+#ifndef Vc_ENABLE_FLOAT_BIT_OPERATORS
+        static_assert(std::is_integral<T>::value,
+                      "bit-complement can only be used with Vectors of integral type");
+#endif
+        return Detail::andnot_(m_data, Detail::avx512_allone<VectorType>());
+    }
+    Vc_ALWAYS_INLINE_L Vc_PURE_L Vector operator-() const Vc_ALWAYS_INLINE_R Vc_PURE_R;
+    Vc_INTRINSIC Vc_PURE Vector operator+() const { return *this; }
+
+    // shifts
+    Vc_ALWAYS_INLINE_L Vector &operator>>=(AsArg x) Vc_ALWAYS_INLINE_R;
+    Vc_ALWAYS_INLINE_L Vector &operator<<=(AsArg x) Vc_ALWAYS_INLINE_R;
+    Vc_ALWAYS_INLINE_L Vector operator>>(AsArg x) const Vc_ALWAYS_INLINE_R;
+    Vc_ALWAYS_INLINE_L Vector operator<<(AsArg x) const Vc_ALWAYS_INLINE_R;
+    Vc_ALWAYS_INLINE_L Vector &operator>>=(int x) Vc_ALWAYS_INLINE_R;
+    Vc_ALWAYS_INLINE_L Vector &operator<<=(int x) Vc_ALWAYS_INLINE_R;
+    Vc_ALWAYS_INLINE_L Vector operator>>(int x) const Vc_ALWAYS_INLINE_R;
+    Vc_ALWAYS_INLINE_L Vector operator<<(int x) const Vc_ALWAYS_INLINE_R;
+
+    Vc_DEPRECATED("use isnegative(x) instead") Vc_INTRINSIC Vc_PURE Mask
+        isNegative() const
+    {
+        return Vc::isnegative(*this);
+    }
+
+    Vc_ALWAYS_INLINE void assign(const Vector &v, const Mask &mask)
+    {
+        m_data = Detail::blend(m_data, v.m_data, mask.data());
+    }
+
+    Vc_ALWAYS_INLINE Common::WriteMaskedVector<Vector, Mask> operator()(const Mask &k)
+    {
+        return {*this, k};
+    }
+
+    Vc_ALWAYS_INLINE VectorType &data() { return m_data; }
+    Vc_ALWAYS_INLINE const VectorType &data() const { return m_data; }
+
+    Vc_ALWAYS_INLINE EntryType min() const { return Detail::min(m_data, T()); }
+    Vc_ALWAYS_INLINE EntryType max() const { return Detail::max(m_data, T()); }
+    Vc_ALWAYS_INLINE EntryType product() const { return Detail::mul(m_data, T()); }
+    Vc_ALWAYS_INLINE EntryType sum() const { return Detail::add(m_data, T()); }
+    Vc_ALWAYS_INLINE_L Vector partialSum() const Vc_ALWAYS_INLINE_R;
+    Vc_ALWAYS_INLINE EntryType min(MaskArgument m) const { return Detail::min(m_data, m.data(), T()); }
+    Vc_ALWAYS_INLINE EntryType max(MaskArgument m) const { return Detail::max(m_data, m.data(), T()); }
+    Vc_ALWAYS_INLINE EntryType product(MaskArgument m) const { return Detail::mul(m_data, m.data(), T()); }
+    Vc_ALWAYS_INLINE EntryType sum(MaskArgument m) const { return Detail::add(m_data, m.data(), T()); }
+
+    Vc_INTRINSIC_L Vector shifted(int amount, Vector shiftIn) const Vc_INTRINSIC_R;
+    Vc_INTRINSIC_L Vector shifted(int amount) const Vc_INTRINSIC_R;
+    Vc_INTRINSIC_L Vector rotated(int amount) const Vc_INTRINSIC_R;
+    Vc_INTRINSIC_L Vc_PURE_L Vector reversed() const Vc_INTRINSIC_R Vc_PURE_R;
+    Vc_ALWAYS_INLINE_L Vc_PURE_L Vector sorted() const Vc_ALWAYS_INLINE_R Vc_PURE_R;
+
+    template <typename F> void callWithValuesSorted(F &&f)
+    {
+        const Vector s = sorted();
+        EntryType value = s[0];
+        f(value);
+        for (size_t i = 1; i < Size; ++i) {
+            if (s[i] != value) {
+                value = s[i];
+                f(value);
+            }
+        }
+    }
+
+    template <typename F> Vc_INTRINSIC void call(F &&f) const
+    {
+        Common::for_all_vector_entries<Size>([&](size_t i) { f(EntryType(get(*this, i))); });
+    }
+
+    template <typename F> Vc_INTRINSIC void call(F &&f, const Mask &mask) const
+    {
+        for (size_t i : where(mask)) {
+            f(EntryType(get(*this, i)));
+        }
+    }
+
+    template <typename F> Vc_INTRINSIC Vector apply(F &&f) const
+    {
+        Vector r;
+        Common::for_all_vector_entries<Size>(
+            [&](size_t i) { set(r, i, f(EntryType(get(*this, i)))); });
+        return r;
+    }
+
+    template <typename F> Vc_INTRINSIC Vector apply(F &&f, const Mask &mask) const
+    {
+        Vector r(*this);
+        for (size_t i : where(mask)) {
+            set(r, i, f(EntryType(get(r, i))));
+        }
+        return r;
+    }
+
+    template<typename IndexT> Vc_INTRINSIC void fill(EntryType (&f)(IndexT)) {
+        Common::for_all_vector_entries<Size>([&](size_t i) { set(*this, i, f(i)); });
+    }
+    Vc_INTRINSIC void fill(EntryType (&f)()) {
+        Common::for_all_vector_entries<Size>([&](size_t i) { set(*this, i, f()); });
+    }
+
+    template <typename G> static Vc_INTRINSIC Vector generate(G gen)
+    {
+        Vector r;
+        Common::unrolled_loop<std::size_t, 0, Size>(
+            [&](std::size_t i) { set(r, i, gen(i)); });
+        return r;
+    }
+
+    Vc_DEPRECATED("use copysign(x, y) instead") Vc_INTRINSIC Vector
+        copySign(AsArg x) const
+    {
+        return Vc::copysign(*this, x);
+    }
+
+    Vc_DEPRECATED("use exponent(x) instead") Vc_INTRINSIC Vector exponent() const
+    {
+        return Vc::exponent(*this);
+    }
+
+    Vc_INTRINSIC_L Vector interleaveLow(Vector x) const Vc_INTRINSIC_R;
+    Vc_INTRINSIC_L Vector interleaveHigh(Vector x) const Vc_INTRINSIC_R;
+};
+#undef Vc_CURRENT_CLASS_NAME
+template <typename T> constexpr size_t Vector<T, VectorAbi::Avx512>::Size;
+template <typename T> constexpr size_t Vector<T, VectorAbi::Avx512>::MemoryAlignment;
+
+#define Vc_CONDITIONAL_ASSIGN(name_, op_)                                                \
+    template <Operator O, typename T, typename M, typename U>                            \
+    Vc_INTRINSIC enable_if<O == Operator::name_, void> conditional_assign(               \
+        AVX512::Vector<T> &lhs, M &&mask, U &&rhs)                                       \
+    {                                                                                    \
+        lhs(mask) op_ rhs;                                                               \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+Vc_CONDITIONAL_ASSIGN(          Assign,  =);
+Vc_CONDITIONAL_ASSIGN(      PlusAssign, +=);
+Vc_CONDITIONAL_ASSIGN(     MinusAssign, -=);
+Vc_CONDITIONAL_ASSIGN(  MultiplyAssign, *=);
+Vc_CONDITIONAL_ASSIGN(    DivideAssign, /=);
+Vc_CONDITIONAL_ASSIGN( RemainderAssign, %=);
+Vc_CONDITIONAL_ASSIGN(       XorAssign, ^=);
+Vc_CONDITIONAL_ASSIGN(       AndAssign, &=);
+Vc_CONDITIONAL_ASSIGN(        OrAssign, |=);
+Vc_CONDITIONAL_ASSIGN( LeftShiftAssign,<<=);
+Vc_CONDITIONAL_ASSIGN(RightShiftAssign,>>=);
+#undef Vc_CONDITIONAL_ASSIGN
+
+#define Vc_CONDITIONAL_ASSIGN(name_, expr_)                                              \
+    template <Operator O, typename T, typename M>                                        \
+    Vc_INTRINSIC enable_if<O == Operator::name_, AVX512::Vector<T>> conditional_assign(  \
+        AVX512::Vector<T> &lhs, M &&mask)                                                \
+    {                                                                                    \
+        return expr_;                                                                    \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+Vc_CONDITIONAL_ASSIGN(PostIncrement, lhs(mask)++);
+Vc_CONDITIONAL_ASSIGN( PreIncrement, ++lhs(mask));
+Vc_CONDITIONAL_ASSIGN(PostDecrement, lhs(mask)--);
+Vc_CONDITIONAL_ASSIGN( PreDecrement, --lhs(mask));
+#undef Vc_CONDITIONAL_ASSIGN
+
+}  // namespace Vc
+
+#include "vector.tcc"
+#include "simd_cast.h"
+
+#endif // VC_AVX512_VECTOR_H_
@@ -0,0 +1,593 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "../common/x86_prefetches.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// compare operators {{{1
+#define Vc_OP(op_, impl_)                                                                \
+    template <typename T>                                                                \
+    Vc_INTRINSIC AVX512::Mask<T> operator op_(AVX512::Vector<T> a, AVX512::Vector<T> b)  \
+    {                                                                                    \
+        return impl_;                                                                    \
+    }
+Vc_OP(==, cmpeq (a.data(), b.data(), T()));
+Vc_OP(!=, cmpneq(a.data(), b.data(), T()));
+Vc_OP(< , cmplt (a.data(), b.data(), T()));
+Vc_OP(<=, cmple (a.data(), b.data(), T()));
+Vc_OP(> , cmplt (b.data(), a.data(), T()));
+Vc_OP(>=, cmple (b.data(), a.data(), T()));
+#undef Vc_OP
+
+// bitwise operators {{{1
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> operator^(AVX512::Vector<T> a, AVX512::Vector<T> b)
+{
+    return xor_(a.data(), b.data());
+}
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> operator&(AVX512::Vector<T> a, AVX512::Vector<T> b)
+{
+    return and_(a.data(), b.data());
+}
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> operator|(AVX512::Vector<T> a, AVX512::Vector<T> b)
+{
+    return or_(a.data(), b.data());
+}
+// arithmetic operators {{{1
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> operator+(AVX512::Vector<T> a, AVX512::Vector<T> b)
+{
+    return add(a.data(), b.data(), T());
+}
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> operator-(AVX512::Vector<T> a, AVX512::Vector<T> b)
+{
+    return sub(a.data(), b.data(), T());
+}
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> operator*(AVX512::Vector<T> a, AVX512::Vector<T> b)
+{
+    return mul(a.data(), b.data(), T());
+}
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> operator/(AVX512::Vector<T> a, AVX512::Vector<T> b)
+{
+    return div(a.data(), b.data(), T());
+}
+template <typename T>
+Vc_INTRINSIC enable_if<std::is_integral<T>::value, AVX512::Vector<T>> operator%(
+    AVX512::Vector<T> a, AVX512::Vector<T> b)
+{
+    return a - a / b * b;
+}
+
+// converting loads {{{1
+// Entries of equal size need no conversion (this includes int <-> uint).
+template <class T, class U, class Flags>
+Vc_INTRINSIC enable_if<sizeof(T) == sizeof(U) &&
+                           std::is_integral<T>::value == std::is_integral<U>::value,
+                       typename AVX512::VectorTypeHelper<T>::Type>
+avx512_load(const U *mem, Flags f, T)
+{
+    return load64(mem, f);
+}
+// AVX512F converts 8- and 16-bit integers while loading, and 32-bit integers to float
+template <class Flags> Vc_INTRINSIC __m512i avx512_load(const schar *mem, Flags, int)
+{
+    return _mm512_cvtepi8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(mem)));
+}
+template <class Flags> Vc_INTRINSIC __m512i avx512_load(const uchar *mem, Flags, int)
+{
+    return _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(mem)));
+}
+template <class Flags> Vc_INTRINSIC __m512i avx512_load(const short *mem, Flags, int)
+{
+    return _mm512_cvtepi16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(mem)));
+}
+template <class Flags> Vc_INTRINSIC __m512i avx512_load(const ushort *mem, Flags, int)
+{
+    return _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(mem)));
+}
+template <class U, class Flags>
+Vc_INTRINSIC enable_if<std::is_integral<U>::value && (sizeof(U) < 4), __m512i> avx512_load(
+    const U *mem, Flags f, uint)
+{
+    return avx512_load(mem, f, int());
+}
+template <class U, class Flags>
+Vc_INTRINSIC enable_if<std::is_integral<U>::value && (sizeof(U) < 4), __m512> avx512_load(
+    const U *mem, Flags f, float)
+{
+    return _mm512_cvtepi32_ps(avx512_load(mem, f, int()));
+}
+template <class Flags> Vc_INTRINSIC __m512 avx512_load(const int *mem, Flags f, float)
+{
+    return _mm512_cvtepi32_ps(load64(mem, f));
+}
+template <class Flags> Vc_INTRINSIC __m512 avx512_load(const uint *mem, Flags f, float)
+{
+    return _mm512_cvtepu32_ps(load64(mem, f));
+}
+template <class Flags> Vc_INTRINSIC __m512i avx512_load(const float *mem, Flags f, int)
+{
+    return _mm512_cvttps_epi32(load64(mem, f));
+}
+template <class Flags> Vc_INTRINSIC __m512i avx512_load(const float *mem, Flags f, uint)
+{
+    return _mm512_cvttps_epu32(load64(mem, f));
+}
+template <class Flags> Vc_INTRINSIC __m512d avx512_load(const float *mem, Flags, double)
+{
+    return _mm512_cvtps_pd(_mm256_loadu_ps(mem));
+}
+template <class U, class Flags>
+Vc_INTRINSIC enable_if<std::is_integral<U>::value && (sizeof(U) < 4), __m512d> avx512_load(
+    const U *mem, Flags f, double)
+{
+    return _mm512_cvtepi32_pd(_mm512_castsi512_si256(avx512_load(mem, f, int())));
+}
+template <class Flags> Vc_INTRINSIC __m512d avx512_load(const int *mem, Flags, double)
+{
+    return _mm512_cvtepi32_pd(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(mem)));
+}
+template <class Flags> Vc_INTRINSIC __m512d avx512_load(const uint *mem, Flags, double)
+{
+    return _mm512_cvtepu32_pd(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(mem)));
+}
+template <class Flags> Vc_INTRINSIC __m512 avx512_load(const double *mem, Flags, float)
+{
+    return _mm512_insertf32x8(_mm512_castps256_ps512(_mm512_cvtpd_ps(_mm512_loadu_pd(mem))),
+                              _mm512_cvtpd_ps(_mm512_loadu_pd(mem + 8)), 1);
+}
+
+// index vectors for gathers and scatters {{{1
+// An integral SIMD vector with 32-bit entries (or smaller, which convertIndexVector
+// already promoted) can be used as index operand of the AVX512F gathers and scatters.
+template <class T, class IT>
+struct is_avx512_index
+    : public std::integral_constant<
+          bool, Traits::is_simd_vector<IT>::value &&
+                    std::is_integral<Traits::entry_type_of<IT>>::value &&
+                    sizeof(Traits::entry_type_of<IT>) <= 4 &&
+                    (Traits::simd_vector_size<IT>::value >= 64 / sizeof(T))> {
+};
+
+template <class IT> Vc_INTRINSIC __m512i avx512_index(const IT &i, std::integral_constant<std::size_t, 16>)
+{
+    alignas(64) int tmp[16];
+    Common::unrolled_loop<std::size_t, 0, 16>([&](std::size_t j) { tmp[j] = i[j]; });
+    return _mm512_load_si512(tmp);
+}
+template <class IT> Vc_INTRINSIC __m256i avx512_index(const IT &i, std::integral_constant<std::size_t, 8>)
+{
+    alignas(32) int tmp[8];
+    Common::unrolled_loop<std::size_t, 0, 8>([&](std::size_t j) { tmp[j] = i[j]; });
+    return _mm256_load_si256(reinterpret_cast<const __m256i *>(tmp));
+}
+template <class U>
+Vc_INTRINSIC __m512i avx512_index(const AVX512::Vector<U> &i, std::integral_constant<std::size_t, 16>)
+{
+    return i.data();
+}
+template <class U>
+Vc_INTRINSIC __m256i avx512_index(const AVX512::Vector<U> &i, std::integral_constant<std::size_t, 8>)
+{
+    return _mm512_castsi512_si256(i.data());
+}
+template <class U>
+Vc_INTRINSIC __m256i avx512_index(const AVX2::Vector<U> &i, std::integral_constant<std::size_t, 8>)
+{
+    return i.data();
+}
+Vc_INTRINSIC __m512i avx512_scale_index(__m512i idx, int scale)
+{
+    return _mm512_mullo_epi32(idx, _mm512_set1_epi32(scale));
+}
+Vc_INTRINSIC __m256i avx512_scale_index(__m256i idx, int scale)
+{
+    return _mm256_mullo_epi32(idx, _mm256_set1_epi32(scale));
+}
+// }}}1
+}  // namespace Detail
+
+// special value constructors{{{1
+template <typename T>
+Vc_INTRINSIC Vector<T, VectorAbi::Avx512>::Vector(VectorSpecialInitializerZero)
+    : m_data(Detail::avx512_zero<VectorType>())
+{
+}
+template <typename T>
+Vc_INTRINSIC Vector<T, VectorAbi::Avx512>::Vector(VectorSpecialInitializerOne)
+    : m_data(Detail::avx512_broadcast(T(1)))
+{
+}
+template <typename T>
+Vc_INTRINSIC Vector<T, VectorAbi::Avx512>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : m_data(generate([](std::size_t i) { return T(i); }).data())
+{
+}
+
+// load member functions{{{1
+template <typename T>
+template <typename U, typename Flags>
+Vc_INTRINSIC typename Vector<T, VectorAbi::Avx512>::
+#ifndef Vc_MSVC
+template
+#endif
+load_concept<U, Flags>::type Vector<T, VectorAbi::Avx512>::load(const U *mem, Flags flags)
+{
+    Common::handleLoadPrefetches(mem, flags);
+    m_data = Detail::avx512_load(mem, flags, T());
+}
+
+template <typename T>
+Vc_INTRINSIC int Vector<T, VectorAbi::Avx512>::expand_load(const EntryType *mem, Mask mask)
+{
+    m_data = Detail::expand_load64(m_data, mem, mask.data());
+    return mask.count();
+}
+
+// store member functions{{{1
+template <typename T>
+template <typename U, typename Flags, typename>
+Vc_INTRINSIC void Vector<T, VectorAbi::Avx512>::store(U *mem, Flags flags) const
+{
+    Common::handleStorePrefetches(mem, flags);
+    if (std::is_same<T, U>::value ||
+        (std::is_integral<U>::value && sizeof(U) == sizeof(T))) {
+        Detail::store64(m_data, mem, flags);
+    } else {
+        Common::unrolled_loop<std::size_t, 0, Size>(
+            [&](std::size_t i) { mem[i] = static_cast<U>(get(*this, i)); });
+    }
+}
+
+template <typename T>
+template <typename U, typename Flags, typename>
+Vc_INTRINSIC void Vector<T, VectorAbi::Avx512>::store(U *mem, Mask mask, Flags flags) const
+{
+    Common::handleStorePrefetches(mem, flags);
+    if (std::is_same<T, U>::value ||
+        (std::is_integral<U>::value && sizeof(U) == sizeof(T))) {
+        Detail::store64(m_data, mem, mask.data());
+    } else {
+        for (size_t i : where(mask)) {
+            mem[i] = static_cast<U>(get(*this, i));
+        }
+    }
+}
+
+template <typename T>
+Vc_INTRINSIC int Vector<T, VectorAbi::Avx512>::compress_store(EntryType *mem, Mask mask) const
+{
+    Detail::compress_store64(m_data, mem, mask.data());
+    return mask.count();
+}
+
+// setQnan {{{1
+template <typename T> Vc_INTRINSIC void Vector<T, VectorAbi::Avx512>::setQnan()
+{
+    m_data = Detail::avx512_allone<VectorType>();
+}
+template <typename T>
+Vc_INTRINSIC void Vector<T, VectorAbi::Avx512>::setQnan(MaskArgument k)
+{
+    m_data = Detail::blend(m_data, Detail::avx512_allone<VectorType>(), k.data());
+}
+
+// operator- {{{1
+template <typename T>
+Vc_ALWAYS_INLINE Vc_PURE AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::operator-() const
+{
+    return std::is_integral<T>::value
+               ? Detail::sub(Detail::avx512_zero<VectorType>(), m_data, T())
+               : Detail::xor_(m_data, Detail::avx512_broadcast(T(-0.)));
+}
+
+// integer shifts {{{1
+// int shifts in the sign bit, uint shifts in zeros
+Vc_INTRINSIC __m512i avx512_srav(__m512i a, __m512i n, int) { return _mm512_srav_epi32(a, n); }
+Vc_INTRINSIC __m512i avx512_srav(__m512i a, __m512i n, uint) { return _mm512_srlv_epi32(a, n); }
+
+template <typename T>
+Vc_ALWAYS_INLINE AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::operator<<(AsArg x) const
+{
+    static_assert(std::is_integral<T>::value,
+                  "bitwise-operators can only be used with Vectors of integral type");
+    return _mm512_sllv_epi32(m_data, x.m_data);
+}
+template <typename T>
+Vc_ALWAYS_INLINE AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::operator>>(AsArg x) const
+{
+    static_assert(std::is_integral<T>::value,
+                  "bitwise-operators can only be used with Vectors of integral type");
+    return avx512_srav(m_data, x.m_data, T());
+}
+template <typename T>
+Vc_ALWAYS_INLINE AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::operator<<(int x) const
+{
+    return operator<<(Vector(x));
+}
+template <typename T>
+Vc_ALWAYS_INLINE AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::operator>>(int x) const
+{
+    return operator>>(Vector(x));
+}
+template <typename T>
+Vc_ALWAYS_INLINE AVX512::Vector<T> &Vector<T, VectorAbi::Avx512>::operator<<=(AsArg x)
+{
+    return *this = operator<<(x);
+}
+template <typename T>
+Vc_ALWAYS_INLINE AVX512::Vector<T> &Vector<T, VectorAbi::Avx512>::operator>>=(AsArg x)
+{
+    return *this = operator>>(x);
+}
+template <typename T>
+Vc_ALWAYS_INLINE AVX512::Vector<T> &Vector<T, VectorAbi::Avx512>::operator<<=(int x)
+{
+    return *this = operator<<(x);
+}
+template <typename T>
+Vc_ALWAYS_INLINE AVX512::Vector<T> &Vector<T, VectorAbi::Avx512>::operator>>=(int x)
+{
+    return *this = operator>>(x);
+}
+
+// isnegative {{{1
+// vpmovd2m / vpmovq2m copy the sign bits, thus -0 is negative
+Vc_INTRINSIC Vc_CONST AVX512::float_m isnegative(AVX512::float_v x)
+{
+    return AVX512::float_m(_mm512_movepi32_mask(_mm512_castps_si512(x.data())));
+}
+Vc_INTRINSIC Vc_CONST AVX512::double_m isnegative(AVX512::double_v x)
+{
+    return AVX512::double_m(_mm512_movepi64_mask(_mm512_castpd_si512(x.data())));
+}
+
+// gathers {{{1
+// Non-converting gathers with an integral SIMD index vector use vgatherdp{s,d} /
+// vpgatherdd. Everything else (converting gathers, std::vector or SuccessiveEntries
+// indexes) loads the entries one by one.
+namespace Detail
+{
+template <class T, class MT, class IT, int Scale>
+Vc_INTRINSIC void avx512_gather(AVX512::Vector<T> &v,
+                                const Common::GatherArguments<MT, IT, Scale> &args,
+                                std::true_type)
+{
+    auto idx = avx512_index(args.indexes, std::integral_constant<std::size_t, AVX512::Vector<T>::Size>());
+    if (Scale != 1) {
+        idx = avx512_scale_index(idx, Scale);
+    }
+    v = gather<sizeof(T)>(args.address, idx);
+}
+template <class T, class MT, class IT, int Scale>
+Vc_INTRINSIC void avx512_gather(AVX512::Vector<T> &v,
+                                const Common::GatherArguments<MT, IT, Scale> &args,
+                                std::false_type)
+{
+    Common::unrolled_loop<std::size_t, 0, AVX512::Vector<T>::Size>([&](std::size_t i) {
+        v[i] = static_cast<T>(args.address[Scale * args.indexes[i]]);
+    });
+}
+template <class T, class MT, class IT, int Scale>
+Vc_INTRINSIC void avx512_gather(AVX512::Vector<T> &v,
+                                const Common::GatherArguments<MT, IT, Scale> &args,
+                                AVX512::Mask<T> k, std::true_type)
+{
+    auto idx = avx512_index(args.indexes, std::integral_constant<std::size_t, AVX512::Vector<T>::Size>());
+    if (Scale != 1) {
+        idx = avx512_scale_index(idx, Scale);
+    }
+    v = gather<sizeof(T)>(v.data(), k.data(), args.address, idx);
+}
+template <class T, class MT, class IT, int Scale>
+Vc_INTRINSIC void avx512_gather(AVX512::Vector<T> &v,
+                                const Common::GatherArguments<MT, IT, Scale> &args,
+                                AVX512::Mask<T> k, std::false_type)
+{
+    for (size_t i : where(k)) {
+        v[i] = static_cast<T>(args.address[Scale * args.indexes[i]]);
+    }
+}
+
+template <class T, class MT, class IT>
+Vc_INTRINSIC void avx512_scatter(const AVX512::Vector<T> &v, MT *mem, const IT &indexes,
+                                 AVX512::Mask<T> k, std::true_type)
+{
+    scatter(mem, avx512_index(indexes, std::integral_constant<std::size_t, AVX512::Vector<T>::Size>()),
+            v.data(), k.data());
+}
+template <class T, class MT, class IT>
+Vc_INTRINSIC void avx512_scatter(const AVX512::Vector<T> &v, MT *mem, const IT &indexes,
+                                 AVX512::Mask<T> k, std::false_type)
+{
+    for (size_t i : where(k)) {
+        mem[indexes[i]] = v[i];
+    }
+}
+
+template <class T, class MT, class IT>
+using avx512_native_gather =
+    std::integral_constant<bool, std::is_same<MT, T>::value &&
+                                     is_avx512_index<T, Traits::decay<IT>>::value>;
+}  // namespace Detail
+
+template <typename T>
+template <class MT, class IT, int Scale>
+inline void Vector<T, VectorAbi::Avx512>::gatherImplementation(
+    const Common::GatherArguments<MT, IT, Scale> &args)
+{
+    Detail::avx512_gather(*this, args, Detail::avx512_native_gather<T, MT, IT>());
+}
+
+template <typename T>
+template <class MT, class IT, int Scale>
+inline void Vector<T, VectorAbi::Avx512>::gatherImplementation(
+    const Common::GatherArguments<MT, IT, Scale> &args, MaskArgument mask)
+{
+    Detail::avx512_gather(*this, args, mask, Detail::avx512_native_gather<T, MT, IT>());
+}
+
+// scatters {{{1
+template <typename T>
+template <typename MT, typename IT>
+inline void Vector<T, VectorAbi::Avx512>::scatterImplementation(MT *mem, IT &&indexes) const
+{
+    Detail::avx512_scatter(*this, mem, indexes, Mask::One(),
+                           Detail::avx512_native_gather<T, MT, IT>());
+}
+
+template <typename T>
+template <typename MT, typename IT>
+inline void Vector<T, VectorAbi::Avx512>::scatterImplementation(MT *mem, IT &&indexes,
+                                                                MaskArgument mask) const
+{
+    Detail::avx512_scatter(*this, mem, indexes, mask,
+                           Detail::avx512_native_gather<T, MT, IT>());
+}
+
+// partialSum {{{1
+template <typename T>
+Vc_ALWAYS_INLINE AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::partialSum() const
+{
+    //   a    b    c    d    e    f    g    h ...
+    // +      a    b    c    d    e    f    g ...    -> a   ab   bc   cd   de ...
+    // +           a   ab   bc   cd   de   ef ...    -> a   ab  abc abcd bcde ...
+    // +                     a   ab  abc abcd ...    -> a   ab  abc abcd abcde ...
+    Vector r = *this;
+    for (int shift = 1; shift < int(Size); shift *= 2) {
+        r += r.shifted(-shift);
+    }
+    return r;
+}
+
+// shifted / rotated / reversed {{{1
+// The permute instructions only look at the low log2(Size) (permutexvar) or
+// log2(2 * Size) (permutex2var) bits of each index, which implements the wrap-around.
+// Indexes outside of the shifted-in range are zeroed via the permute's zero-mask.
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::shifted(int amount) const
+{
+    const __m512i idx = Detail::avx512_lane_index(amount, EntrySize());
+    return Detail::permute(m_data, idx, Detail::avx512_index_in_range(idx, EntrySize()));
+}
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::shifted(int amount,
+                                                                     Vector shiftIn) const
+{
+    const __m512i idx = Detail::avx512_lane_index(amount, EntrySize());
+    return Detail::permute2(m_data, shiftIn.m_data, idx,
+                            Detail::avx512_index_in_range2(idx, EntrySize()));
+}
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::rotated(int amount) const
+{
+    return Detail::permute(m_data, Detail::avx512_lane_index(amount, EntrySize()));
+}
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::reversed() const
+{
+    return Detail::permute(m_data, Detail::avx512_reversed_index(EntrySize()));
+}
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::operator[](
+    const IndexType &perm) const
+{
+    const __m512i idx =
+        sizeof(T) == 4
+            ? Detail::avx512_index(perm, std::integral_constant<std::size_t, 16>())
+            : _mm512_cvtepi32_epi64(
+                  Detail::avx512_index(perm, std::integral_constant<std::size_t, 8>()));
+    return Detail::permute(m_data, idx);
+}
+
+// sorted {{{1
+template <typename T>
+Vc_ALWAYS_INLINE AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::sorted() const
+{
+    alignas(64) T tmp[Size];
+    store(tmp, Vc::Aligned);
+    std::sort(tmp, tmp + Size);
+    return Vector(tmp, Vc::Aligned);
+}
+
+// interleaveLow/-High {{{1
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::interleaveLow(Vector x) const
+{
+    // {0, Size, 1, Size + 1, ...}
+    const __m512i idx =
+        sizeof(T) == 4
+            ? _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23)
+            : _mm512_set_epi64(11, 3, 10, 2, 9, 1, 8, 0);
+    return Detail::permute2(m_data, x.m_data, idx);
+}
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::interleaveHigh(Vector x) const
+{
+    // {Size / 2, Size + Size / 2, Size / 2 + 1, ...}
+    const __m512i idx =
+        sizeof(T) == 4
+            ? _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31)
+            : _mm512_set_epi64(15, 7, 14, 6, 13, 5, 12, 4);
+    return Detail::permute2(m_data, x.m_data, idx);
+}
+
+// Random {{{1
+// Two steps of the AVX2 generator fill the 512 bits.
+template <> Vc_ALWAYS_INLINE AVX512::float_v AVX512::float_v::Random()
+{
+    const __m256 lo = AVX2::float_v::Random().data();
+    return _mm512_insertf32x8(_mm512_castps256_ps512(lo), AVX2::float_v::Random().data(), 1);
+}
+template <> Vc_ALWAYS_INLINE AVX512::double_v AVX512::double_v::Random()
+{
+    const __m256d lo = AVX2::double_v::Random().data();
+    return _mm512_insertf64x4(_mm512_castpd256_pd512(lo), AVX2::double_v::Random().data(), 1);
+}
+template <> Vc_ALWAYS_INLINE AVX512::int_v AVX512::int_v::Random()
+{
+    const __m256i lo = AVX2::int_v::Random().data();
+    return _mm512_inserti32x8(_mm512_castsi256_si512(lo), AVX2::int_v::Random().data(), 1);
+}
+template <> Vc_ALWAYS_INLINE AVX512::uint_v AVX512::uint_v::Random()
+{
+    const __m256i lo = AVX2::uint_v::Random().data();
+    return _mm512_inserti32x8(_mm512_castsi256_si512(lo), AVX2::uint_v::Random().data(), 1);
+}
+// }}}1
+}  // namespace Vc
+
+// vim: foldmethod=marker
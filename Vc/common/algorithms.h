@@ -28,7 +28,16 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef VC_COMMON_ALGORITHMS_H_
 #define VC_COMMON_ALGORITHMS_H_
 
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
 #include "simdize.h"
+#include "threadpool.h"
+#include "../Allocator"
 
 namespace Vc_VERSIONED_NAMESPACE
 {
@@ -161,6 +170,1767 @@ simd_for_each_n(InputIt first, std::size_t count, UnaryFunction f)
     return f;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// streaming stores {{{1
+namespace Detail
+{
+// Defined in the library, so that all translation units share one threshold regardless
+// of the implementation they are compiled for.
+std::size_t &streaming_store_threshold_storage();
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Returns the number of bytes of output from which simd_copy, simd_fill, and
+ * simd_transform use non-temporal (Vc::Streaming) stores, which bypass the caches.
+ *
+ * The default is half the size of the last level data cache reported by CpuId. If the
+ * library was built for a target without non-temporal stores it is the maximum of \c
+ * std::size_t.
+ */
+inline std::size_t streaming_store_threshold()
+{
+    return Detail::streaming_store_threshold_storage();
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Sets the threshold returned by streaming_store_threshold for all threads. Not
+ * thread-safe with respect to concurrently running algorithms. On targets without
+ * non-temporal stores the algorithms ignore it.
+ */
+inline void set_streaming_store_threshold(std::size_t bytes)
+{
+    Detail::streaming_store_threshold_storage() = bytes;
+}
+
+namespace Detail
+{
+// Returns the number of elements from mem to the next address that is aligned for V.
+template <class V, class T> Vc_INTRINSIC std::size_t simd_head_size(const T *mem)
+{
+    const std::size_t misalignment =
+        reinterpret_cast<std::uintptr_t>(mem) % V::MemoryAlignment;
+    return misalignment == 0 ? 0 : (V::MemoryAlignment - misalignment) / sizeof(T);
+}
+
+// Orders the preceding non-temporal stores before all following stores.
+Vc_INTRINSIC void streaming_store_fence()
+{
+#ifdef Vc_IMPL_SSE
+    _mm_sfence();
+#endif
+}
+
+// Writes the n elements starting at out: the head up to the first address that is
+// aligned for V and the tail with store_interleaved of scalar(i), the aligned vectors in
+// between with non-temporal stores of vector(i).
+template <class V, class T, class VectorAt, class ScalarAt>
+inline void simd_streaming_write(T *out, std::size_t n, VectorAt &&vector,
+                                 ScalarAt &&scalar)
+{
+    std::size_t i = 0;
+    for (const std::size_t head = std::min(n, simd_head_size<V>(out)); i < head; ++i) {
+        store_interleaved(scalar(i), out + i);
+    }
+    for (; i + V::Size <= n; i += V::Size) {
+        vector(i).store(out + i, Vc::Streaming | Vc::Aligned);
+    }
+    streaming_store_fence();
+    for (; i < n; ++i) {
+        store_interleaved(scalar(i), out + i);
+    }
+}
+
+#ifdef Vc_IMPL_SSE
+constexpr bool has_streaming_stores = true;
+#else
+constexpr bool has_streaming_stores = false;
+#endif
+
+template <class It, class C>
+using is_iterator_of =
+    std::integral_constant<bool, std::is_same<It, typename C::iterator>::value ||
+                                     std::is_same<It, typename C::const_iterator>::value>;
+
+// Whether It is known to address contiguous elements: pointers and the iterators of
+// std::vector with the standard or the Vc allocator. C++14 has no category for
+// contiguous iterators; e.g. std::deque iterators are random access as well.
+template <class It, class T = typename std::iterator_traits<It>::value_type,
+          bool = std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>
+struct is_contiguous_iterator : std::is_pointer<It> {};
+template <class It, class T>
+struct is_contiguous_iterator<It, T, true>
+    : std::integral_constant<
+          bool, std::is_pointer<It>::value || is_iterator_of<It, std::vector<T>>::value ||
+                    is_iterator_of<It, std::vector<T, Allocator<T>>>::value> {};
+
+// Whether simd_copy and simd_fill from/to iterators of these types may use
+// simd_streaming_write.
+template <class OutputIt, class T = typename std::iterator_traits<OutputIt>::value_type>
+using is_streamable_output =
+    std::integral_constant<bool, has_streaming_stores && std::is_arithmetic<T>::value &&
+                                     is_simd_vector<simdize<T>>::value &&
+                                     is_contiguous_iterator<OutputIt>::value>;
+
+template <class OutputIt, class Distance>
+inline bool use_streaming_stores(Distance n, std::true_type)
+{
+    using T = typename std::iterator_traits<OutputIt>::value_type;
+    return n > 0 && std::size_t(n) >= streaming_store_threshold() / sizeof(T);
+}
+template <class OutputIt, class Distance>
+inline bool use_streaming_stores(Distance, std::false_type)
+{
+    return false;
+}
+}  // namespace Detail
+
+// simd_copy {{{1
+namespace Detail
+{
+template <class InputIt, class OutputIt>
+inline OutputIt simd_copy_streaming(InputIt first, InputIt last, OutputIt d_first,
+                                    std::true_type)
+{
+    using T = typename std::iterator_traits<OutputIt>::value_type;
+    using V = simdize<T>;
+    const T *in = std::addressof(*first);
+    const auto n = last - first;
+    simd_streaming_write<V>(std::addressof(*d_first), n,
+                            [&](std::size_t i) { return V(in + i, Vc::Unaligned); },
+                            [&](std::size_t i) { return simdize<T, 1>(in[i]); });
+    return d_first + n;
+}
+template <class InputIt, class OutputIt>
+inline OutputIt simd_copy_streaming(InputIt first, InputIt last, OutputIt d_first,
+                                    std::false_type)
+{
+    return std::copy(first, last, d_first);
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::copy` algorithm for non-overlapping ranges.
+ *
+ * If the output is at least streaming_store_threshold() bytes, contiguous, and of
+ * arithmetic type, it is written with non-temporal stores followed by a store fence.
+ * These do not evict the working set from the caches. Otherwise std::copy is used.
+ *
+ * \return Iterator one past the last element written.
+ */
+template <class InputIt, class OutputIt>
+inline OutputIt simd_copy(InputIt first, InputIt last, OutputIt d_first)
+{
+    using streamable = std::integral_constant<
+        bool, Detail::is_streamable_output<OutputIt>::value &&
+                  Detail::is_streamable_output<InputIt>::value &&
+                  std::is_same<typename std::iterator_traits<OutputIt>::value_type,
+                               typename std::iterator_traits<InputIt>::value_type>::value>;
+    if (Detail::use_streaming_stores<OutputIt>(std::distance(first, last), streamable())) {
+        return Detail::simd_copy_streaming(first, last, d_first, streamable());
+    }
+    return std::copy(first, last, d_first);
+}
+
+// simd_fill {{{1
+namespace Detail
+{
+template <class ForwardIt, class T>
+inline void simd_fill_streaming(ForwardIt first, ForwardIt last, const T &value,
+                                std::true_type)
+{
+    using U = typename std::iterator_traits<ForwardIt>::value_type;
+    using V = simdize<U>;
+    const V v = U(value);
+    const simdize<U, 1> v1 = U(value);
+    simd_streaming_write<V>(std::addressof(*first), last - first,
+                            [&](std::size_t) { return v; },
+                            [&](std::size_t) { return v1; });
+}
+template <class ForwardIt, class T>
+inline void simd_fill_streaming(ForwardIt first, ForwardIt last, const T &value,
+                                std::false_type)
+{
+    std::fill(first, last, value);
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::fill` algorithm.
+ *
+ * If the range is at least streaming_store_threshold() bytes, contiguous, and of
+ * arithmetic type, it is written with non-temporal stores followed by a store fence.
+ * Otherwise std::fill is used.
+ */
+template <class ForwardIt, class T>
+inline void simd_fill(ForwardIt first, ForwardIt last, const T &value)
+{
+    using streamable = Detail::is_streamable_output<ForwardIt>;
+    if (Detail::use_streaming_stores<ForwardIt>(std::distance(first, last), streamable())) {
+        Detail::simd_fill_streaming(first, last, value, streamable());
+    } else {
+        std::fill(first, last, value);
+    }
+}
+
+// simd_transform {{{1
+namespace Detail
+{
+template <class InputIt, class OutputIt, class UnaryOperation,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline OutputIt simd_transform_cached(InputIt first, InputIt last, OutputIt d_first,
+                                      UnaryOperation op)
+{
+    typedef simdize<ValueType> V;
+    typedef simdize<ValueType, 1> V1;
+    for (; last - first >= int(V::Size); first += V::Size, d_first += V::Size) {
+        V tmp;
+        load_interleaved(tmp, std::addressof(*first));
+        store_interleaved(op(tmp), std::addressof(*d_first));
+    }
+    for (; first != last; ++first, ++d_first) {
+        V1 tmp;
+        load_interleaved(tmp, std::addressof(*first));
+        store_interleaved(op(tmp), std::addressof(*d_first));
+    }
+    return d_first;
+}
+
+// Whether op transforms simdize<ValueType> into a Vc::Vector of the output type, so that
+// simd_transform may write its results with simd_streaming_write.
+template <class OutputIt, class UnaryOperation, class ValueType,
+          class R = decltype(std::declval<UnaryOperation &>()(
+              std::declval<simdize<ValueType>>()))>
+using is_streamable_transform = std::integral_constant<
+    bool, is_streamable_output<OutputIt>::value && std::is_arithmetic<ValueType>::value &&
+              std::is_same<typename std::decay<R>::type,
+                           simdize<typename std::iterator_traits<OutputIt>::value_type>>::value>;
+
+template <class InputIt, class OutputIt, class UnaryOperation, class ValueType>
+inline OutputIt simd_transform_streaming(InputIt first, InputIt last, OutputIt d_first,
+                                         UnaryOperation &op, std::true_type)
+{
+    using V = simdize<ValueType>;
+    const ValueType *in = std::addressof(*first);
+    const auto n = last - first;
+    Detail::simd_streaming_write<V>(
+        std::addressof(*d_first), n,
+        [&](std::size_t i) { return op(V(in + i, Vc::Unaligned)); },
+        [&](std::size_t i) { return op(simdize<ValueType, 1>(in[i])); });
+    return d_first + n;
+}
+template <class InputIt, class OutputIt, class UnaryOperation, class ValueType>
+inline OutputIt simd_transform_streaming(InputIt first, InputIt last, OutputIt d_first,
+                                         UnaryOperation &op, std::false_type)
+{
+    return simd_transform_cached(first, last, d_first, op);
+}
+
+// Transforms with streaming stores iff streaming is true and op allows it.
+template <class InputIt, class OutputIt, class UnaryOperation,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline OutputIt simd_transform_impl(InputIt first, InputIt last, OutputIt d_first,
+                                    UnaryOperation &op, bool streaming)
+{
+    if (streaming) {
+        return simd_transform_streaming<InputIt, OutputIt, UnaryOperation, ValueType>(
+            first, last, d_first, op,
+            is_streamable_transform<OutputIt, UnaryOperation, ValueType>());
+    }
+    return simd_transform_cached(first, last, d_first, op);
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::transform` algorithm.
+ *
+ * Calls \p op with `Vc::Vector<` *iterator value type* `, ` *unspecified* `>` objects
+ * loaded from [\p first, \p last) and stores the returned vectors to the range starting
+ * at \p d_first. As with simd_for_each, the remainder that does not fill a complete
+ * vector is processed with vectors of size 1.
+ *
+ * If the output is at least streaming_store_threshold() bytes of arithmetic type and
+ * \p op returns vectors of that type, the output is written with non-temporal stores
+ * (see simd_copy).
+ *
+ * \return Iterator one past the last element written.
+ */
+template <class InputIt, class OutputIt, class UnaryOperation,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline OutputIt simd_transform(InputIt first, InputIt last, OutputIt d_first,
+                               UnaryOperation op)
+{
+    return Detail::simd_transform_impl(
+        first, last, d_first, op,
+        Detail::use_streaming_stores<OutputIt>(last - first,
+                                               Detail::is_streamable_output<OutputIt>()));
+}
+
+// simd_reduce {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Selects the summation algorithm of simd_reduce and simd_transform_reduce.
+ */
+enum class Summation {
+    /// Plain summation into several independent vector accumulators. Fastest.
+    Simple,
+    /**
+     * Recursive pairwise summation of blocks. The rounding error grows with the
+     * logarithm of the number of elements instead of linearly, at nearly the speed of
+     * Summation::Simple.
+     */
+    Pairwise,
+    /**
+     * Kahan compensated summation in every vector lane. The rounding error is
+     * independent of the number of elements. About half the speed of
+     * Summation::Simple. Requires that the compiler does not reassociate floating-point
+     * arithmetic (e.g. no \c -ffast-math).
+     */
+    Kahan
+};
+
+namespace Detail
+{
+struct simd_plus {
+    template <class T> Vc_INTRINSIC T operator()(const T &a, const T &b) const
+    {
+        return a + b;
+    }
+};
+
+struct simd_multiplies {
+    template <class T> Vc_INTRINSIC T operator()(const T &a, const T &b) const
+    {
+        return a * b;
+    }
+};
+
+struct simd_identity {
+    template <class T> Vc_INTRINSIC T operator()(const T &a) const { return a; }
+};
+
+// loaders for simd_reduce_nonempty {{{2
+// vector(i) returns the transformed vector of the elements at offset i, scalar(i) the
+// transformed vector of size 1 of the element at offset i
+template <class InputIt, class UnaryOperation> struct UnaryTransformLoad {
+    using ValueType = typename std::iterator_traits<InputIt>::value_type;
+    typedef simdize<ValueType> V;
+    typedef simdize<ValueType, 1> V1;
+
+    InputIt first;
+    UnaryOperation op;
+
+    Vc_INTRINSIC auto vector(std::size_t i) const -> decltype(op(std::declval<V>()))
+    {
+        V tmp;
+        load_interleaved(tmp, std::addressof(*(first + i)));
+        return op(tmp);
+    }
+    Vc_INTRINSIC auto scalar(std::size_t i) const -> decltype(op(std::declval<V1>()))
+    {
+        V1 tmp;
+        load_interleaved(tmp, std::addressof(*(first + i)));
+        return op(tmp);
+    }
+};
+
+template <class InputIt1, class InputIt2, class BinaryOperation>
+struct BinaryTransformLoad {
+    using ValueType = typename std::iterator_traits<InputIt1>::value_type;
+    using ValueType2 = typename std::iterator_traits<InputIt2>::value_type;
+    typedef simdize<ValueType> V;
+    typedef simdize<ValueType, 1> V1;
+    typedef simdize<ValueType2, V::Size> W;
+    typedef simdize<ValueType2, 1> W1;
+
+    InputIt1 first1;
+    InputIt2 first2;
+    BinaryOperation op;
+
+    Vc_INTRINSIC auto vector(std::size_t i) const
+        -> decltype(op(std::declval<V>(), std::declval<W>()))
+    {
+        V a;
+        W b;
+        load_interleaved(a, std::addressof(*(first1 + i)));
+        load_interleaved(b, std::addressof(*(first2 + i)));
+        return op(a, b);
+    }
+    Vc_INTRINSIC auto scalar(std::size_t i) const
+        -> decltype(op(std::declval<V1>(), std::declval<W1>()))
+    {
+        V1 a;
+        W1 b;
+        load_interleaved(a, std::addressof(*(first1 + i)));
+        load_interleaved(b, std::addressof(*(first2 + i)));
+        return op(a, b);
+    }
+};
+
+// simd_reduce_nonempty {{{2
+// Reduces the n > 0 loaded values with op. Four independent accumulators hide the
+// latency of op. The result is returned in lane 0 of a vector of size 1.
+template <class Load, class BinaryOperation>
+inline auto simd_reduce_nonempty(const Load &load, std::size_t n, BinaryOperation op)
+    -> decltype(load.scalar(0))
+{
+    constexpr std::size_t Size = Load::V::Size;
+    using R1 = decltype(load.scalar(0));
+    R1 result;
+    std::size_t i = 0;
+    if (n >= Size) {
+        auto acc0 = load.vector(0);
+        i = Size;
+        if (n >= 4 * Size) {
+            auto acc1 = load.vector(Size);
+            auto acc2 = load.vector(2 * Size);
+            auto acc3 = load.vector(3 * Size);
+            for (i = 4 * Size; i + 4 * Size <= n; i += 4 * Size) {
+                acc0 = op(acc0, load.vector(i));
+                acc1 = op(acc1, load.vector(i + Size));
+                acc2 = op(acc2, load.vector(i + 2 * Size));
+                acc3 = op(acc3, load.vector(i + 3 * Size));
+            }
+            acc0 = op(op(acc0, acc1), op(acc2, acc3));
+        }
+        for (; i + Size <= n; i += Size) {
+            acc0 = op(acc0, load.vector(i));
+        }
+        result = R1(acc0[0]);
+        for (std::size_t j = 1; j < Size; ++j) {
+            result = op(result, R1(acc0[j]));
+        }
+    } else {
+        result = load.scalar(0);
+        i = 1;
+    }
+    for (; i < n; ++i) {
+        result = op(result, load.scalar(i));
+    }
+    return result;
+}
+
+template <class InputIt, class BinaryOperation>
+inline simdize<typename std::iterator_traits<InputIt>::value_type, 1> simd_reduce_nonempty(
+    InputIt first, InputIt last, BinaryOperation op)
+{
+    return simd_reduce_nonempty(
+        UnaryTransformLoad<InputIt, simd_identity>{first, simd_identity()},
+        last - first, op);
+}
+
+// load_partial {{{2
+// Returns a vector with the n < V::Size values at mem in the low lanes and zeros in the
+// others. The masked gather does not touch the memory of the zeroed lanes.
+template <class V, class T> Vc_INTRINSIC V load_partial(const T *mem, std::size_t n)
+{
+    using IT = typename V::IndexType;
+    V r(0);
+    r.gather(mem, IT([](int i) { return i; }), V([](int i) { return i; }) < V(n));
+    return r;
+}
+
+// summation loaders {{{2
+// Whether elements of V accumulate into an initial value of type T in SIMD lanes, i.e.
+// whether the common type of T and the elements is a vector entry type.
+template <class V, class T>
+using is_simd_sum_type = Traits::is_valid_vector_argument<
+    typename std::common_type<typename V::EntryType, T>::type>;
+
+// The vector type that accumulates elements of V into an initial value of type T: V
+// itself, unless the common type of T and the elements is wider (e.g. short elements
+// with an int initial value), so that the lanes do not overflow.
+template <class V, class T,
+          class A = typename std::common_type<typename V::EntryType, T>::type>
+using simd_sum_vector =
+    typename std::conditional<std::is_same<A, typename V::EntryType>::value, V,
+                              SimdArray<A, V::Size>>::type;
+
+// full(i) loads from an address that is aligned for V, partial(i, n) loads n elements.
+// Both return the elements converted to the accumulator type A.
+template <class V, class A = V> struct SumLoad {
+    using T = typename V::EntryType;
+    const T *mem;
+    Vc_INTRINSIC A full(std::size_t i) const
+    {
+        return simd_cast<A>(V(mem + i, Vc::Aligned));
+    }
+    Vc_INTRINSIC A partial(std::size_t i, std::size_t n) const
+    {
+        return simd_cast<A>(load_partial<V>(mem + i, n));
+    }
+};
+
+template <class V, class A = V> struct DotLoad {
+    using T = typename V::EntryType;
+    const T *a;
+    const T *b;
+    Vc_INTRINSIC A full(std::size_t i) const
+    {
+        return simd_cast<A>(V(a + i, Vc::Aligned)) *
+               simd_cast<A>(V(b + i, Vc::Unaligned));
+    }
+    Vc_INTRINSIC A partial(std::size_t i, std::size_t n) const
+    {
+        return simd_cast<A>(load_partial<V>(a + i, n)) *
+               simd_cast<A>(load_partial<V>(b + i, n));
+    }
+};
+
+// accumulators {{{2
+template <class V> struct SimpleAccumulator {
+    using T = typename V::EntryType;
+    V acc[4] = {V(0), V(0), V(0), V(0)};
+    Vc_INTRINSIC void add(int k, const V &x) { acc[k] += x; }
+    Vc_INTRINSIC V vector() const { return (acc[0] + acc[1]) + (acc[2] + acc[3]); }
+    Vc_INTRINSIC T total() const { return vector().sum(); }
+};
+
+template <class V> struct KahanAccumulator {
+    using T = typename V::EntryType;
+    V sum[4] = {V(0), V(0), V(0), V(0)};
+    V c[4] = {V(0), V(0), V(0), V(0)};
+    Vc_INTRINSIC void add(int k, const V &x)
+    {
+        const V y = x - c[k];
+        const V t = sum[k] + y;
+        c[k] = (t - sum[k]) - y;
+        sum[k] = t;
+    }
+    T total() const
+    {
+        T s = 0, comp = 0;
+        auto addScalar = [&](T x) {
+            const T y = x - comp;
+            const T t = s + y;
+            comp = (t - s) - y;
+            s = t;
+        };
+        for (int k = 0; k < 4; ++k) {
+            for (std::size_t i = 0; i < V::Size; ++i) {
+                addScalar(sum[k][i]);
+                addScalar(-c[k][i]);
+            }
+        }
+        return s;
+    }
+};
+
+// simd_sum {{{2
+// Adds the n values of load, starting at an offset that is aligned for V, to acc.
+template <class V, class Load, class Acc>
+Vc_INTRINSIC void simd_sum_aligned(const Load &load, std::size_t i, std::size_t n,
+                                   Acc &acc)
+{
+    constexpr std::size_t Size = V::Size;
+    const std::size_t end = i + n;
+    for (; i + 4 * Size <= end; i += 4 * Size) {
+        acc.add(0, load.full(i));
+        acc.add(1, load.full(i + Size));
+        acc.add(2, load.full(i + 2 * Size));
+        acc.add(3, load.full(i + 3 * Size));
+    }
+    for (; i + Size <= end; i += Size) {
+        acc.add(0, load.full(i));
+    }
+    if (i < end) {
+        acc.add(1, load.partial(i, end - i));
+    }
+}
+
+/// Number of registers summed with Summation::Simple at the leaves of the pairwise tree.
+constexpr std::size_t simd_pairwise_block_registers = 32;
+
+template <class V, class Load>
+V simd_sum_pairwise(const Load &load, std::size_t i, std::size_t n)
+{
+    constexpr std::size_t block = V::Size * simd_pairwise_block_registers;
+    if (n <= block) {
+        SimpleAccumulator<V> acc;
+        simd_sum_aligned<V>(load, i, n, acc);
+        return acc.vector();
+    }
+    const std::size_t half = n / 2 / V::Size * V::Size;
+    return simd_sum_pairwise<V>(load, i, half) +
+           simd_sum_pairwise<V>(load, i + half, n - half);
+}
+
+// Returns the sum of the n values of load. The first head values are loaded with a
+// partial load so that all following loads are aligned.
+template <class V, class Load>
+typename V::EntryType simd_sum(const Load &load, std::size_t head, std::size_t n,
+                               Summation summation)
+{
+    head = std::min(head, n);
+    switch (summation) {
+    case Summation::Kahan: {
+        KahanAccumulator<V> acc;
+        if (head > 0) {
+            acc.add(3, load.partial(0, head));
+        }
+        simd_sum_aligned<V>(load, head, n - head, acc);
+        return acc.total();
+    }
+    case Summation::Pairwise: {
+        V sum = simd_sum_pairwise<V>(load, head, n - head);
+        if (head > 0) {
+            sum += load.partial(0, head);
+        }
+        return sum.sum();
+    }
+    case Summation::Simple:
+    default: {
+        SimpleAccumulator<V> acc;
+        if (head > 0) {
+            acc.add(3, load.partial(0, head));
+        }
+        simd_sum_aligned<V>(load, head, n - head, acc);
+        return acc.total();
+    }
+    }
+}
+
+// Returns init plus the sum of the n elements at mem, or plus their inner product with
+// the elements at b. If the common type of T and the elements is no vector entry type
+// (e.g. short elements and a long init), the scalar algorithms accumulate in T instead.
+template <class V, class T>
+inline T simd_sum_into(const typename V::EntryType *mem, std::size_t n, T init,
+                       Summation summation, std::true_type)
+{
+    using A = simd_sum_vector<V, T>;
+    return init + simd_sum<A>(SumLoad<V, A>{mem}, simd_head_size<V>(mem), n, summation);
+}
+template <class V, class T>
+inline T simd_sum_into(const typename V::EntryType *mem, std::size_t n, T init, Summation,
+                       std::false_type)
+{
+    return std::accumulate(mem, mem + n, init);
+}
+template <class V, class T>
+inline T simd_dot_into(const typename V::EntryType *a, const typename V::EntryType *b,
+                       std::size_t n, T init, Summation summation, std::true_type)
+{
+    using A = simd_sum_vector<V, T>;
+    return init + simd_sum<A>(DotLoad<V, A>{a, b}, simd_head_size<V>(a), n, summation);
+}
+template <class V, class T>
+inline T simd_dot_into(const typename V::EntryType *a, const typename V::EntryType *b,
+                       std::size_t n, T init, Summation, std::false_type)
+{
+    return std::inner_product(a, a + n, b, init);
+}
+
+//}}}2
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::reduce` algorithm.
+ *
+ * Combines \p init and all elements of [\p first, \p last) with \p op, which is called
+ * with two `Vc::Vector` objects of equal type. The elements are combined in unspecified
+ * order and grouping, thus \p op must be associative and commutative. Four independent
+ * vector accumulators are used, so that the latency of \p op is hidden.
+ */
+template <class InputIt, class T, class BinaryOperation>
+inline T simd_reduce(InputIt first, InputIt last, T init, BinaryOperation op)
+{
+    using V1 = simdize<T, 1>;
+    if (first == last) {
+        return init;
+    }
+    return op(V1(init), Detail::simd_reduce_nonempty(first, last, op))[0];
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Returns the sum of \p init and all elements of the contiguous range [\p first, \p
+ * last) of arithmetic values.
+ *
+ * The elements are accumulated in the common type of \p T and the element type. Thus
+ * an \c int \p init avoids the overflow of \c short lanes, while an \p init of the
+ * element type keeps the accumulators at the full vector width. If the common type is
+ * no vector entry type (e.g. \c long), the sum is computed with \c std::accumulate.
+ *
+ * The elements before the first vector-aligned address and after the last complete
+ * vector are loaded with masked loads, all other loads are aligned.
+ *
+ * \param first Iterator to the first element.
+ * \param last Iterator one past the last element.
+ * \param init The initial value of the sum.
+ * \param summation The summation algorithm, see Vc::Summation.
+ */
+template <class InputIt, class T,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline enable_if<std::is_arithmetic<ValueType>::value, T> simd_reduce(
+    InputIt first, InputIt last, T init, Summation summation = Summation::Simple)
+{
+    using V = Vector<ValueType>;
+    if (first == last) {
+        return init;
+    }
+    return Detail::simd_sum_into<V>(std::addressof(*first), last - first, init, summation,
+                                    Detail::is_simd_sum_type<V, T>());
+}
+
+// simd_transform_reduce {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Returns \p init plus the inner product of the contiguous arithmetic ranges [\p first1,
+ * \p last1) and [\p first2, \p first2 + (\p last1 - \p first1)).
+ *
+ * The products and their sum are computed in the common type of \p T and the element
+ * type, and the loads of the first range are aligned, as for simd_reduce.
+ */
+template <class InputIt1, class InputIt2, class T,
+          class ValueType = typename std::iterator_traits<InputIt1>::value_type>
+inline enable_if<std::is_arithmetic<ValueType>::value, T> simd_transform_reduce(
+    InputIt1 first1, InputIt1 last1, InputIt2 first2, T init,
+    Summation summation = Summation::Simple)
+{
+    static_assert(
+        std::is_same<ValueType,
+                     typename std::iterator_traits<InputIt2>::value_type>::value,
+        "simd_transform_reduce requires ranges of equal value type");
+    using V = Vector<ValueType>;
+    if (first1 == last1) {
+        return init;
+    }
+    return Detail::simd_dot_into<V>(std::addressof(*first1), std::addressof(*first2),
+                                    last1 - first1, init, summation,
+                                    Detail::is_simd_sum_type<V, T>());
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the binary `std::transform_reduce` algorithm: combines \p init and
+ * the results of \p transform for every pair of elements with \p reduce.
+ *
+ * Both operations are called with `Vc::Vector` objects; the same requirements as for
+ * simd_reduce apply.
+ */
+template <class InputIt1, class InputIt2, class T, class BinaryReductionOp,
+          class BinaryTransformOp>
+inline T simd_transform_reduce(InputIt1 first1, InputIt1 last1, InputIt2 first2, T init,
+                               BinaryReductionOp reduce, BinaryTransformOp transform)
+{
+    using V1 = simdize<T, 1>;
+    if (first1 == last1) {
+        return init;
+    }
+    return reduce(V1(init),
+                  Detail::simd_reduce_nonempty(
+                      Detail::BinaryTransformLoad<InputIt1, InputIt2, BinaryTransformOp>{
+                          first1, first2, transform},
+                      last1 - first1, reduce))[0];
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the unary `std::transform_reduce` algorithm: combines \p init and the
+ * results of \p transform for every element with \p reduce.
+ *
+ * \code
+ * float norm = std::sqrt(Vc::simd_transform_reduce(
+ *     x.begin(), x.end(), 0.f, Vc::Detail::simd_plus(),
+ *     [](Vc::float_v v) { return v * v; }));
+ * \endcode
+ */
+template <class InputIt, class T, class BinaryReductionOp, class UnaryTransformOp>
+inline T simd_transform_reduce(InputIt first, InputIt last, T init,
+                               BinaryReductionOp reduce, UnaryTransformOp transform)
+{
+    using V1 = simdize<T, 1>;
+    if (first == last) {
+        return init;
+    }
+    return reduce(V1(init),
+                  Detail::simd_reduce_nonempty(
+                      Detail::UnaryTransformLoad<InputIt, UnaryTransformOp>{first,
+                                                                            transform},
+                      last - first, reduce))[0];
+}
+
+// simd_minmax_element {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::minmax_element` algorithm for contiguous ranges of
+ * arithmetic values.
+ *
+ * \return A pair of iterators to the first smallest and the last largest element, or
+ * (\p last, \p last) if the range is empty.
+ */
+template <class ForwardIt,
+          class ValueType = typename std::iterator_traits<ForwardIt>::value_type>
+inline enable_if<std::is_arithmetic<ValueType>::value, std::pair<ForwardIt, ForwardIt>>
+simd_minmax_element(ForwardIt first, ForwardIt last)
+{
+    using V = Vector<ValueType>;
+    using IV = fixed_size_simd<int, V::Size>;
+    using IM = typename IV::mask_type;
+    const std::size_t n = last - first;
+    if (n == 0) {
+        return {last, last};
+    }
+    const ValueType *mem = std::addressof(*first);
+    std::size_t minPos = 0, maxPos = 0, i = 0;
+    if (n >= V::Size) {
+        // every lane remembers the block in which its current minimum/maximum was found
+        V minV(mem, Vc::Unaligned);
+        V maxV = minV;
+        IV minBlock = IV(0);
+        IV maxBlock = IV(0);
+        int block = 1;
+        for (i = V::Size; i + V::Size <= n; i += V::Size, ++block) {
+            const V x(mem + i, Vc::Unaligned);
+            const auto less = x < minV;
+            minV(less) = x;
+            minBlock(simd_cast<IM>(less)) = IV(block);
+            const auto notLess = !(x < maxV);
+            maxV(notLess) = x;
+            maxBlock(simd_cast<IM>(notLess)) = IV(block);
+        }
+        const ValueType minValue = minV.min();
+        const ValueType maxValue = maxV.max();
+        minPos = n;
+        for (std::size_t lane = 0; lane < V::Size; ++lane) {
+            const std::size_t pos = std::size_t(minBlock[lane]) * V::Size + lane;
+            if (minV[lane] == minValue && pos < minPos) {
+                minPos = pos;
+            }
+            const std::size_t pos2 = std::size_t(maxBlock[lane]) * V::Size + lane;
+            if (maxV[lane] == maxValue && pos2 > maxPos) {
+                maxPos = pos2;
+            }
+        }
+    } else {
+        i = 1;
+    }
+    for (; i < n; ++i) {
+        if (mem[i] < mem[minPos]) {
+            minPos = i;
+        }
+        if (!(mem[i] < mem[maxPos])) {
+            maxPos = i;
+        }
+    }
+    return {first + minPos, first + maxPos};
+}
+
+// simd_find_if {{{1
+namespace Detail
+{
+template <class T> struct simd_equal_to_value {
+    T value;
+    template <class V> Vc_INTRINSIC auto operator()(const V &x) const -> decltype(x == x)
+    {
+        return x == V(value);
+    }
+};
+
+struct simd_not_equal_to {
+    template <class V> Vc_INTRINSIC auto operator()(const V &a, const V &b) const
+        -> decltype(a == b)
+    {
+        return !(a == b);
+    }
+};
+
+template <class P> struct simd_not_fn {
+    P pred;
+    template <class V> Vc_INTRINSIC auto operator()(const V &x) const -> decltype(!pred(x))
+    {
+        return !pred(x);
+    }
+};
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::find_if` algorithm.
+ *
+ * \p pred is called with `Vc::Vector` objects and must return the corresponding mask.
+ * Four vectors are tested per iteration and only a non-empty combined mask is inspected
+ * further, so that the loop body has a single, well predicted branch. The position of
+ * the first match is determined with Mask::firstOne().
+ *
+ * \code
+ * auto it = Vc::simd_find_if(data.begin(), data.end(), [](float_v x) { return x > 1.f; });
+ * \endcode
+ *
+ * \return Iterator to the first element for which \p pred is \c true, or \p last.
+ */
+template <class InputIt, class UnaryPredicate,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline InputIt simd_find_if(InputIt first, InputIt last, UnaryPredicate pred)
+{
+    typedef simdize<ValueType> V;
+    typedef simdize<ValueType, 1> V1;
+    constexpr int Size = V::Size;
+    for (; last - first >= 4 * Size; first += 4 * Size) {
+        V a, b, c, d;
+        load_interleaved(a, std::addressof(*first));
+        load_interleaved(b, std::addressof(*(first + Size)));
+        load_interleaved(c, std::addressof(*(first + 2 * Size)));
+        load_interleaved(d, std::addressof(*(first + 3 * Size)));
+        const auto ma = pred(a);
+        const auto mb = pred(b);
+        const auto mc = pred(c);
+        const auto md = pred(d);
+        if (Vc_IS_UNLIKELY(any_of(ma | mb | mc | md))) {
+            if (any_of(ma)) {
+                return first + ma.firstOne();
+            } else if (any_of(mb)) {
+                return first + (Size + mb.firstOne());
+            } else if (any_of(mc)) {
+                return first + (2 * Size + mc.firstOne());
+            }
+            return first + (3 * Size + md.firstOne());
+        }
+    }
+    for (; last - first >= Size; first += Size) {
+        V a;
+        load_interleaved(a, std::addressof(*first));
+        const auto m = pred(a);
+        if (any_of(m)) {
+            return first + m.firstOne();
+        }
+    }
+    for (; first != last; ++first) {
+        V1 a;
+        load_interleaved(a, std::addressof(*first));
+        if (any_of(pred(a))) {
+            return first;
+        }
+    }
+    return last;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::find` algorithm. See simd_find_if.
+ */
+template <class InputIt, class T>
+inline InputIt simd_find(InputIt first, InputIt last, const T &value)
+{
+    return simd_find_if(first, last, Detail::simd_equal_to_value<T>{value});
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::any_of` algorithm. See simd_find_if.
+ */
+template <class InputIt, class UnaryPredicate>
+inline bool simd_any_of(InputIt first, InputIt last, UnaryPredicate pred)
+{
+    return simd_find_if(first, last, pred) != last;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::all_of` algorithm. See simd_find_if.
+ */
+template <class InputIt, class UnaryPredicate>
+inline bool simd_all_of(InputIt first, InputIt last, UnaryPredicate pred)
+{
+    return simd_find_if(first, last, Detail::simd_not_fn<UnaryPredicate>{pred}) == last;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::none_of` algorithm. See simd_find_if.
+ */
+template <class InputIt, class UnaryPredicate>
+inline bool simd_none_of(InputIt first, InputIt last, UnaryPredicate pred)
+{
+    return simd_find_if(first, last, pred) == last;
+}
+
+// simd_count_if {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::count_if` algorithm. \p pred is called with `Vc::Vector`
+ * objects and must return the corresponding mask.
+ */
+template <class InputIt, class UnaryPredicate,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline typename std::iterator_traits<InputIt>::difference_type simd_count_if(
+    InputIt first, InputIt last, UnaryPredicate pred)
+{
+    typedef simdize<ValueType> V;
+    typedef simdize<ValueType, 1> V1;
+    constexpr int Size = V::Size;
+    typename std::iterator_traits<InputIt>::difference_type count = 0;
+    for (; last - first >= 4 * Size; first += 4 * Size) {
+        V a, b, c, d;
+        load_interleaved(a, std::addressof(*first));
+        load_interleaved(b, std::addressof(*(first + Size)));
+        load_interleaved(c, std::addressof(*(first + 2 * Size)));
+        load_interleaved(d, std::addressof(*(first + 3 * Size)));
+        count += (pred(a).count() + pred(b).count()) + (pred(c).count() + pred(d).count());
+    }
+    for (; last - first >= Size; first += Size) {
+        V a;
+        load_interleaved(a, std::addressof(*first));
+        count += pred(a).count();
+    }
+    for (; first != last; ++first) {
+        V1 a;
+        load_interleaved(a, std::addressof(*first));
+        count += pred(a).count();
+    }
+    return count;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::count` algorithm. See simd_count_if.
+ */
+template <class InputIt, class T>
+inline typename std::iterator_traits<InputIt>::difference_type simd_count(
+    InputIt first, InputIt last, const T &value)
+{
+    return simd_count_if(first, last, Detail::simd_equal_to_value<T>{value});
+}
+
+// simd_mismatch {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::mismatch` algorithm.
+ *
+ * \p differ is called with two `Vc::Vector` objects and returns the mask of lanes
+ * that do \em not match. The default compares with `operator==`.
+ *
+ * \return The pair of iterators to the first mismatching elements, or (\p last1, \p
+ * first2 + (\p last1 - \p first1)).
+ */
+template <class InputIt1, class InputIt2, class BinaryPredicate = Detail::simd_not_equal_to,
+          class ValueType = typename std::iterator_traits<InputIt1>::value_type>
+inline std::pair<InputIt1, InputIt2> simd_mismatch(InputIt1 first1, InputIt1 last1,
+                                                   InputIt2 first2,
+                                                   BinaryPredicate differ = {})
+{
+    typedef simdize<ValueType> V;
+    typedef simdize<ValueType, 1> V1;
+    constexpr int Size = V::Size;
+    for (; last1 - first1 >= 2 * Size; first1 += 2 * Size, first2 += 2 * Size) {
+        V a0, a1, b0, b1;
+        load_interleaved(a0, std::addressof(*first1));
+        load_interleaved(a1, std::addressof(*(first1 + Size)));
+        load_interleaved(b0, std::addressof(*first2));
+        load_interleaved(b1, std::addressof(*(first2 + Size)));
+        const auto m0 = differ(a0, b0);
+        const auto m1 = differ(a1, b1);
+        if (Vc_IS_UNLIKELY(any_of(m0 | m1))) {
+            const int offset = any_of(m0) ? m0.firstOne() : Size + m1.firstOne();
+            return {first1 + offset, first2 + offset};
+        }
+    }
+    for (; last1 - first1 >= Size; first1 += Size, first2 += Size) {
+        V a, b;
+        load_interleaved(a, std::addressof(*first1));
+        load_interleaved(b, std::addressof(*first2));
+        const auto m = differ(a, b);
+        if (any_of(m)) {
+            return {first1 + m.firstOne(), first2 + m.firstOne()};
+        }
+    }
+    for (; first1 != last1; ++first1, ++first2) {
+        V1 a, b;
+        load_interleaved(a, std::addressof(*first1));
+        load_interleaved(b, std::addressof(*first2));
+        if (any_of(differ(a, b))) {
+            break;
+        }
+    }
+    return {first1, first2};
+}
+
+// simd_copy_if {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::copy_if` algorithm. \p pred is called with `Vc::Vector` objects
+ * and must return the corresponding mask. The selected elements of every vector are
+ * packed with Vector::compress_store.
+ *
+ * The input and output ranges must be contiguous.
+ *
+ * \return Iterator past the last element written to \p d_first.
+ */
+template <class InputIt, class OutputIt, class UnaryPredicate,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline OutputIt simd_copy_if(InputIt first, InputIt last, OutputIt d_first,
+                             UnaryPredicate pred)
+{
+    typedef simdize<ValueType> V;
+    typedef simdize<ValueType, 1> V1;
+    constexpr int Size = V::Size;
+    for (; last - first >= Size; first += Size) {
+        V a;
+        load_interleaved(a, std::addressof(*first));
+        const auto m = pred(a);
+        if (any_of(m)) {
+            d_first += a.compress_store(std::addressof(*d_first), m);
+        }
+    }
+    for (; first != last; ++first) {
+        V1 a;
+        load_interleaved(a, std::addressof(*first));
+        if (any_of(pred(a))) {
+            *d_first = a[0];
+            ++d_first;
+        }
+    }
+    return d_first;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::remove_if` algorithm. See simd_copy_if.
+ *
+ * The elements before the first match are not written.
+ *
+ * \return Iterator past the last element that was kept.
+ */
+template <class ForwardIt, class UnaryPredicate,
+          class ValueType = typename std::iterator_traits<ForwardIt>::value_type>
+inline ForwardIt simd_remove_if(ForwardIt first, ForwardIt last, UnaryPredicate pred)
+{
+    typedef simdize<ValueType> V;
+    typedef simdize<ValueType, 1> V1;
+    constexpr int Size = V::Size;
+    first = simd_find_if(first, last, pred);
+    ForwardIt out = first;
+    for (; last - first >= Size; first += Size) {
+        V a;
+        load_interleaved(a, std::addressof(*first));
+        out += a.compress_store(std::addressof(*out), !pred(a));
+    }
+    for (; first != last; ++first) {
+        V1 a;
+        load_interleaved(a, std::addressof(*first));
+        if (none_of(pred(a))) {
+            *out = a[0];
+            ++out;
+        }
+    }
+    return out;
+}
+
+// simd_partition {{{1
+namespace Detail
+{
+// Writes the lanes of v selected by t to the front and those selected by f to the back
+// of the gap [left, right).
+template <class It, class V, class M>
+Vc_INTRINSIC void simd_partition_store(It &left, It &right, const V &v, const M &t,
+                                       const M &f)
+{
+    const int nt = t.count();
+    const int nf = f.count();
+    if (nt > 0) {
+        v.compress_store(std::addressof(*left), t);
+        left += nt;
+    }
+    if (nf > 0) {
+        right -= nf;
+        v.compress_store(std::addressof(*right), f);
+    }
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::partition` algorithm. \p pred is called with `Vc::Vector`
+ * objects and must return the corresponding mask.
+ *
+ * One vector from each end of the range is held in registers, which leaves room for a
+ * full vector of elements at both ends of the unprocessed part. Every vector is then
+ * split with two Vector::compress_store calls: the selected elements are appended at the
+ * front, the others prepended at the back. Like `std::partition` the relative order of
+ * the elements is not preserved.
+ *
+ * The range must be contiguous.
+ *
+ * \return Iterator to the first element of the second group.
+ */
+template <class RandomIt, class UnaryPredicate,
+          class ValueType = typename std::iterator_traits<RandomIt>::value_type>
+inline RandomIt simd_partition(RandomIt first, RandomIt last, UnaryPredicate pred)
+{
+    typedef simdize<ValueType> V;
+    typedef simdize<ValueType, 1> V1;
+    constexpr int Size = V::Size;
+    if (last - first < 2 * Size) {
+        const auto test = [&](RandomIt it) {
+            V1 a;
+            load_interleaved(a, std::addressof(*it));
+            return any_of(pred(a));
+        };
+        for (;; ++first) {
+            for (; first != last && test(first); ++first) {
+            }
+            if (first == last) {
+                return first;
+            }
+            for (--last; first != last && !test(last); --last) {
+            }
+            if (first == last) {
+                return first;
+            }
+            std::iter_swap(first, last);
+        }
+    }
+
+    V front, back;
+    load_interleaved(front, std::addressof(*first));
+    load_interleaved(back, std::addressof(*(last - Size)));
+    RandomIt left = first, right = last;
+    RandomIt readLeft = first + Size, readRight = last - Size;
+
+    // process the remainder first, so that the main loop reads whole vectors; the
+    // unmasked load stays inside [readLeft, readRight + Size)
+    const int remainder = (readRight - readLeft) % Size;
+    if (remainder > 0) {
+        V a;
+        load_interleaved(a, std::addressof(*readLeft));
+        const auto valid = V([](int i) { return i; }) < V(remainder);
+        const auto m = pred(a);
+        Detail::simd_partition_store(left, right, a, m && valid, !m && valid);
+        readLeft += remainder;
+    }
+
+    // Reading from the side with less free space keeps at least Size free slots on both
+    // sides for the following stores.
+    while (readLeft != readRight) {
+        V a;
+        if (readLeft - left <= right - readRight) {
+            load_interleaved(a, std::addressof(*readLeft));
+            readLeft += Size;
+        } else {
+            readRight -= Size;
+            load_interleaved(a, std::addressof(*readRight));
+        }
+        const auto m = pred(a);
+        Detail::simd_partition_store(left, right, a, m, !m);
+    }
+
+    const auto mf = pred(front);
+    Detail::simd_partition_store(left, right, front, mf, !mf);
+    const auto mb = pred(back);
+    Detail::simd_partition_store(left, right, back, mb, !mb);
+    return left;
+}
+
+// simd_inclusive_scan {{{1
+namespace Detail
+{
+// Inclusive scan within one vector in log2(Size) steps. The lanes without a partner at
+// distance k keep their value, so that op needs no identity element. The left operand
+// of op always holds the earlier elements.
+template <class V, class BinaryOperation>
+Vc_INTRINSIC V simd_scan_vector(V x, BinaryOperation op)
+{
+    for (int k = 1; k < int(V::Size); k *= 2) {
+        x(V([](int i) { return i; }) >= V(k)) = op(x.shifted(-k), x);
+    }
+    return x;
+}
+template <class V> Vc_INTRINSIC V simd_scan_vector(const V &x, simd_plus)
+{
+    return x.partialSum();
+}
+
+// Scans [first, last) into d_first, starting from init. Every vector is scanned in
+// registers and then combined with the broadcast carry of the preceding elements.
+template <class InputIt, class OutputIt, class BinaryOperation, bool Exclusive>
+inline OutputIt simd_scan(InputIt first, InputIt last, OutputIt d_first,
+                          BinaryOperation op,
+                          const typename std::iterator_traits<InputIt>::value_type &init,
+                          std::integral_constant<bool, Exclusive>)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type ValueType;
+    typedef simdize<ValueType> V;
+    typedef simdize<ValueType, 1> V1;
+    constexpr int Size = V::Size;
+    V carry(init);
+    for (; last - first >= Size; first += Size, d_first += Size) {
+        V x;
+        load_interleaved(x, std::addressof(*first));
+        const V r = op(carry, simd_scan_vector(x, op));
+        store_interleaved(Exclusive ? r.shifted(-1, carry) : r, std::addressof(*d_first));
+        carry = V(r[Size - 1]);
+    }
+    V1 carry1(carry[0]);
+    for (; first != last; ++first, ++d_first) {
+        V1 x;
+        load_interleaved(x, std::addressof(*first));
+        const V1 r = op(carry1, x);
+        store_interleaved(Exclusive ? carry1 : r, std::addressof(*d_first));
+        carry1 = r;
+    }
+    return d_first;
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::inclusive_scan` algorithm: `d_first[i]` receives
+ * `op(first[0], ..., first[i])`.
+ *
+ * \p op is called with `Vc::Vector` objects and must be associative; it does not need to
+ * be commutative. Each vector is scanned in registers with log2(Size) shift steps
+ * (Vector::partialSum for the default addition) and the running total is carried from
+ * one vector to the next. The results are computed in the value type of the input.
+ * \p d_first may be equal to \p first.
+ *
+ * \code
+ * Vc::simd_inclusive_scan(counts.begin(), counts.end(), offsets.begin());
+ * \endcode
+ *
+ * \return Iterator one past the last element written.
+ */
+template <class InputIt, class OutputIt, class BinaryOperation = Detail::simd_plus,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline OutputIt simd_inclusive_scan(InputIt first, InputIt last, OutputIt d_first,
+                                    BinaryOperation op = {})
+{
+    if (first == last) {
+        return d_first;
+    }
+    const ValueType init = *first;
+    *d_first = init;
+    return Detail::simd_scan(std::next(first), last, std::next(d_first), op, init,
+                             std::false_type());
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::inclusive_scan` algorithm with an initial value: `d_first[i]`
+ * receives `op(init, first[0], ..., first[i])`. See above.
+ */
+template <class InputIt, class OutputIt, class BinaryOperation>
+inline OutputIt simd_inclusive_scan(
+    InputIt first, InputIt last, OutputIt d_first, BinaryOperation op,
+    const typename std::iterator_traits<InputIt>::value_type &init)
+{
+    return Detail::simd_scan(first, last, d_first, op, init, std::false_type());
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::exclusive_scan` algorithm: `d_first[i]` receives
+ * `op(init, first[0], ..., first[i - 1])`. See simd_inclusive_scan.
+ *
+ * \return Iterator one past the last element written.
+ */
+template <class InputIt, class OutputIt, class BinaryOperation = Detail::simd_plus>
+inline OutputIt simd_exclusive_scan(
+    InputIt first, InputIt last, OutputIt d_first,
+    const typename std::iterator_traits<InputIt>::value_type &init,
+    BinaryOperation op = {})
+{
+    return Detail::simd_scan(first, last, d_first, op, init, std::true_type());
+}
+
+// execution policies {{{1
+namespace execution
+{
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * The type of Vc::execution::par_simd.
+ */
+struct parallel_simd_policy {
+};
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Execution policy for the Vc algorithms: the range is split into cache-sized chunks
+ * whose length is a multiple of the vector width. The chunks are distributed over the
+ * library's thread pool and each of them is processed with the vectorized algorithm.
+ * Thus only the last chunk needs a scalar epilogue.
+ *
+ * \code
+ * Vc::simd_for_each(Vc::execution::par_simd, data.begin(), data.end(),
+ *                   [&](auto &v) { v *= factor; });
+ * \endcode
+ */
+constexpr parallel_simd_policy par_simd{};
+
+template <class T> struct is_execution_policy : public std::false_type {};
+template <> struct is_execution_policy<parallel_simd_policy> : public std::true_type {};
+}  // namespace execution
+
+namespace Detail
+{
+/// The number of bytes of input a single task of a parallel algorithm processes.
+constexpr std::size_t simd_parallel_chunk_bytes = 64 * 1024;
+
+// The number of elements of a chunk: a multiple of the vector width.
+template <class ValueType> constexpr std::size_t simd_chunk_size()
+{
+    return simd_parallel_chunk_bytes / sizeof(ValueType) >= simdize<ValueType>::Size
+               ? simd_parallel_chunk_bytes / sizeof(ValueType) /
+                     simdize<ValueType>::Size * simdize<ValueType>::Size
+               : simdize<ValueType>::Size;
+}
+
+template <class ValueType, class InputIt>
+inline std::size_t simd_chunk_count(InputIt first, InputIt last)
+{
+    return (std::size_t(last - first) + simd_chunk_size<ValueType>() - 1) /
+           simd_chunk_size<ValueType>();
+}
+
+// Calls f(chunkFirst, chunkLast, chunkIndex) for every chunk of [first, last) on the
+// thread pool.
+template <class ValueType, class InputIt, class F>
+inline void simd_for_each_chunk(InputIt first, InputIt last, F &&f)
+{
+    const std::size_t n = last - first;
+    const std::size_t chunk = simd_chunk_size<ValueType>();
+    parallel_for(simd_chunk_count<ValueType>(first, last), [&](std::size_t i) {
+        const std::size_t offset = i * chunk;
+        f(first + offset, first + std::min(offset + chunk, n), i);
+    });
+}
+}  // namespace Detail
+
+// parallel algorithms {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Parallel variant of simd_for_each. \p f is copied for every chunk and may be called
+ * concurrently from several threads.
+ */
+template <class InputIt, class UnaryFunction,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline void simd_for_each(execution::parallel_simd_policy, InputIt first, InputIt last,
+                          UnaryFunction f)
+{
+    Detail::simd_for_each_chunk<ValueType>(
+        first, last,
+        [&](InputIt chunkFirst, InputIt chunkLast, std::size_t) {
+            simd_for_each(chunkFirst, chunkLast, f);
+        });
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Parallel variant of simd_transform. \p op may be called concurrently from several
+ * threads.
+ */
+template <class InputIt, class OutputIt, class UnaryOperation,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline OutputIt simd_transform(execution::parallel_simd_policy, InputIt first,
+                               InputIt last, OutputIt d_first, UnaryOperation op)
+{
+    // the threshold applies to the whole output, not to the chunks
+    const bool streaming = Detail::use_streaming_stores<OutputIt>(
+        last - first, Detail::is_streamable_output<OutputIt>());
+    Detail::simd_for_each_chunk<ValueType>(
+        first, last, [&](InputIt chunkFirst, InputIt chunkLast, std::size_t) {
+            UnaryOperation chunkOp = op;
+            Detail::simd_transform_impl(chunkFirst, chunkLast,
+                                        d_first + (chunkFirst - first), chunkOp,
+                                        streaming);
+        });
+    return d_first + (last - first);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Parallel variant of simd_reduce. Every chunk is reduced independently, the partial
+ * results are combined with \p init on the calling thread.
+ */
+template <class InputIt, class T, class BinaryOperation,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline T simd_reduce(execution::parallel_simd_policy, InputIt first, InputIt last,
+                     T init, BinaryOperation op)
+{
+    using V1 = simdize<T, 1>;
+    std::vector<V1> partial(Detail::simd_chunk_count<ValueType>(first, last));
+    Detail::simd_for_each_chunk<ValueType>(
+        first, last, [&](InputIt chunkFirst, InputIt chunkLast, std::size_t i) {
+            partial[i] = Detail::simd_reduce_nonempty(chunkFirst, chunkLast, op);
+        });
+    V1 result(init);
+    for (const V1 &p : partial) {
+        result = op(result, p);
+    }
+    return result[0];
+}
+
+namespace Detail
+{
+// Reduces the non-empty range [first, last) without reordering the operands of op, for
+// the first pass of the parallel scans.
+template <class InputIt, class BinaryOperation,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline ValueType simd_scan_total(InputIt first, InputIt last, BinaryOperation op)
+{
+    typedef simdize<ValueType> V;
+    typedef simdize<ValueType, 1> V1;
+    constexpr int Size = V::Size;
+    V1 total;
+    load_interleaved(total, std::addressof(*first));
+    for (++first; last - first >= Size; first += Size) {
+        V x;
+        load_interleaved(x, std::addressof(*first));
+        total = op(total, V1(simd_scan_vector(x, op)[Size - 1]));
+    }
+    for (; first != last; ++first) {
+        V1 x;
+        load_interleaved(x, std::addressof(*first));
+        total = op(total, x);
+    }
+    return total[0];
+}
+// addition may be reordered
+template <class InputIt, class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline ValueType simd_scan_total(InputIt first, InputIt last, simd_plus op)
+{
+    return simd_reduce_nonempty(first, last, op)[0];
+}
+
+// Two passes over the chunks: the first computes the total of every chunk, which
+// (after a serial exclusive scan on the calling thread) is the initial value for
+// scanning the chunk in the second pass.
+template <class InputIt, class OutputIt, class BinaryOperation, bool Exclusive>
+inline OutputIt simd_scan_parallel(
+    InputIt first, InputIt last, OutputIt d_first, BinaryOperation op,
+    const typename std::iterator_traits<InputIt>::value_type &init,
+    std::integral_constant<bool, Exclusive> exclusive)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type ValueType;
+    using V1 = simdize<ValueType, 1>;
+    const std::size_t chunks = simd_chunk_count<ValueType>(first, last);
+    std::vector<V1> offsets(chunks);
+    simd_for_each_chunk<ValueType>(
+        first, last, [&](InputIt chunkFirst, InputIt chunkLast, std::size_t i) {
+            if (i + 1 < chunks) {  // the total of the last chunk is not needed
+                offsets[i] = V1(simd_scan_total(chunkFirst, chunkLast, op));
+            }
+        });
+    V1 running(init);
+    for (V1 &offset : offsets) {
+        const V1 next = op(running, offset);
+        offset = running;
+        running = next;
+    }
+    simd_for_each_chunk<ValueType>(
+        first, last, [&](InputIt chunkFirst, InputIt chunkLast, std::size_t i) {
+            simd_scan(chunkFirst, chunkLast, d_first + (chunkFirst - first), op,
+                      offsets[i][0], exclusive);
+        });
+    return d_first + (last - first);
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Parallel variant of simd_inclusive_scan. The range is read twice: the first pass
+ * computes the total of every chunk, the second pass scans the chunks independently,
+ * each starting from the combined totals of the preceding chunks. \p op may be called
+ * concurrently from several threads. \p d_first may be equal to \p first.
+ */
+template <class InputIt, class OutputIt, class BinaryOperation = Detail::simd_plus,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline OutputIt simd_inclusive_scan(execution::parallel_simd_policy, InputIt first,
+                                    InputIt last, OutputIt d_first,
+                                    BinaryOperation op = {})
+{
+    if (first == last) {
+        return d_first;
+    }
+    const ValueType init = *first;
+    *d_first = init;
+    return Detail::simd_scan_parallel(std::next(first), last, std::next(d_first), op,
+                                      init, std::false_type());
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Parallel variant of simd_inclusive_scan with an initial value.
+ */
+template <class InputIt, class OutputIt, class BinaryOperation>
+inline OutputIt simd_inclusive_scan(
+    execution::parallel_simd_policy, InputIt first, InputIt last, OutputIt d_first,
+    BinaryOperation op, const typename std::iterator_traits<InputIt>::value_type &init)
+{
+    return Detail::simd_scan_parallel(first, last, d_first, op, init, std::false_type());
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Parallel variant of simd_exclusive_scan. See the parallel simd_inclusive_scan.
+ */
+template <class InputIt, class OutputIt, class BinaryOperation = Detail::simd_plus>
+inline OutputIt simd_exclusive_scan(
+    execution::parallel_simd_policy, InputIt first, InputIt last, OutputIt d_first,
+    const typename std::iterator_traits<InputIt>::value_type &init,
+    BinaryOperation op = {})
+{
+    return Detail::simd_scan_parallel(first, last, d_first, op, init, std::true_type());
+}
+
+// simd_gather_for_each {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * The prefetch distances of simd_gather_for_each, counted in gathers ahead of the
+ * current one. A distance of 0 disables the respective prefetches.
+ */
+struct GatherPrefetch {
+    constexpr GatherPrefetch(std::size_t close_ = 8, std::size_t mid_ = 32)
+        : close(close_), mid(mid_)
+    {
+    }
+    /// distance of the prefetches into the L1 cache (Common::prefetchClose)
+    std::size_t close;
+    /// distance of the prefetches into the L2 cache (Common::prefetchMid)
+    std::size_t mid;
+};
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Gathers `mem[indexes[i]]` for all \p n indexes and calls \p f with the gathered
+ * vector of type \p V and the offset \p i of its first index.
+ *
+ * While the gather at offset \p i executes, the entries of the gathers at \p
+ * prefetch.close and \p prefetch.mid vectors ahead are prefetched into the L1 and L2
+ * caches. Thus the latency of the random accesses overlaps with the work of \p f, which
+ * is what latency-bound loops such as sparse matrix-vector products need. The best
+ * distances depend on the cost of \p f and the memory subsystem; a larger distance
+ * hides more latency but lets more of the prefetched lines be evicted before they are
+ * used.
+ *
+ * As with simd_for_each, the remainder that does not fill a complete vector is
+ * processed with vectors of size 1. The following example requires C++14 for generic
+ * lambdas.
+ *
+ * \code
+ * // the dot product of the sparse vector (value, column) with x
+ * float dot = 0.f;
+ * Vc::simd_gather_for_each<Vc::float_v>(x, column, nnz, [&](auto xs, std::size_t k) {
+ *     dot += (decltype(xs)(value + k, Vc::Unaligned) * xs).sum();
+ * });
+ * \endcode
+ *
+ * \return \p f
+ */
+template <class V, class IndexT, class BinaryFunction>
+inline BinaryFunction simd_gather_for_each(const typename V::EntryType *mem,
+                                           const IndexT *indexes, std::size_t n,
+                                           BinaryFunction f,
+                                           GatherPrefetch prefetch = GatherPrefetch())
+{
+    using IV = typename V::IndexType;
+    using V1 = simdize<typename V::EntryType, 1>;
+    const std::size_t close = prefetch.close * V::Size;
+    const std::size_t mid = prefetch.mid * V::Size;
+    const std::size_t ahead = std::max(close, mid);
+    std::size_t i = 0;
+    if (ahead > 0) {
+        // The remaining indexes after this loop have all been prefetched already.
+        for (; i + ahead + V::Size <= n; i += V::Size) {
+            if (close > 0) {
+                for (std::size_t j = 0; j < V::Size; ++j) {
+                    Common::prefetchClose(mem + indexes[i + close + j]);
+                }
+            }
+            if (mid > 0) {
+                for (std::size_t j = 0; j < V::Size; ++j) {
+                    Common::prefetchMid(mem + indexes[i + mid + j]);
+                }
+            }
+            f(V(mem, IV(indexes + i, Vc::Unaligned)), i);
+        }
+    }
+    for (; i + V::Size <= n; i += V::Size) {
+        f(V(mem, IV(indexes + i, Vc::Unaligned)), i);
+    }
+    for (; i < n; ++i) {
+        f(V1(mem[indexes[i]]), i);
+    }
+    return f;
+}
+// }}}1
+
 }  // namespace Vc
 
 #endif // VC_COMMON_ALGORITHMS_H_
@@ -0,0 +1,266 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_ARENA_H_
+#define VC_COMMON_ARENA_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <vector>
+#include "malloc.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \ingroup Utilities
+ * \headerfile arena.h <Vc/Allocator>
+ *
+ * A monotonic memory arena for short-lived, vector-aligned temporaries.
+ *
+ * allocate hands out memory by bumping a pointer through a list of blocks; there is no
+ * per-allocation deallocation. reset releases all allocations at once and keeps the
+ * blocks for the next round, so that a per-event or per-iteration workload stops
+ * calling the system allocator after its first round. If a round needed more than one
+ * block, reset replaces them by a single block of their total size.
+ *
+ * Every allocation is aligned to at least Vc::VectorAlignment and its size is padded to
+ * a multiple of its alignment, so that full vector loads and stores up to the padded
+ * end are valid.
+ *
+ * An Arena is not thread-safe. Use thread_arena() for a per-thread instance.
+ */
+class Arena
+{
+public:
+    /// Creates an arena whose first block holds \p blockSize bytes. No memory is
+    /// allocated before the first call to allocate.
+    explicit Arena(std::size_t blockSize = 64 * 1024) : m_blockSize(blockSize) {}
+    ~Arena() { release(); }
+
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    /**
+     * Returns \p bytes of memory aligned to \p alignment, but at least to
+     * Vc::VectorAlignment. Pass e.g. 64 for cache line alignment.
+     *
+     * \param bytes The number of bytes; padded to a multiple of the alignment.
+     * \param alignment A power of two.
+     * \throws std::bad_alloc if the system allocator fails.
+     */
+    void *allocate(std::size_t bytes, std::size_t alignment = VectorAlignment)
+    {
+        alignment = std::max(alignment, VectorAlignment);
+        if (bytes > std::numeric_limits<std::size_t>::max() - alignment) {
+            throw std::bad_alloc();
+        }
+        bytes = (bytes + alignment - 1) & ~(alignment - 1);
+        char *p = alignUp(m_ptr, alignment);
+        if (Vc_IS_UNLIKELY(p == nullptr || bytes > std::size_t(m_end - p))) {
+            p = nextBlock(bytes, alignment);
+        }
+        m_ptr = p + bytes;
+        return p;
+    }
+
+    /// Returns uninitialized memory for \p n objects of type \p T.
+    template <typename T> T *allocate(std::size_t n)
+    {
+        if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T *>(
+            allocate(n * sizeof(T), std::max(alignof(T), VectorAlignment)));
+    }
+
+    /**
+     * Invalidates all allocations and makes the memory available again. Objects in the
+     * arena are not destroyed.
+     */
+    void reset()
+    {
+        if (m_blocks.size() > 1) {
+            std::size_t total = 0;
+            for (const Block &b : m_blocks) {
+                total += b.end - b.begin;
+            }
+            release();
+            m_blocks.push_back(newBlock(total));
+        }
+        m_current = 0;
+        m_ptr = m_blocks.empty() ? nullptr : m_blocks[0].begin;
+        m_end = m_blocks.empty() ? nullptr : m_blocks[0].end;
+    }
+
+    /// Invalidates all allocations and returns all blocks to the system allocator.
+    void release()
+    {
+        for (const Block &b : m_blocks) {
+            Vc::free(b.begin);
+        }
+        m_blocks.clear();
+        m_current = 0;
+        m_ptr = m_end = nullptr;
+    }
+
+    /// Returns the number of bytes in all blocks of the arena.
+    std::size_t capacity() const
+    {
+        std::size_t total = 0;
+        for (const Block &b : m_blocks) {
+            total += b.end - b.begin;
+        }
+        return total;
+    }
+
+private:
+    struct Block {
+        char *begin;
+        char *end;
+    };
+
+    static char *alignUp(char *p, std::size_t alignment)
+    {
+        return reinterpret_cast<char *>(
+            (reinterpret_cast<std::uintptr_t>(p) + alignment - 1) & ~(alignment - 1));
+    }
+
+    static Block newBlock(std::size_t bytes)
+    {
+        char *p = Vc::malloc<char, Vc::AlignOnCacheline>(bytes);
+        if (p == nullptr) {
+            throw std::bad_alloc();
+        }
+        return {p, p + bytes};
+    }
+
+    // Continues in the next block that can hold the request, allocating a new one if
+    // necessary, and returns the aligned start of the allocation.
+    char *nextBlock(std::size_t bytes, std::size_t alignment)
+    {
+        for (++m_current; m_current < m_blocks.size(); ++m_current) {
+            char *p = alignUp(m_blocks[m_current].begin, alignment);
+            if (bytes <= std::size_t(m_blocks[m_current].end - p)) {
+                m_end = m_blocks[m_current].end;
+                return p;
+            }
+        }
+        // grow geometrically, so that the number of blocks per round stays logarithmic
+        const std::size_t size =
+            std::max(m_blocks.empty() ? m_blockSize : 2 * (m_blocks.back().end -
+                                                           m_blocks.back().begin),
+                     bytes + alignment);
+        m_blocks.push_back(newBlock(size));
+        m_current = m_blocks.size() - 1;
+        m_end = m_blocks.back().end;
+        return alignUp(m_blocks.back().begin, alignment);
+    }
+
+    std::vector<Block> m_blocks;
+    std::size_t m_blockSize;
+    std::size_t m_current = 0;
+    char *m_ptr = nullptr;
+    char *m_end = nullptr;
+};
+
+/**
+ * \ingroup Utilities
+ * \headerfile arena.h <Vc/Allocator>
+ *
+ * Returns the Arena of the calling thread. Call `thread_arena().reset()` at the end of
+ * a unit of work (e.g. an event) when no temporaries from the arena are alive anymore.
+ */
+inline Arena &thread_arena()
+{
+    static thread_local Arena arena;
+    return arena;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile arena.h <Vc/Allocator>
+ *
+ * An STL allocator that allocates from an Arena, by default from thread_arena().
+ *
+ * deallocate is a no-op; the memory is reclaimed by Arena::reset. Thus a container that
+ * grows repeatedly leaves its old buffers behind in the arena until the reset; reserve
+ * the final size up front where possible.
+ *
+ * \code
+ * std::vector<float, Vc::ArenaAllocator<float>> tmp;
+ * tmp.reserve(n);
+ * ...
+ * Vc::thread_arena().reset();  // after tmp is destroyed
+ * \endcode
+ *
+ * \tparam T The type of objects to allocate.
+ */
+template <typename T> class ArenaAllocator
+{
+public:
+    typedef T value_type;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    template <typename U> struct rebind { typedef ArenaAllocator<U> other; };
+
+    ArenaAllocator() noexcept : m_arena(&thread_arena()) {}
+    explicit ArenaAllocator(Arena &arena) noexcept : m_arena(&arena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &rhs) noexcept : m_arena(&rhs.arena())
+    {
+    }
+
+    T *allocate(size_type n) { return m_arena->allocate<T>(n); }
+    void deallocate(T *, size_type) noexcept {}
+
+    /// The arena this allocator allocates from.
+    Arena &arena() const noexcept { return *m_arena; }
+
+private:
+    Arena *m_arena;
+};
+
+template <typename T, typename U>
+inline bool operator==(const ArenaAllocator<T> &a, const ArenaAllocator<U> &b) noexcept
+{
+    return &a.arena() == &b.arena();
+}
+template <typename T, typename U>
+inline bool operator!=(const ArenaAllocator<T> &a, const ArenaAllocator<U> &b) noexcept
+{
+    return !(a == b);
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_ARENA_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,254 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_DIVIDER_H_
+#define VC_COMMON_DIVIDER_H_
+
+#include <cstdint>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// mulhi {{{1
+// The high half of the double-width product of every entry, i.e. (a * b) >> (8 * sizeof(T)).
+template <typename T>
+Vc_INTRINSIC Scalar::Vector<T> mulhi(Scalar::Vector<T> a, Scalar::Vector<T> b)
+{
+    using W = typename std::conditional<std::is_signed<T>::value, std::int64_t,
+                                        std::uint64_t>::type;
+    return static_cast<T>((W(a.data()) * W(b.data())) >> (8 * sizeof(T)));
+}
+#ifdef Vc_IMPL_SSE
+template <typename T> Vc_INTRINSIC SSE::Vector<T> mulhi(SSE::Vector<T> a, SSE::Vector<T> b)
+{
+    return mulhi(a.data(), b.data(), T());
+}
+#endif
+#ifdef Vc_IMPL_AVX2
+template <typename T>
+Vc_INTRINSIC AVX2::Vector<T> mulhi(AVX2::Vector<T> a, AVX2::Vector<T> b)
+{
+    return mulhi(a.data(), b.data(), T());
+}
+#endif
+#ifdef Vc_IMPL_AVX512
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> mulhi(AVX512::Vector<T> a, AVX512::Vector<T> b)
+{
+    return mulhi(a.data(), b.data(), T());
+}
+#endif
+
+template <typename T>
+using is_divider_type = std::integral_constant<
+    bool, std::is_same<T, int>::value || std::is_same<T, uint>::value ||
+              std::is_same<T, short>::value || std::is_same<T, ushort>::value>;
+// }}}1
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ *
+ * Precomputed integer division by a runtime-invariant divisor.
+ *
+ * The SSE and AVX2 instruction sets have no integer division, so `int_v / int_v` either
+ * converts to floating-point or falls back to one scalar division per entry. If the
+ * divisor stays the same for many divisions (e.g. `i / width` and `i % width` in an index
+ * decomposition), construct a Divider once and divide by it instead. The constructor
+ * computes a multiplier and a shift (see Granlund & Montgomery, "Division by Invariant
+ * Integers using Multiplication", and libdivide), which turn every division into a
+ * high-half multiplication, a few additions, and shifts:
+ * \code
+ * const Vc::Divider<int> width(w);
+ * for (int_v i = int_v::IndexesFromZero(); ...; i += int_v::Size) {
+ *   const int_v row = i / width;
+ *   const int_v col = i % width;
+ * }
+ * \endcode
+ * The results are identical to the builtin operators: quotients are rounded towards zero
+ * and the remainder has the sign of the dividend. As with the builtin operators, dividing
+ * the minimal value of a signed type by -1 is undefined (the implementation wraps).
+ *
+ * \tparam T One of \c int, \c uint, \c short, or \c ushort.
+ */
+template <typename T> class Divider
+{
+    static_assert(Detail::is_divider_type<T>::value,
+                  "Vc::Divider<T> requires T to be one of int, uint, short, or ushort");
+    using U = typename std::make_unsigned<T>::type;
+    static constexpr int Bits = 8 * sizeof(T);
+
+public:
+    /// The code path selected by the constructor. All entries of a vector take the same
+    /// path, thus branching on it is free of mispredictions in a loop.
+    enum class Algorithm : unsigned char {
+        Shift,       ///< |divisor| is a power of two (including 1)
+        Multiply,    ///< the multiplier fits into \p T
+        MultiplyAdd  ///< the multiplier needs one more bit, which is added separately
+    };
+
+    /**
+     * Precomputes the multiplier and shift for divisions by \p d.
+     *
+     * \param d The divisor. Must not be zero.
+     */
+    explicit Divider(T d) : m_divisor(d)
+    {
+        Vc_ASSERT(d != 0);
+        const bool negative = d < 0;
+        const U absD = negative ? U(U(0) - U(d)) : U(d);
+        int log2D = Bits - 1;
+        while ((absD >> log2D) == 0) {
+            --log2D;
+        }
+        m_negative = negative ? T(-1) : T(0);
+        if ((absD & (absD - 1)) == 0) {
+            m_algorithm = Algorithm::Shift;
+            m_magic = T((U(1) << log2D) - 1);  // rounding bias for negative dividends
+            m_shift = log2D;
+            return;
+        }
+        // for signed T the quotient only needs Bits - 1 bits, thus one bit less of
+        // precision in the multiplier suffices
+        const int k = std::is_signed<T>::value ? Bits - 1 + log2D : Bits + log2D;
+        const std::uint64_t q = (std::uint64_t(1) << k) / absD;
+        const std::uint64_t r = (std::uint64_t(1) << k) % absD;
+        std::uint64_t m;
+        if (absD - r < (std::uint64_t(1) << log2D)) {
+            m_algorithm = Algorithm::Multiply;
+            m = q + 1;
+            m_shift = std::is_signed<T>::value ? log2D - 1 : log2D;
+        } else {
+            m_algorithm = Algorithm::MultiplyAdd;
+            m = 2 * q + (2 * r >= absD ? 1 : 0) + 1;
+            m_shift = log2D;
+        }
+        // In the MultiplyAdd case m needs Bits + 1 bits (unsigned) or does not fit into the
+        // signed type. The truncated multiplier is corrected for in divide().
+        const U magic = U(m);
+        m_magic = negative ? T(U(0) - magic) : T(magic);
+    }
+
+    /// Returns the divisor passed to the constructor.
+    T divisor() const { return m_divisor; }
+    /// Returns the code path used for this divisor.
+    Algorithm algorithm() const { return m_algorithm; }
+
+    /// Returns the entry-wise quotient \p n / divisor(), rounded towards zero.
+    template <typename V> Vc_ALWAYS_INLINE V divide(V n) const
+    {
+        return divide(n, std::is_signed<T>());
+    }
+
+private:
+    template <typename V> Vc_ALWAYS_INLINE V divide(V n, std::false_type) const
+    {
+        switch (m_algorithm) {
+        case Algorithm::Shift:
+            return n >> m_shift;
+        case Algorithm::Multiply:
+            return Detail::mulhi(n, V(m_magic)) >> m_shift;
+        default: {
+            const V t = Detail::mulhi(n, V(m_magic));
+            return (((n - t) >> 1) + t) >> m_shift;
+        }
+        }
+    }
+    template <typename V> Vc_ALWAYS_INLINE V divide(V n, std::true_type) const
+    {
+        const V sign = m_negative;
+        V q;
+        switch (m_algorithm) {
+        case Algorithm::Shift:
+            // round towards zero: add divisor - 1 to negative dividends before the shift
+            q = (n + ((n >> (Bits - 1)) & V(m_magic))) >> m_shift;
+            return (q ^ sign) - sign;
+        case Algorithm::Multiply:
+            q = Detail::mulhi(n, V(m_magic)) >> m_shift;
+            break;
+        default:
+            q = (Detail::mulhi(n, V(m_magic)) + ((n ^ sign) - sign)) >> m_shift;
+            break;
+        }
+        return q - (q >> (Bits - 1));  // adds 1 to negative quotients
+    }
+
+    T m_divisor;
+    T m_magic;
+    T m_negative;
+    unsigned char m_shift;
+    Algorithm m_algorithm;
+};
+
+/**
+ * \ingroup Utilities
+ *
+ * Returns the entry-wise quotient \p n / \p d.divisor(), rounded towards zero.
+ */
+template <typename T, typename Abi>
+Vc_ALWAYS_INLINE enable_if<Detail::is_divider_type<T>::value, Vector<T, Abi>> operator/(
+    const Vector<T, Abi> &n, const Divider<T> &d)
+{
+    return d.divide(n);
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Returns the entry-wise remainder of \p n / \p d.divisor(), which has the sign of \p n.
+ */
+template <typename T, typename Abi>
+Vc_ALWAYS_INLINE enable_if<Detail::is_divider_type<T>::value, Vector<T, Abi>> operator%(
+    const Vector<T, Abi> &n, const Divider<T> &d)
+{
+    return n - d.divide(n) * Vector<T, Abi>(d.divisor());
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Scalar overloads, e.g. for the epilogue of a vectorized loop.
+ */
+template <typename T>
+Vc_ALWAYS_INLINE enable_if<Detail::is_divider_type<T>::value, T> operator/(
+    T n, const Divider<T> &d)
+{
+    return d.divide(Scalar::Vector<T>(n)).data();
+}
+template <typename T>
+Vc_ALWAYS_INLINE enable_if<Detail::is_divider_type<T>::value, T> operator%(
+    T n, const Divider<T> &d)
+{
+    return n - (n / d) * d.divisor();
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_DIVIDER_H_
+
+// vim: foldmethod=marker
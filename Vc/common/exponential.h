@@ -81,4 +81,110 @@ inline Vector<float, detail::not_fixed_size_abi<Abi>> exp(Vector<float, Abi> x)
         return x;
     }
 
+namespace Detail
+{
+// expm1_reduced {{{
+// Returns eˣ - 1 for |x| ≤ ½ln(2) without the cancellation of exp(x) - 1. The float
+// version is the polynomial of exp above. For double, the Taylor series up to x¹³ keeps
+// the truncation error below 2⁻⁵⁸ relative.
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<float, Abi> expm1_reduced(const Vector<float, Abi> &x)
+{
+    return ((((( 1.9875691500E-4f  * x
+               + 1.3981999507E-3f) * x
+               + 8.3334519073E-3f) * x
+               + 4.1665795894E-2f) * x
+               + 1.6666665459E-1f) * x
+               + 5.0000001201E-1f) * (x * x)
+               + x;
+}
+
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<double, Abi> expm1_reduced(const Vector<double, Abi> &x)
+{
+    using V = Vector<double, Abi>;
+    V p = 1. / 6227020800.;  // 1/13!
+    p = p * x + 1. / 479001600.;
+    p = p * x + 1. / 39916800.;
+    p = p * x + 1. / 3628800.;
+    p = p * x + 1. / 362880.;
+    p = p * x + 1. / 40320.;
+    p = p * x + 1. / 5040.;
+    p = p * x + 1. / 720.;
+    p = p * x + 1. / 120.;
+    p = p * x + 1. / 24.;
+    p = p * x + 1. / 6.;
+    p = p * x + 0.5;
+    return p * (x * x) + x;
+}
+
+// ldexp_wide {{{
+// Returns x * 2ⁿ also if the result overflows or is denormal, where ldexp only adds n to
+// the exponent bits. n must lie within twice the exponent range of normalized numbers.
+// The first multiplication is exact, so that the result is only rounded once.
+template <typename T, typename Abi>
+Vc_ALWAYS_INLINE Vector<T, Abi> ldexp_wide(const Vector<T, Abi> &x,
+                                           const SimdArray<int, Vector<T, Abi>::Size> &n)
+{
+    using V = Vector<T, Abi>;
+    const SimdArray<int, V::Size> n1 = n >> 1;
+    return x * ldexp(V::One(), n1) * ldexp(V::One(), n - n1);
+}
+// }}}
+}  // namespace Detail
+
+// exp2 {{{
+template <typename T, typename Abi>
+inline Detail::enable_if_vector_math<T, Abi> exp2(const Vector<T, Abi> &x)
+{
+    using V = Vector<T, Abi>;
+    using Limits = std::numeric_limits<T>;
+
+    // 2ˣ = 2ⁿ * 2ʸ = 2ⁿ * e^(y * ln(2)) with n = ⌊x + ½⌋ and y = x - n ∈ [-½, ½]
+    const V n = floor(x + T(0.5));
+    const V y = (x - n) * T(0.693147180559945309417232121458176568);
+    V r = Detail::ldexp_wide(V::One() + Detail::expm1_reduced(y),
+                             static_cast<SimdArray<int, V::Size>>(n));
+
+    r(x >= T(Limits::max_exponent)) = Limits::infinity();
+    r.setZero(x < T(Limits::min_exponent - Limits::digits - 1));
+    // n = ⌊NaN⌋ converts to an arbitrary exponent (INT_MIN with SSE2), which overrides the
+    // NaN propagated through the polynomial
+    r(isnan(x)) = x;
+    return r;
+}
+
+// expm1 {{{
+template <typename T, typename Abi>
+inline Detail::enable_if_vector_math<T, Abi> expm1(const Vector<T, Abi> &x)
+{
+    using V = Vector<T, Abi>;
+    using Limits = std::numeric_limits<T>;
+    typedef Detail::Const<T, Abi> C;
+    constexpr T ln2 = T(0.693147180559945309417232121458176568);
+
+    // below -(digits + 3) * ln(2) the result rounds to -1, the clamp keeps n in the range
+    // supported by ldexp_wide
+    V xc = x;
+    xc(x < -T(Limits::digits + 3) * ln2) = -T(Limits::digits + 3) * ln2;
+
+    // eˣ - 1 = 2ⁿ * (eʸ - 1 + 1 - 2⁻ⁿ) with n = ⌊x * log₂(e) + ½⌋ and y = x - n * ln(2).
+    // 1 - 2⁻ⁿ is exact for -digits ≤ n. The eʸ - 1 term therefore only rounds once.
+    const V z = floor(C::log2_e() * xc + T(0.5));
+    const auto n = static_cast<SimdArray<int, V::Size>>(z);
+    V y = xc - z * C::ln2_large();
+    y -= z * C::ln2_small();
+    const V e = Detail::expm1_reduced(y);
+
+    V r = Detail::ldexp_wide(e + (V::One() - Detail::ldexp_wide(V::One(), -n)), n);
+    // for n < -digits the subtraction of 1 must come last
+    const auto small = xc < -T(Limits::digits) * ln2;
+    r(small) = Detail::ldexp_wide(V::One() + e, n) - V::One();
+
+    r(x > T(Limits::max_exponent) * ln2) = Limits::infinity();
+    r(x == V::Zero()) = x;  // preserve the sign of zero
+    return r;
+}
+// }}}
+
 #endif // Vc_COMMON_MATH_H_INTERNAL
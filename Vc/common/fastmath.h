@@ -0,0 +1,499 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifdef Vc_COMMON_MATH_H_INTERNAL
+
+/**
+ * \ingroup Math
+ *
+ * Low-precision tier of the exponential, logarithm, and trigonometric functions.
+ *
+ * The functions in this namespace have the same signatures as their counterparts in the
+ * Vc namespace, but trade accuracy and special-value handling for speed. They use a
+ * bit-level argument reduction and lower-degree polynomials, and skip the checks for
+ * NaN, infinities, and denormals. Out-of-range exponents are clamped instead: exp
+ * returns 0 where the result would be smaller than the smallest normalized number and
+ * +inf where it overflows; log, log2, and log10 return -inf for 0 and NaN for negative
+ * arguments. Results for other arguments outside the documented domain are unspecified.
+ * Select the tier by qualifying the call, e.g. `Vc::fast::exp(x)` instead of
+ * `Vc::exp(x)`.
+ *
+ * The maximum errors of the SSE and AVX implementations in the given domain are:
+ * | function | float   | double  | domain                          |
+ * |----------|--------:|--------:|---------------------------------|
+ * | exp      | 2.2 ulp | 3.7 ulp | [-87.3, 88.7] / [-708.3, 709.7] |
+ * | log      | 1.3 ulp | 2.3 ulp | positive normalized numbers     |
+ * | log2     | 2.4 ulp | 3.2 ulp | positive normalized numbers     |
+ * | log10    | 2.6 ulp | 3.3 ulp | positive normalized numbers     |
+ * | sin, cos | 2.4 ulp | 2 ulp   | [-8192, 8192]                   |
+ *
+ * The bounds of the precise tier are documented with the functions in the Vc namespace.
+ * AVX512 vectors apply the AVX implementation to both halves. The Scalar implementation
+ * and SimdArray types whose storage is not an SSE, AVX, or AVX512 vector forward to the
+ * precise tier.
+ */
+namespace fast
+{
+namespace Detail
+{
+// whether the fast kernels below implement Vector<T, Abi>
+template <typename T, typename Abi>
+using has_fast_kernel = std::integral_constant<
+    bool, std::is_floating_point<T>::value && (std::is_same<Abi, VectorAbi::Sse>::value ||
+                                               std::is_same<Abi, VectorAbi::Avx>::value)>;
+
+// fallback to the precise tier {{{
+template <typename V> Vc_INTRINSIC V exp(const V &x, std::false_type) { return Vc::exp(x); }
+template <typename V> Vc_INTRINSIC V log(const V &x, std::false_type) { return Vc::log(x); }
+template <typename V> Vc_INTRINSIC V log2(const V &x, std::false_type) { return Vc::log2(x); }
+template <typename V> Vc_INTRINSIC V log10(const V &x, std::false_type)
+{
+    return Vc::log10(x);
+}
+template <typename V> Vc_INTRINSIC V sin(const V &x, std::false_type) { return Vc::sin(x); }
+template <typename V> Vc_INTRINSIC V cos(const V &x, std::false_type) { return Vc::cos(x); }
+
+#ifdef Vc_IMPL_SSE
+// exp {{{
+// Reinterprets the bits of t shifted left by the number of explicit mantissa bits, i.e.
+// returns 2ᵏ⁻ᵇⁱᵃˢ for the integer k in the low bits of the mantissa of t.
+Vc_INTRINSIC __m128 shift_to_exponent(__m128 t)
+{
+    return _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(t), 23));
+}
+Vc_INTRINSIC __m128d shift_to_exponent(__m128d t)
+{
+    return _mm_castsi128_pd(_mm_slli_epi64(_mm_castpd_si128(t), 52));
+}
+#ifdef Vc_IMPL_AVX
+Vc_INTRINSIC __m256 shift_to_exponent(__m256 t)
+{
+    return AVX::avx_cast<__m256>(AVX::slli_epi32<23>(AVX::avx_cast<__m256i>(t)));
+}
+Vc_INTRINSIC __m256d shift_to_exponent(__m256d t)
+{
+    return AVX::avx_cast<__m256d>(AVX::slli_epi64<52>(AVX::avx_cast<__m256i>(t)));
+}
+#endif  // Vc_IMPL_AVX
+
+// eʸ = 1 + y + y² * Q(y) for y ∈ [-½ln(2), ½ln(2)], where Q is a minimax fit of
+// (eʸ - 1 - y) / y² for the relative error of eʸ: 1.05e-7 (float) / 2.9e-16 (double).
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<float, Abi> exp_reduced(const Vector<float, Abi> &y)
+{
+    Vector<float, Abi> q = 8.31252486e-3f;
+    q = q * y + 4.18901132e-2f;
+    q = q * y + 1.66671145e-1f;
+    q = q * y + 4.99992318e-1f;
+    return q * (y * y) + y + 1.f;
+}
+
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<double, Abi> exp_reduced(const Vector<double, Abi> &y)
+{
+    Vector<double, Abi> q = 2.7476799466393663e-07;
+    q = q * y + 2.7634990759281351e-06;
+    q = q * y + 2.4801931710809293e-05;
+    q = q * y + 1.9841185236260703e-04;
+    q = q * y + 1.3888888516233955e-03;
+    q = q * y + 8.3333333708700678e-03;
+    q = q * y + 4.1666666668136458e-02;
+    q = q * y + 1.6666666666611555e-01;
+    q = q * y + 4.9999999999998324e-01;
+    return q * (y * y) + y + 1.;
+}
+
+// eˣ = 2ⁿ * eʸ with n = x * log₂(e) rounded to nearest and y = x - n * ln(2).
+// Adding 1.5 * 2ᵈ⁻¹ (d = digits) rounds n into the low mantissa bits of t, offset such
+// that shifting them into the exponent field yields 2ⁿ⁻¹ directly. The clamp keeps the
+// biased exponent n - 1 + bias in [0, 2 * bias]: 0 flushes results below 2^min_exponent
+// to zero, 2ⁿ⁻¹ = 2^(max_exponent - 1) overflows to +∞ in the final doubling.
+template <typename T, typename Abi>
+Vc_ALWAYS_INLINE Vector<T, Abi> exp(const Vector<T, Abi> &x, std::true_type)
+{
+    using V = Vector<T, Abi>;
+    using C = Vc::Detail::Const<T, Abi>;
+    using L = std::numeric_limits<T>;
+    constexpr T ln2 = T(0.693147180559945309417232121458176568);
+    constexpr T shift = T(1.5) * T(1ull << (L::digits - 1)) + T(L::max_exponent - 2);
+    const V xc = min(max(x, V(T(L::min_exponent - 1.25) * ln2)),
+                     V(T(L::max_exponent + 0.25) * ln2));
+    const V t = xc * C::log2_e() + shift;
+    const V n = t - shift;
+    V y = xc - n * C::ln2_large();
+    y -= n * C::ln2_small();
+    const V r = exp_reduced(y) * V(shift_to_exponent(t.data()));
+    return r + r;
+}
+
+// log {{{
+// x = 2ᵉ * (1 + f) with 1 + f ∈ [√½, √2[, split on the bits of x: subtracting the
+// mantissa bits of √½ carries mantissas ≥ √2 into the exponent field, and adding them back
+// to the remaining mantissa bits (with the exponent of √½) yields 1 + f. Unlike
+// Vc::Detail::LogImpl this needs no compare and blend, and does not support zero,
+// negative, or denormal arguments. The float variant shifts arithmetically; SSE and AVX2
+// lack a 64-bit arithmetic shift, so the double variant keeps the bias of the exponent
+// field non-negative and subtracts it after the shift.
+Vc_INTRINSIC __m128 log_split(__m128 x, __m128 &e)
+{
+    const __m128i sqrt1_2 = _mm_set1_epi32(0x3f3504f3);
+    const __m128i ix = _mm_sub_epi32(_mm_castps_si128(x), sqrt1_2);
+    e = _mm_cvtepi32_ps(_mm_srai_epi32(ix, 23));
+    const __m128i m = _mm_add_epi32(_mm_and_si128(ix, _mm_set1_epi32(0x007fffff)), sqrt1_2);
+    return _mm_sub_ps(_mm_castsi128_ps(m), _mm_set1_ps(1.f));
+}
+Vc_INTRINSIC __m128d log_split(__m128d x, __m128d &e)
+{
+    const __m128i ix =
+        _mm_add_epi64(_mm_castpd_si128(x), _mm_set1_epi64x(-0x0006a09e667f3bcdll));
+    e = _mm_sub_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(_mm_srli_epi64(ix, 52), 0x08)),
+                   _mm_set1_pd(1022.));
+    const __m128i m = _mm_add_epi64(_mm_and_si128(ix, _mm_set1_epi64x(0x000fffffffffffffll)),
+                                    _mm_set1_epi64x(0x3fe6a09e667f3bcdll));
+    return _mm_sub_pd(_mm_castsi128_pd(m), _mm_set1_pd(1.));
+}
+#ifdef Vc_IMPL_AVX
+Vc_INTRINSIC __m256 log_split(__m256 x, __m256 &e)
+{
+    const __m256i sqrt1_2 = _mm256_set1_epi32(0x3f3504f3);
+    const __m256i ix = AVX::sub_epi32(AVX::avx_cast<__m256i>(x), sqrt1_2);
+    e = _mm256_cvtepi32_ps(AVX::srai_epi32<23>(ix));
+    const __m256i m =
+        AVX::add_epi32(AVX::and_si256(ix, _mm256_set1_epi32(0x007fffff)), sqrt1_2);
+    return _mm256_sub_ps(AVX::avx_cast<__m256>(m), _mm256_set1_ps(1.f));
+}
+Vc_INTRINSIC __m256d log_split(__m256d x, __m256d &e)
+{
+    const __m256i ix = AVX::add_epi64(AVX::avx_cast<__m256i>(x),
+                                      _mm256_set1_epi64x(-0x0006a09e667f3bcdll));
+    const __m256i biased = AVX::srli_epi64<52>(ix);
+    e = _mm256_sub_pd(
+        _mm256_cvtepi32_pd(AVX::avx_cast<__m128i>(
+            Mem::shuffle<X0, X2, Y0, Y2>(AVX::avx_cast<__m128>(AVX::lo128(biased)),
+                                         AVX::avx_cast<__m128>(AVX::hi128(biased))))),
+        _mm256_set1_pd(1022.));
+    const __m256i m =
+        AVX::add_epi64(AVX::and_si256(ix, _mm256_set1_epi64x(0x000fffffffffffffll)),
+                       _mm256_set1_epi64x(0x3fe6a09e667f3bcdll));
+    return _mm256_sub_pd(AVX::avx_cast<__m256d>(m), _mm256_set1_pd(1.));
+}
+#endif  // Vc_IMPL_AVX
+
+template <typename T, typename Abi>
+Vc_ALWAYS_INLINE Vector<T, Abi> log_split(const Vector<T, Abi> &x, Vector<T, Abi> &e)
+{
+    typename Vector<T, Abi>::VectorType ee;
+    const Vector<T, Abi> f = log_split(x.data(), ee);
+    e = ee;
+    return f;
+}
+
+// ln(1 + f) = f - ½f² + f³ * P(f) with a minimax fit of P for f ∈ [√½ - 1, √2 - 1]
+// (relative error 3.1e-8)
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<float, Abi> log1p_reduced(const Vector<float, Abi> &f,
+                                                  const Vector<float, Abi> &e)
+{
+    using C = Vc::Detail::Const<float, Abi>;
+    const Vector<float, Abi> f2 = f * f;
+    Vector<float, Abi> p = 8.91786839e-2f;
+    p = p * f - 1.43502001e-1f;
+    p = p * f + 1.48769610e-1f;
+    p = p * f - 1.65656347e-1f;
+    p = p * f + 1.99653981e-1f;
+    p = p * f - 2.50017469e-1f;
+    p = p * f + 3.33338581e-1f;
+    p = p * (f2 * f) + e * C::ln2_small();
+    p -= f2 * C::_1_2();
+    return f + p + e * C::ln2_large();
+}
+
+// ln(1 + f) = 2 atanh(s) with s = f / (2 + f), evaluated as in fdlibm:
+// ln(1 + f) = f - (½f² - s * (½f² + s² * R(s²))) with a minimax fit of R for
+// |s| ≤ 3 - 2√2 (relative error 1.9e-16).
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<double, Abi> log1p_reduced(const Vector<double, Abi> &f,
+                                                   const Vector<double, Abi> &e)
+{
+    using V = Vector<double, Abi>;
+    using C = Vc::Detail::Const<double, Abi>;
+    const V s = f / (f + 2.);
+    const V z = s * s;
+    V r = 1.6819827647307050e-01;
+    r = r * z + 1.8123642086761340e-01;
+    r = r * z + 2.2223371698167364e-01;
+    r = r * z + 2.8571417129583500e-01;
+    r = r * z + 4.0000000052274949e-01;
+    r = r * z + 6.6666666666587207e-01;
+    const V hfsq = f * f * C::_1_2();
+    return f - (hfsq - (s * (hfsq + z * r) + e * C::ln2_small())) + e * C::ln2_large();
+}
+
+// log(0) = -∞ and log(x < 0) = NaN
+template <typename T, typename Abi>
+Vc_ALWAYS_INLINE Vector<T, Abi> log_domain(const Vector<T, Abi> &x, Vector<T, Abi> r)
+{
+    using C = Vc::Detail::Const<T, Abi>;
+    r(x == Vector<T, Abi>::Zero()) = C::neginf();
+    r.setQnan(x < Vector<T, Abi>::Zero());
+    return r;
+}
+
+template <typename T, typename Abi>
+Vc_ALWAYS_INLINE Vector<T, Abi> log(const Vector<T, Abi> &x, std::true_type)
+{
+    Vector<T, Abi> e;
+    const Vector<T, Abi> f = log_split(x, e);
+    return log_domain(x, log1p_reduced(f, e));
+}
+
+template <typename T, typename Abi>
+Vc_ALWAYS_INLINE Vector<T, Abi> log2(const Vector<T, Abi> &x, std::true_type)
+{
+    using C = Vc::Detail::Const<T, Abi>;
+    Vector<T, Abi> e;
+    const Vector<T, Abi> f = log_split(x, e);
+    return log_domain(x, log1p_reduced(f, Vector<T, Abi>::Zero()) * C::log2_e() + e);
+}
+
+template <typename T, typename Abi>
+Vc_ALWAYS_INLINE Vector<T, Abi> log10(const Vector<T, Abi> &x, std::true_type)
+{
+    using C = Vc::Detail::Const<T, Abi>;
+    return log(x, std::true_type()) * C::log10_e();
+}
+
+// sin and cos {{{
+// π split into parts such that n * π_k is exact for the quotients n of the supported
+// domain (Cody & Waite).
+template <typename T> struct PiParts;
+template <> struct PiParts<float> {
+    static constexpr float a = 3.140625f;
+    static constexpr float b = 9.67025756835937500e-4f;
+    static constexpr float c = 6.27711415290832519531e-7f;
+    static constexpr float d = 1.21542012565534207e-10f;
+    static constexpr float inv = 3.18309886183790671538e-1f;
+};
+template <> struct PiParts<double> {
+    static constexpr double a = 3.1415926218032836914;
+    static constexpr double b = 3.1786509424591713469e-8;
+    static constexpr double c = 1.2246467864107188502e-16;
+    static constexpr double d = 1.2736634327021899816e-24;
+    static constexpr double inv = 3.18309886183790671538e-1;
+};
+
+// sin(r) = r + r³ * S(r²) for r ∈ [-½π, ½π] with a minimax fit of S (relative error)
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<float, Abi> sin_reduced(const Vector<float, Abi> &r)
+{
+    const Vector<float, Abi> z = r * r;
+    Vector<float, Abi> s = 2.60578064e-6f;
+    s = s * z - 1.98096029e-4f;
+    s = s * z + 8.33306625e-3f;
+    s = s * z - 1.66666596e-1f;
+    return s * (z * r) + r;
+}
+
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<double, Abi> sin_reduced(const Vector<double, Abi> &r)
+{
+    const Vector<double, Abi> z = r * r;
+    Vector<double, Abi> s = 2.7211749805385572e-15;
+    s = s * z - 7.642991491042833e-13;
+    s = s * z + 1.605893970596475e-10;
+    s = s * z - 2.5052106872803646e-08;
+    s = s * z + 2.755731921113729e-06;
+    s = s * z - 1.9841269841209218e-04;
+    s = s * z + 8.333333333333194e-03;
+    s = s * z - 1.6666666666666666e-01;
+    return s * (z * r) + r;
+}
+
+// Returns x - q * ½π for the odd (cos) or even (sin) multiple q of ½π nearest to x. The
+// sine of the result has the sign of sin(x) if q/2 (sin) or (q - 1)/2 (cos) is odd and
+// the opposite sign otherwise; that is folded into the returned value.
+template <bool Cos, typename T, typename Abi>
+Vc_ALWAYS_INLINE Vector<T, Abi> sin_reduce(const Vector<T, Abi> &x)
+{
+    using V = Vector<T, Abi>;
+    using Pi = PiParts<T>;
+    // sin: x = nπ + r,        sin(x) = (-1)ⁿ sin(r)
+    // cos: x = (n + ½)π + r,  cos(x) = (-1)ⁿ⁺¹ sin(r)
+    constexpr T inv = Pi::inv, a = Pi::a, b = Pi::b, c = Pi::c, d = Pi::d;
+    const V n = Cos ? round(x * inv - T(0.5)) : round(x * inv);
+    const V q = Cos ? n + T(0.5) : n;
+    V r = x - q * a;
+    r -= q * b;
+    r -= q * c;
+    r -= q * d;
+    // n - 2 * round(½n) is ±1 for odd n and 0 for even n
+    const auto odd = n != T(2) * round(n * T(0.5));
+    r(Cos ? !odd : odd) = -r;
+    return r;
+}
+
+template <typename T, typename Abi>
+Vc_ALWAYS_INLINE Vector<T, Abi> sin(const Vector<T, Abi> &x, std::true_type)
+{
+    return sin_reduced(sin_reduce<false>(x));
+}
+
+template <typename T, typename Abi>
+Vc_ALWAYS_INLINE Vector<T, Abi> cos(const Vector<T, Abi> &x, std::true_type)
+{
+    return sin_reduced(sin_reduce<true>(x));
+}
+
+#ifdef Vc_IMPL_AVX512
+// There are no zmm variants of the kernels yet, thus both halves use the AVX kernels.
+#define Vc_FAST_MATH_SPLIT_(name_)                                                       \
+    template <typename T>                                                                \
+    Vc_ALWAYS_INLINE AVX512::Vector<T> name_(const AVX512::Vector<T> &x,                 \
+                                             std::false_type)                            \
+    {                                                                                    \
+        return simd_cast<AVX512::Vector<T>>(                                             \
+            name_(simd_cast<AVX2::Vector<T>, 0>(x), std::true_type()),                   \
+            name_(simd_cast<AVX2::Vector<T>, 1>(x), std::true_type()));                  \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+Vc_FAST_MATH_SPLIT_(exp);
+Vc_FAST_MATH_SPLIT_(log);
+Vc_FAST_MATH_SPLIT_(log2);
+Vc_FAST_MATH_SPLIT_(log10);
+Vc_FAST_MATH_SPLIT_(sin);
+Vc_FAST_MATH_SPLIT_(cos);
+#undef Vc_FAST_MATH_SPLIT_
+#endif  // Vc_IMPL_AVX512
+#endif  // Vc_IMPL_SSE
+// }}}
+}  // namespace Detail
+
+// Vector overloads {{{
+#define Vc_FAST_MATH_FUNCTION_(name_)                                                    \
+    template <typename T, typename Abi,                                                  \
+              typename = enable_if<std::is_floating_point<T>::value>>                    \
+    Vc_INTRINSIC Vector<T, detail::not_fixed_size_abi<Abi>> name_(                       \
+        const Vector<T, Abi> &x)                                                         \
+    {                                                                                    \
+        return Detail::name_(x, Detail::has_fast_kernel<T, Abi>());                      \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+
+/// \copydoc Vc::exp
+/// \note Accurate for \p x in [-87.3, 88.7] (float) or [-708.3, 709.7] (double);
+/// smaller arguments return 0, larger ones +inf.
+Vc_FAST_MATH_FUNCTION_(exp);
+/// \copydoc Vc::log
+/// \note Accurate for positive normalized \p x; returns -inf for 0 and NaN for
+/// negative \p x.
+Vc_FAST_MATH_FUNCTION_(log);
+/// \copydoc Vc::log2
+/// \note Accurate for positive normalized \p x; returns -inf for 0 and NaN for
+/// negative \p x.
+Vc_FAST_MATH_FUNCTION_(log2);
+/// \copydoc Vc::log10
+/// \note Accurate for positive normalized \p x; returns -inf for 0 and NaN for
+/// negative \p x.
+Vc_FAST_MATH_FUNCTION_(log10);
+/// \copydoc Vc::sin
+/// \note Requires \p x to lie in [-8192, 8192].
+Vc_FAST_MATH_FUNCTION_(sin);
+/// \copydoc Vc::cos
+/// \note Requires \p x to lie in [-8192, 8192].
+Vc_FAST_MATH_FUNCTION_(cos);
+#undef Vc_FAST_MATH_FUNCTION_
+
+/// \copydoc Vc::sincos
+/// \note Requires \p x to lie in [-8192, 8192].
+template <typename T, typename Abi, typename = enable_if<std::is_floating_point<T>::value>>
+Vc_INTRINSIC void sincos(const Vector<T, Abi> &x,
+                         Vector<T, detail::not_fixed_size_abi<Abi>> *sin,
+                         Vector<T, Abi> *cos)
+{
+    *sin = Detail::sin(x, Detail::has_fast_kernel<T, Abi>());
+    *cos = Detail::cos(x, Detail::has_fast_kernel<T, Abi>());
+}
+
+// SimdArray overloads {{{
+namespace Detail
+{
+#define Vc_FAST_MATH_FORWARD_(name_)                                                     \
+    struct Forward_##name_ : public Common::Operations::tag {                            \
+        template <typename V, typename = decltype(fast::name_(std::declval<V>()))>       \
+        Vc_INTRINSIC void operator()(V &r, const V &x)                                   \
+        {                                                                                \
+            r = fast::name_(x);                                                          \
+        }                                                                                \
+    }
+Vc_FAST_MATH_FORWARD_(exp);
+Vc_FAST_MATH_FORWARD_(log);
+Vc_FAST_MATH_FORWARD_(log2);
+Vc_FAST_MATH_FORWARD_(log10);
+Vc_FAST_MATH_FORWARD_(sin);
+Vc_FAST_MATH_FORWARD_(cos);
+#undef Vc_FAST_MATH_FORWARD_
+
+struct Forward_sincos : public Common::Operations::tag {
+    template <typename V, typename = decltype(fast::sin(std::declval<V>()))>
+    Vc_INTRINSIC void operator()(std::nullptr_t, const V &x, V *s, V *c)
+    {
+        fast::sincos(x, s, c);
+    }
+};
+}  // namespace Detail
+
+#define Vc_FAST_MATH_FUNCTION_(name_)                                                    \
+    template <typename T, std::size_t N, typename V, std::size_t M>                      \
+    inline fixed_size_simd<T, N> name_(const SimdArray<T, N, V, M> &x)                   \
+    {                                                                                    \
+        return fixed_size_simd<T, N>::fromOperation(Detail::Forward_##name_(), x);       \
+    }                                                                                    \
+    template <class T, int N>                                                            \
+    inline fixed_size_simd<T, N> name_(const fixed_size_simd<T, N> &x)                   \
+    {                                                                                    \
+        return fixed_size_simd<T, N>::fromOperation(Detail::Forward_##name_(), x);       \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+Vc_FAST_MATH_FUNCTION_(exp);
+Vc_FAST_MATH_FUNCTION_(log);
+Vc_FAST_MATH_FUNCTION_(log2);
+Vc_FAST_MATH_FUNCTION_(log10);
+Vc_FAST_MATH_FUNCTION_(sin);
+Vc_FAST_MATH_FUNCTION_(cos);
+#undef Vc_FAST_MATH_FUNCTION_
+
+template <typename T, std::size_t N>
+inline void sincos(const SimdArray<T, N> &x, SimdArray<T, N> *sin, SimdArray<T, N> *cos)
+{
+    SimdArray<T, N>::callOperation(Detail::Forward_sincos(), x, sin, cos);
+}
+// }}}
+}  // namespace fast
+
+#endif // Vc_COMMON_MATH_H_INTERNAL
+
+// vim: foldmethod=marker
@@ -39,13 +39,25 @@ enum class GatherScatterImplementation : int {
     SimpleLoop,
     SetIndexZero,
     BitScanLoop,
-    PopcntSwitch
+    PopcntSwitch,
+    Adaptive
 };
 
 using SimpleLoopT   = std::integral_constant<GatherScatterImplementation, GatherScatterImplementation::SimpleLoop>;
 using SetIndexZeroT = std::integral_constant<GatherScatterImplementation, GatherScatterImplementation::SetIndexZero>;
 using BitScanLoopT  = std::integral_constant<GatherScatterImplementation, GatherScatterImplementation::BitScanLoop>;
 using PopcntSwitchT = std::integral_constant<GatherScatterImplementation, GatherScatterImplementation::PopcntSwitch>;
+using AdaptiveT     = std::integral_constant<GatherScatterImplementation, GatherScatterImplementation::Adaptive>;
+
+/* The Adaptive strategy selects one of the above at runtime from the number of set mask
+ * bits:
+ * - all bits set: the unmasked gather/scatter of the vector type
+ * - at most AdaptiveSparseLimit bits set: BitScanLoop, which only touches the set lanes
+ * - otherwise: PopcntSwitch, whose jump table avoids a branch per lane
+ */
+template <typename V>
+using AdaptiveSparseLimit =
+    std::integral_constant<std::size_t, (V::Size / 4 > 1 ? V::Size / 4 : 1)>;
 
 template <typename V, typename MT, typename IT>
 Vc_ALWAYS_INLINE void executeGather(SetIndexZeroT,
@@ -312,6 +324,23 @@ Vc_ALWAYS_INLINE void executeGather(PopcntSwitchT,
     }
 }
 
+template <typename V, typename MT, typename IT>
+Vc_ALWAYS_INLINE void executeGather(AdaptiveT,
+                                    V &v,
+                                    const MT *mem,
+                                    const IT &indexes,
+                                    typename V::MaskArgument mask)
+{
+    const std::size_t count = mask.count();
+    if (count == V::Size) {
+        v.gather(mem, indexes);
+    } else if (count <= AdaptiveSparseLimit<V>::value) {
+        executeGather(BitScanLoopT(), v, mem, indexes, mask);
+    } else {
+        executeGather(PopcntSwitchT(), v, mem, indexes, mask);
+    }
+}
+
 }  // namespace Common
 }  // namespace Vc
 
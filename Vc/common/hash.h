@@ -0,0 +1,400 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_HASH_H_
+#define VC_COMMON_HASH_H_
+
+#include <cstdint>
+#include <vector>
+#include "../vector.h"
+#include "simdarray.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// hash input and result types {{{1
+template <typename T, bool = is_simd_vector<T>::value> struct HashResult {
+};
+template <typename T> struct HashResult<T, false> {
+    static_assert(std::is_same<T, uint>::value || std::is_same<T, ushort>::value,
+                  "the hash functions require uint or ushort keys");
+    using type = uint;
+};
+template <typename V> struct HashResult<V, true> {
+    static_assert(std::is_same<typename V::EntryType, uint>::value ||
+                      std::is_same<typename V::EntryType, ushort>::value,
+                  "the hash functions require uint or ushort keys");
+    using type = typename std::conditional<std::is_same<typename V::EntryType, uint>::value,
+                                           V, SimdArray<uint, V::Size>>::type;
+};
+template <typename T> using hash_result = typename HashResult<T>::type;
+
+// zero-extends the keys to 32 bits
+template <typename T> Vc_INTRINSIC hash_result<T> widenHashInput(const T &x)
+{
+    return static_cast<hash_result<T>>(x);
+}
+template <typename T, typename Abi>
+Vc_INTRINSIC hash_result<Vector<T, Abi>> widenHashInput(const Vector<T, Abi> &x)
+{
+    return simd_cast<hash_result<Vector<T, Abi>>>(x);
+}
+template <typename T, std::size_t N>
+Vc_INTRINSIC hash_result<SimdArray<T, N>> widenHashInput(const SimdArray<T, N> &x)
+{
+    return simd_cast<hash_result<SimdArray<T, N>>>(x);
+}
+
+template <typename T, bool = is_simd_vector<T>::value> struct HashEntryType {
+    using type = T;
+};
+template <typename V> struct HashEntryType<V, true> {
+    using type = typename V::EntryType;
+};
+template <typename T> using hash_entry_type = typename HashEntryType<T>::type;
+
+template <typename V> Vc_INTRINSIC V rotl32(const V &x, int n)
+{
+    return (x << n) | (x >> (32 - n));
+}
+
+// crc32c {{{1
+#ifdef Vc_IMPL_SSE4_2
+Vc_INTRINSIC uint crc32cUpdate(uint crc, uint key) { return _mm_crc32_u32(crc, key); }
+Vc_INTRINSIC uint crc32cUpdate(uint crc, ushort key) { return _mm_crc32_u16(crc, key); }
+#else
+template <typename T> Vc_INTRINSIC uint crc32cUpdate(uint crc, T key)
+{
+    crc ^= key;
+    for (std::size_t i = 0; i < 8 * sizeof(T); ++i) {
+        crc = (crc >> 1) ^ (0x82F63B78u & (0u - (crc & 1)));
+    }
+    return crc;
+}
+#endif
+
+template <typename T> Vc_INTRINSIC uint crc32c(const T &key, uint crc, std::false_type)
+{
+    return ~crc32cUpdate(~crc, key);
+}
+template <typename V> Vc_INTRINSIC hash_result<V> crc32c(const V &keys, uint crc, std::true_type)
+{
+    using R = hash_result<V>;
+    using T = typename V::EntryType;
+#ifdef Vc_IMPL_SSE4_2
+    // the crc32 instruction on every lane beats the bitwise algorithm on vectors
+    return R::generate([&](std::size_t i) { return ~crc32cUpdate(~crc, T(keys[i])); });
+#else
+    R c = R(~crc) ^ widenHashInput(keys);
+    for (std::size_t i = 0; i < 8 * sizeof(T); ++i) {
+        c = (c >> 1) ^ (R(0x82F63B78u) & (R(0) - (c & 1)));
+    }
+    return ~c;
+#endif
+}
+//}}}1
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile hash.h <Vc/Vc>
+ *
+ * Returns the MurmurHash3 finalizer (fmix32) of every entry of \p keys.
+ *
+ * fmix32 is a bijection on 32-bit values with full avalanche, i.e. every input bit
+ * flips every output bit with a probability of about 50%. It is the cheapest of the hash
+ * functions here and suffices for hash tables with power-of-two bucket counts.
+ *
+ * \param keys A \c uint or \c ushort value, Vector, or SimdArray. \c ushort keys are
+ *             zero-extended and thus hashed to a \c uint result of the same width.
+ */
+template <typename V> Vc_ALWAYS_INLINE Detail::hash_result<V> hash_murmur3(const V &keys)
+{
+    auto h = Detail::widenHashInput(keys);
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile hash.h <Vc/Vc>
+ *
+ * Returns the XXH32 hash of the bytes of every entry of \p keys, i.e. the same value as
+ * `XXH32(&key, sizeof(key), seed)` on a little-endian machine.
+ *
+ * \param keys A \c uint or \c ushort value, Vector, or SimdArray.
+ * \param seed The XXH32 seed.
+ */
+template <typename V>
+Vc_ALWAYS_INLINE Detail::hash_result<V> hash_xxh32(const V &keys, uint seed = 0)
+{
+    using R = Detail::hash_result<V>;
+    constexpr uint Prime1 = 2654435761u;
+    constexpr uint Prime2 = 2246822519u;
+    constexpr uint Prime3 = 3266489917u;
+    constexpr uint Prime4 = 668265263u;
+    constexpr uint Prime5 = 374761393u;
+    constexpr uint Length = sizeof(Detail::hash_entry_type<V>);
+    const R k = Detail::widenHashInput(keys);
+    R h = R(seed + Prime5 + Length);
+    if (Length == 4) {
+        h += k * Prime3;
+        h = Detail::rotl32(h, 17) * Prime4;
+    } else {
+        h += (k & 0xffu) * Prime5;
+        h = Detail::rotl32(h, 11) * Prime1;
+        h += (k >> 8) * Prime5;
+        h = Detail::rotl32(h, 11) * Prime1;
+    }
+    h ^= h >> 15;
+    h *= Prime2;
+    h ^= h >> 13;
+    h *= Prime3;
+    h ^= h >> 16;
+    return h;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile hash.h <Vc/Vc>
+ *
+ * Returns the CRC-32C (Castagnoli) checksum of the bytes of every entry of \p keys.
+ *
+ * With SSE4.2 every lane uses the \c crc32 instruction, otherwise all lanes run the
+ * bitwise algorithm in parallel.
+ *
+ * \param keys A \c uint or \c ushort value, Vector, or SimdArray.
+ * \param crc  The checksum of preceding data, to continue a checksum over several keys.
+ */
+template <typename V>
+Vc_ALWAYS_INLINE Detail::hash_result<V> hash_crc32c(const V &keys, uint crc = 0)
+{
+    return Detail::crc32c(keys, crc, is_simd_vector<V>());
+}
+
+/**
+ * \ingroup Containers
+ * \headerfile hash.h <Vc/Vc>
+ *
+ * An open-addressing hash table with \c uint keys for vectorized lookups, e.g. the probe
+ * phase of a hash join.
+ *
+ * Keys and values are stored interleaved in one array of buckets, thus a successful
+ * lookup touches a single cache line. Lookups of a whole vector of keys hash the keys
+ * with hash_murmur3 and gather the bucket keys. Lanes that hit their key or an empty
+ * bucket are done; the remaining lanes retry with the next bucket (linear probing),
+ * until the mask of active lanes is empty. The range overload of find looks up one
+ * vector of keys after the other; since their probes are independent, the gathers of
+ * consecutive vectors can be in flight at the same time.
+ *
+ * Inserting is scalar. The table grows to keep its load factor at most 1/2, which
+ * bounds the expected number of probes per lookup by 2.5 for misses.
+ *
+ * \tparam Value A type that SimdArray supports: \c float, \c double, \c int, \c uint,
+ *               \c short, or \c ushort.
+ */
+template <typename Value> class simd_hash_table
+{
+    static_assert(Traits::is_valid_vector_argument<Value>::value,
+                  "simd_hash_table requires a Value type that SimdArray supports (float, "
+                  "double, int, uint, short, or ushort)");
+
+    struct Bucket {
+        uint key;
+        Value value;
+    };
+    static_assert(sizeof(Bucket) % sizeof(uint) == 0 && sizeof(Bucket) % sizeof(Value) == 0,
+                  "the bucket layout does not allow gathers of keys and values");
+    // distance of consecutive buckets in units of the key and value types (the scale
+    // operand of the AVX2 gather instructions cannot express 16-byte strides)
+    static constexpr uint KeyScale = sizeof(Bucket) / sizeof(uint);
+    static constexpr uint ValueScale = sizeof(Bucket) / sizeof(Value);
+
+public:
+    using key_type = uint;
+    using mapped_type = Value;
+
+    /**
+     * Constructs an empty table with room for \p expectedSize keys before it grows.
+     *
+     * \param emptyKey A key value that marks empty buckets. It cannot be inserted.
+     */
+    explicit simd_hash_table(std::size_t expectedSize = 0, uint emptyKey = ~0u)
+        : m_emptyKey(emptyKey)
+    {
+        std::size_t n = 16;
+        while (n < 2 * expectedSize) {
+            n *= 2;
+        }
+        m_buckets.assign(n, Bucket{emptyKey, Value()});
+        m_mask = uint(n - 1);
+    }
+
+    /// Returns the number of keys in the table.
+    std::size_t size() const { return m_size; }
+    /// Returns the number of buckets (a power of two).
+    std::size_t bucket_count() const { return m_buckets.size(); }
+    /// Returns the key value that marks empty buckets.
+    uint empty_key() const { return m_emptyKey; }
+
+    /**
+     * Inserts \p key with \p value, or replaces the value if \p key is already present.
+     *
+     * \returns \c true if \p key was inserted, \c false if its value was replaced.
+     */
+    bool insert(uint key, Value value)
+    {
+        Vc_ASSERT(key != m_emptyKey);
+        if (2 * (m_size + 1) > m_buckets.size()) {
+            rehash(2 * m_buckets.size());
+        }
+        for (uint h = hash_murmur3(key) & m_mask;; h = (h + 1) & m_mask) {
+            Bucket &b = m_buckets[h];
+            if (b.key == key) {
+                b.value = value;
+                return false;
+            } else if (b.key == m_emptyKey) {
+                b = {key, value};
+                ++m_size;
+                return true;
+            }
+        }
+    }
+
+    /// Looks up one key. Writes the value to \p value if it is found.
+    bool find(uint key, Value &value) const
+    {
+        if (key == m_emptyKey) {
+            return false;
+        }
+        for (uint h = hash_murmur3(key) & m_mask;; h = (h + 1) & m_mask) {
+            const Bucket &b = m_buckets[h];
+            if (b.key == key) {
+                value = b.value;
+                return true;
+            } else if (b.key == m_emptyKey) {
+                return false;
+            }
+        }
+    }
+
+    /**
+     * Looks up every entry of \p keys.
+     *
+     * \param keys   A \c uint Vector or SimdArray.
+     * \param values A Vector or SimdArray of \p Value with the same number of entries.
+     *               The entries of found keys are overwritten, the others are unchanged.
+     * \returns The mask of found keys.
+     */
+    template <typename KeyV, typename ValueV>
+    typename KeyV::mask_type find(const KeyV &keys, ValueV &values) const
+    {
+        static_assert(std::is_same<typename KeyV::EntryType, uint>::value,
+                      "the keys must be a uint vector");
+        static_assert(std::is_same<typename ValueV::EntryType, Value>::value &&
+                          KeyV::Size == ValueV::Size,
+                      "the values must be a vector of Value with the size of the keys");
+        using M = typename KeyV::mask_type;
+        const KeyV empty = m_emptyKey;
+        const KeyV mask = m_mask;
+        KeyV h = hash_murmur3(keys) & mask;
+        M active = keys != empty;
+        M found(false);
+        while (any_of(active)) {
+            // Every h is a valid bucket index, thus the gathers need no mask. Without mask
+            // AVX2 uses the gather instructions instead of a loop over the active lanes.
+            const KeyV bucketKeys(&m_buckets[0].key, h * KeyScale);
+            const M hit = active & (bucketKeys == keys);
+            if (any_of(hit)) {
+                const ValueV bucketValues(&m_buckets[0].value, h * ValueScale);
+                values(simd_cast<typename ValueV::mask_type>(hit)) = bucketValues;
+                found |= hit;
+            }
+            active &= !(hit | (bucketKeys == empty));
+            h = (h + 1) & mask;
+        }
+        return found;
+    }
+
+    /**
+     * Looks up the \p n keys at \p keys and writes their values to \p values, or \p
+     * missing for keys that are not in the table.
+     *
+     * \returns The number of found keys.
+     */
+    std::size_t find(const uint *keys, std::size_t n, Value *values,
+                     Value missing = Value()) const
+    {
+        using KeyV = uint_v;
+        using ValueV = SimdArray<Value, KeyV::Size>;
+        std::size_t count = 0;
+        std::size_t next = 0;
+        // The probes of consecutive vectors are independent of each other, which lets
+        // the gathers of several vectors be in flight at the same time.
+        for (; next + KeyV::Size <= n; next += KeyV::Size) {
+            ValueV v = missing;
+            count += find(KeyV(keys + next, Vc::Unaligned), v).count();
+            v.store(values + next, Vc::Unaligned);
+        }
+        for (; next < n; ++next) {
+            values[next] = missing;
+            count += find(keys[next], values[next]);
+        }
+        return count;
+    }
+
+private:
+    void rehash(std::size_t n)
+    {
+        Vc_ASSERT(n * KeyScale <= std::size_t(1) << 31);
+        std::vector<Bucket> old(n, Bucket{m_emptyKey, Value()});
+        old.swap(m_buckets);
+        m_mask = uint(n - 1);
+        m_size = 0;
+        for (const Bucket &b : old) {
+            if (b.key != m_emptyKey) {
+                insert(b.key, b.value);
+            }
+        }
+    }
+
+    std::vector<Bucket> m_buckets;
+    std::size_t m_size = 0;
+    uint m_mask;
+    uint m_emptyKey;
+};
+}  // namespace Vc
+
+#endif  // VC_COMMON_HASH_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,230 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_HISTOGRAM_H_
+#define VC_COMMON_HISTOGRAM_H_
+
+#include <climits>
+#include <iterator>
+#include <limits>
+#include <vector>
+#include "../vector.h"
+#include "simdarray.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// hasEqualIndexes {{{1
+// Returns whether any two lanes of indexes are equal. Rotations by up to half the size
+// compare every pair of lanes.
+template <typename IT> Vc_INTRINSIC bool hasEqualIndexes(const IT &indexes)
+{
+    typename IT::mask_type equal(false);
+    Common::unrolled_loop<std::size_t, 1, IT::Size / 2 + 1>(
+        [&](std::size_t r) { equal |= indexes == indexes.rotated(r); });
+    return any_of(equal);
+}
+
+// sumEqualIndexes {{{1
+// Returns in every lane the sum of the values of all lanes with the same index. Lanes
+// with equal indexes thus hold equal values, and a scatter of the result stores the
+// same value for all of them, independent of the order of the stores.
+template <typename IT, typename V>
+Vc_INTRINSIC V sumEqualIndexes(const IT &indexes, const V &values)
+{
+    using M = typename V::mask_type;
+    V sum = values;
+    Common::unrolled_loop<std::size_t, 1, V::Size>([&](std::size_t r) {
+        sum(simd_cast<M>(indexes == indexes.rotated(r))) += values.rotated(r);
+    });
+    return sum;
+}
+}  // namespace Detail
+
+// scatter_add {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile histogram.h <Vc/Vc>
+ *
+ * Adds the entries of \p values to `mem[indexes[i]]`.
+ *
+ * In contrast to the scatter member functions, \p indexes may contain duplicates: the
+ * values of all lanes with equal indexes are summed before the store, so that every
+ * addition is accounted for. The check for duplicates costs `V::Size / 2` rotations and
+ * compares of the index vector, their summation another `V::Size - 1`.
+ *
+ * \param mem     The array to add to.
+ * \param indexes A SIMD vector of indexes into \p mem with the same number of entries
+ *                as \p values.
+ * \param values  The values to add.
+ */
+template <typename T, typename IT, typename V>
+Vc_ALWAYS_INLINE enable_if<is_simd_vector<V>::value, void> scatter_add(T *mem,
+                                                                    const IT &indexes,
+                                                                    const V &values)
+{
+    static_assert(std::is_same<T, typename V::EntryType>::value,
+                  "scatter_add requires the entry type of the values as memory type");
+    static_assert(IT::Size == V::Size,
+                  "scatter_add requires as many indexes as values");
+    V sum = V(mem, indexes);
+    if (Vc_IS_UNLIKELY(Detail::hasEqualIndexes(indexes))) {
+        sum += Detail::sumEqualIndexes(indexes, values);
+    } else {
+        sum += values;
+    }
+    sum.scatter(mem, indexes);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile histogram.h <Vc/Vc>
+ *
+ * Adds the entries of \p values selected by \p mask to `mem[indexes[i]]`. The indexes
+ * of the lanes that are not selected are not accessed.
+ */
+template <typename T, typename IT, typename V>
+Vc_ALWAYS_INLINE enable_if<is_simd_vector<V>::value, void> scatter_add(
+    T *mem, const IT &indexes, V values, const typename V::mask_type &mask)
+{
+    static_assert(std::is_same<T, typename V::EntryType>::value,
+                  "scatter_add requires the entry type of the values as memory type");
+    static_assert(IT::Size == V::Size,
+                  "scatter_add requires as many indexes as values");
+    V sum = V(0);
+    sum.gather(mem, indexes, mask);
+    values.setZeroInverted(mask);
+    if (Vc_IS_UNLIKELY(Detail::hasEqualIndexes(indexes))) {
+        sum += Detail::sumEqualIndexes(indexes, values);
+    } else {
+        sum += values;
+    }
+    sum.scatter(mem, indexes, mask);
+}
+
+// simd_histogram {{{1
+namespace Detail
+{
+// The number of bins up to which simd_histogram counts into a private table with one
+// counter per bin and lane.
+template <std::size_t Size>
+using histogram_private_limit = std::integral_constant<std::size_t, 16384 / Size>;
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile histogram.h <Vc/Vc>
+ *
+ * Counts the occurrences of the integral values in [\p first, \p last): for every
+ * value \c x with `0 <= x < binsLast - binsFirst` the bin `binsFirst[x]` is
+ * incremented. Values outside of this range are ignored.
+ *
+ * For up to a few thousand bins every vector lane counts into its own copy of the
+ * bins, so that equal values never conflict, neither within a vector nor in
+ * consecutive increments of the same counter, and the copies are summed at the end.
+ * Larger histograms are filled with scatter_add.
+ *
+ * \param first, last          A contiguous range of \c int, \c uint, \c short, or \c
+ *                             ushort values.
+ * \param binsFirst, binsLast  A contiguous range of counters of a type that Vc
+ *                             vectors support (e.g. \c uint or \c float).
+ */
+template <class InputIt, class OutputIt,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type,
+          class BinType = typename std::iterator_traits<OutputIt>::value_type>
+inline void simd_histogram(InputIt first, InputIt last, OutputIt binsFirst,
+                           OutputIt binsLast)
+{
+    static_assert(std::is_integral<ValueType>::value && sizeof(ValueType) <= 4,
+                  "simd_histogram requires 16- or 32-bit integral values");
+    // uint values >= 2^31 convert to negative ints and are thus out of range as well
+    using IV = int_v;
+    const std::size_t n = last - first;
+    const std::size_t nbins = binsLast - binsFirst;
+    if (n == 0 || nbins == 0) {
+        return;
+    }
+    const ValueType *values = std::addressof(*first);
+    BinType *bins = std::addressof(*binsFirst);
+    const IV binCount = IV(int(std::min<std::size_t>(nbins, INT_MAX)));
+    std::size_t i = 0;
+    if (nbins <= Detail::histogram_private_limit<IV::Size>::value) {
+        // Out of range values count into the additional bin nbins, which is never read.
+        using CV = SimdArray<uint, IV::Size>;
+        std::vector<uint> counts((nbins + 1) * IV::Size);
+        const IV lane = IV::IndexesFromZero();
+        for (; i + IV::Size <= n;) {
+            // flush before the counters could overflow
+            const std::size_t chunkEnd =
+                i + std::min<std::size_t>(n - i, std::numeric_limits<uint>::max());
+            for (; i + IV::Size <= chunkEnd; i += IV::Size) {
+                const IV x(values + i, Vc::Unaligned);
+                const IV idx =
+                    iif(x >= 0 && x < binCount, x, binCount) * int(IV::Size) + lane;
+                // The increments of the lanes never conflict. Scalar increments are
+                // cheaper than a gather and scatter on targets without a scatter
+                // instruction.
+                alignas(MemoryAlignment) int idxs[IV::Size];
+                idx.store(idxs, Vc::Aligned);
+                for (std::size_t j = 0; j < IV::Size; ++j) {
+                    ++counts[idxs[j]];
+                }
+            }
+            for (std::size_t b = 0; b < nbins; ++b) {
+                bins[b] += BinType(CV(&counts[b * IV::Size], Vc::Unaligned).sum());
+            }
+            std::fill(counts.begin(), counts.end(), 0u);
+        }
+    } else {
+        using BV = SimdArray<BinType, IV::Size>;
+        using BM = typename BV::mask_type;
+        for (; i + IV::Size <= n; i += IV::Size) {
+            const IV x(values + i, Vc::Unaligned);
+            const auto inRange = x >= 0 && x < binCount;
+            if (Vc_IS_LIKELY(all_of(inRange))) {
+                scatter_add(bins, x, BV(1));
+            } else {
+                scatter_add(bins, x, BV(1), simd_cast<BM>(inRange));
+            }
+        }
+    }
+    for (; i < n; ++i) {
+        // converted to int like in the vector loops
+        const int x = int(values[i]);
+        if (x >= 0 && std::size_t(x) < nbins) {
+            ++bins[x];
+        }
+    }
+}
+// }}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_HISTOGRAM_H_
+
+// vim: foldmethod=marker
@@ -100,6 +100,19 @@ struct load_concept : public std::enable_if<
 public:
 template <typename U, typename Flags = DefaultLoadTag>
 Vc_INTRINSIC_L typename load_concept<U, Flags>::type load(const U *mem, Flags = Flags()) Vc_INTRINSIC_R;
+
+/**
+ * Load consecutive values from \p mem into the entries where \p mask is set.
+ *
+ * This is the inverse of compress_store: the first value is loaded into the first selected
+ * entry, the second value into the second selected entry, and so on. Entries where \p mask
+ * is \c false keep their previous value.
+ *
+ * \param mem A pointer to at least `mask.count()` values. No memory after them is read.
+ * \param mask Determines the entries that are overwritten.
+ * \return The number of values read from \p mem, i.e. `mask.count()`.
+ */
+Vc_INTRINSIC_L int Vc_VDECL expand_load(const EntryType *mem, MaskType mask) Vc_INTRINSIC_R;
 //}}}1
 
 // vim: foldmethod=marker
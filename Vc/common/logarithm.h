@@ -65,6 +65,14 @@ template <typename T, typename Abi>
 using Const = typename std::conditional<std::is_same<Abi, VectorAbi::Avx>::value,
                                         AVX::Const<T>, SSE::Const<T>>::type;
 
+// return type of the log1p, exp2, expm1, pow, and cbrt overloads for SSE and AVX
+template <typename T, typename Abi>
+using enable_if_vector_math =
+    enable_if<std::is_floating_point<T>::value &&
+                  (std::is_same<Abi, VectorAbi::Sse>::value ||
+                   std::is_same<Abi, VectorAbi::Avx>::value),
+              Vector<T, detail::not_fixed_size_abi<Abi>>>;
+
 template<LogarithmBase Base>
 struct LogImpl
 {
@@ -273,4 +281,17 @@ Vc_INTRINSIC Vc_CONST Vector<T, detail::not_fixed_size_abi<Abi>> log2(
     return Detail::LogImpl<Base2>::calc<T, Abi>(x);
 }
 
+template <typename T, typename Abi>
+inline Detail::enable_if_vector_math<T, Abi> log1p(const Vector<T, Abi> &x)
+{
+    using V = Vector<T, Abi>;
+    const V u = V::One() + x;
+    V r = Detail::LogImpl<BaseE>::calc<T, Abi>(u);
+    // ln(1 + x) = ln(u) + (x - (u - 1)) / u corrects for the rounding of 1 + x. For tiny x
+    // (u == 1) the correction is the result.
+    r(isfinite(r)) += (x - (u - V::One())) / u;
+    r(x == V::Zero() || x == std::numeric_limits<T>::infinity()) = x;  // ±0 and +∞
+    return r;
+}
+
 #endif // Vc_COMMON_MATH_H_INTERNAL
@@ -36,7 +36,14 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <malloc.h>
 #else
 #include <cstdlib>
+#include <unistd.h>
 #endif
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+#include <cstddef>
+#include <limits>
+#include <new>
 
 #include "macros.h"
 
@@ -50,27 +57,74 @@ template <size_t X> static constexpr size_t nextMultipleOf(size_t value)
     return (value % X) > 0 ? value + X - (value % X) : value;
 }
 
-template <std::size_t alignment> Vc_INTRINSIC void *aligned_malloc(std::size_t n)
+/**\internal
+ * Allocates \p n bytes, padded to a multiple of \p alignment, at an address that is a
+ * multiple of \p alignment (a power of two).
+ */
+Vc_INTRINSIC void *aligned_malloc(std::size_t alignment, std::size_t n)
 {
+    const std::size_t padded = (n + alignment - 1) & ~(alignment - 1);
 #ifdef __MIC__
-    return _mm_malloc(nextMultipleOf<alignment>(n), alignment);
+    return _mm_malloc(padded, alignment);
 #elif defined(_WIN32)
 # ifdef __GNUC__
-    return __mingw_aligned_malloc(nextMultipleOf<alignment>(n), alignment);
+    return __mingw_aligned_malloc(padded, alignment);
 # else
-    return _aligned_malloc(nextMultipleOf<alignment>(n), alignment);
+    return _aligned_malloc(padded, alignment);
 # endif
 #else
     void *ptr = nullptr;
     if (0 == posix_memalign(&ptr, alignment < sizeof(void *) ? sizeof(void *) : alignment,
-                            nextMultipleOf<alignment>(n))) {
+                            padded)) {
         return ptr;
     }
     return ptr;
 #endif
 }
 
-template <Vc::MallocAlignment A> Vc_ALWAYS_INLINE void *malloc(size_t n)
+template <std::size_t alignment> Vc_INTRINSIC void *aligned_malloc(std::size_t n)
+{
+    return aligned_malloc(alignment, n);
+}
+
+/**\internal
+ * The size of a (base) page of virtual memory.
+ */
+Vc_INTRINSIC std::size_t pageSize()
+{
+#if defined _WIN32 || defined __MIC__
+    return 4096;
+#else
+    static const std::size_t size = [] {
+        const long s = sysconf(_SC_PAGESIZE);
+        return s > 0 ? std::size_t(s) : std::size_t(4096);
+    }();
+    return size;
+#endif
+}
+
+/**\internal
+ * The size of a huge page on x86 and AArch64 with 4 KiB base pages.
+ */
+constexpr std::size_t HugePageSize = 2 * 1024 * 1024;
+
+/**\internal
+ * Advises the kernel to back [\p ptr, \p ptr + \p n) with transparent huge pages. The
+ * advice is only a hint; if the kernel refuses it, the memory is backed by base pages.
+ */
+Vc_INTRINSIC void adviseHugePages(void *ptr, std::size_t n)
+{
+#if defined __linux__ && defined MADV_HUGEPAGE
+    if (ptr) {
+        madvise(ptr, n, MADV_HUGEPAGE);
+    }
+#else
+    (void)ptr;
+    (void)n;
+#endif
+}
+
+Vc_ALWAYS_INLINE void *malloc(Vc::MallocAlignment A, size_t n)
 {
     switch (A) {
     case Vc::AlignOnVector:
@@ -79,12 +133,21 @@ template <Vc::MallocAlignment A> Vc_ALWAYS_INLINE void *malloc(size_t n)
         // TODO: hardcoding 64 is not such a great idea
         return aligned_malloc<64>(n);
     case Vc::AlignOnPage:
-        // TODO: hardcoding 4096 is not such a great idea
-        return aligned_malloc<4096>(n);
+        return aligned_malloc(pageSize(), n);
+    case Vc::AlignOnHugePage: {
+        void *ptr = aligned_malloc<HugePageSize>(n);
+        adviseHugePages(ptr, nextMultipleOf<HugePageSize>(n));
+        return ptr;
+    }
     }
     return nullptr;
 }
 
+template <Vc::MallocAlignment A> Vc_ALWAYS_INLINE void *malloc(size_t n)
+{
+    return malloc(A, n);
+}
+
 Vc_ALWAYS_INLINE void free(void *p)
 {
 #ifdef __MIC__
@@ -164,6 +227,55 @@ Vc_ALWAYS_INLINE void free(T *p)
 {
     Common::free(p);
 }
+
+/**
+ * An STL allocator that allocates with Vc::malloc and the alignment and padding \p A.
+ *
+ * Use it to place the data of a standard container on huge pages:
+ * \code
+ * std::vector<float, Vc::MallocAllocator<float, Vc::AlignOnHugePage>> data(N);
+ * \endcode
+ *
+ * \tparam T The type of objects to allocate.
+ * \tparam A The alignment and padding of every allocation. See \ref Vc::MallocAlignment.
+ *
+ * \ingroup Utilities
+ * \headerfile memory.h <Vc/Memory>
+ */
+template <typename T, Vc::MallocAlignment A> class MallocAllocator
+{
+public:
+    typedef T value_type;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    template <typename U> struct rebind { typedef MallocAllocator<U, A> other; };
+
+    MallocAllocator() = default;
+    template <typename U> MallocAllocator(const MallocAllocator<U, A> &) noexcept {}
+
+    T *allocate(size_type n)
+    {
+        if (n > std::numeric_limits<size_type>::max() / sizeof(T)) {
+            throw std::bad_alloc();
+        }
+        T *p = Vc::malloc<T, A>(n);
+        if (p == nullptr) {
+            throw std::bad_alloc();
+        }
+        return p;
+    }
+    void deallocate(T *p, size_type) noexcept { Vc::free(p); }
+
+    template <typename U> bool operator==(const MallocAllocator<U, A> &) const noexcept
+    {
+        return true;
+    }
+    template <typename U> bool operator!=(const MallocAllocator<U, A> &) const noexcept
+    {
+        return false;
+    }
+};
 }  // namespace Vc
 
 #endif // VC_COMMON_MALLOC_H_
@@ -134,7 +134,10 @@ inline SSE::double_v exp(SSE::double_v::AsArg _x) {
         return x;
     }
 
+#include "power.h"
 #endif
+#include "fastmath.h"
+#include "specialfunctions.h"
 }  // namespace Vc
 
 #undef Vc_COMMON_MATH_H_INTERNAL
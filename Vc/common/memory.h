@@ -36,6 +36,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <initializer_list>
 #include "memoryfwd.h"
 #include "malloc.h"
+#include "arena.h"
 #include "macros.h"
 
 namespace Vc_VERSIONED_NAMESPACE
@@ -405,6 +406,8 @@ class Memory<V, Size, 0u, InitPadding> :
         size_t m_entriesCount;
         size_t m_vectorsCount;
         EntryType *m_mem;
+        // the arena m_mem was allocated from, or nullptr for Vc::malloc
+        Arena *m_arena = nullptr;
         size_t calcPaddedEntriesCount(size_t x)
         {
             size_t masked = x & AlignmentMask;
@@ -429,6 +432,47 @@ class Memory<V, Size, 0u, InitPadding> :
             Base::lastVector() = V::Zero();
         }
 
+        /**
+         * Allocate enough memory to access \p size values of type \p V::EntryType, with
+         * the alignment and padding \p alignment.
+         *
+         * Use Vc::AlignOnHugePage for large arrays that are streamed through, to reduce
+         * the number of TLB misses.
+         *
+         * \param size Determines how many scalar values will fit into the allocated memory.
+         * \param alignment The alignment and padding of the allocation. See \ref
+         *                  Vc::MallocAlignment.
+         */
+        Vc_ALWAYS_INLINE Memory(size_t size, Vc::MallocAlignment alignment)
+            : m_entriesCount(size),
+            m_vectorsCount(calcPaddedEntriesCount(m_entriesCount)),
+            m_mem(static_cast<EntryType *>(
+                Common::malloc(alignment, m_vectorsCount * sizeof(EntryType))))
+        {
+            m_vectorsCount /= V::Size;
+            Base::lastVector() = V::Zero();
+        }
+
+        /**
+         * Allocate enough memory to access \p size values of type \p V::EntryType from
+         * \p arena.
+         *
+         * The memory is returned to \p arena by Arena::reset, not by the destructor.
+         * Thus the Memory object must be destroyed before the next reset of \p arena.
+         *
+         * \param size Determines how many scalar values will fit into the allocated memory.
+         * \param arena The arena to allocate from, e.g. Vc::thread_arena().
+         */
+        Vc_ALWAYS_INLINE Memory(size_t size, Arena &arena)
+            : m_entriesCount(size),
+            m_vectorsCount(calcPaddedEntriesCount(m_entriesCount)),
+            m_mem(arena.allocate<EntryType>(m_vectorsCount)),
+            m_arena(&arena)
+        {
+            m_vectorsCount /= V::Size;
+            Base::lastVector() = V::Zero();
+        }
+
         /**
          * Copy the memory into a new memory area.
          *
@@ -461,11 +505,14 @@ class Memory<V, Size, 0u, InitPadding> :
         }
 
         /**
-         * Frees the memory which was allocated in the constructor.
+         * Frees the memory which was allocated in the constructor, unless it was
+         * allocated from an Arena.
          */
         Vc_ALWAYS_INLINE ~Memory()
         {
-            Vc::free(m_mem);
+            if (!m_arena) {
+                Vc::free(m_mem);
+            }
         }
 
         /**
@@ -477,6 +524,7 @@ class Memory<V, Size, 0u, InitPadding> :
             std::swap(m_mem, rhs.m_mem);
             std::swap(m_entriesCount, rhs.m_entriesCount);
             std::swap(m_vectorsCount, rhs.m_vectorsCount);
+            std::swap(m_arena, rhs.m_arena);
         }
 
         /**
@@ -605,6 +653,7 @@ Vc_ALWAYS_INLINE void prefetchFar(const void *addr)
 }  // namespace Common
 
 using Common::Memory;
+using Common::MemoryPrefetch;
 using Common::prefetchForOneRead;
 using Common::prefetchForModify;
 using Common::prefetchClose;
@@ -30,6 +30,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <assert.h>
 #include <type_traits>
+#include <algorithm>
 #include <iterator>
 #include "macros.h"
 
@@ -202,6 +203,120 @@ public:
     MemoryVectorIterator<V, Flags> begin() const { return &m_parent->vector(m_first   , Flags()); }
     MemoryVectorIterator<V, Flags> end() const   { return &m_parent->vector(m_last + 1, Flags()); }
 };/*}}}*/
+
+// MemoryPrefetch {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile memory.h <Vc/Memory>
+ *
+ * The distances, in bytes ahead of the current vector, at which the iterators returned
+ * from Memory::prefetching() issue software prefetches. A distance of 0 disables the
+ * respective prefetches.
+ */
+struct MemoryPrefetch {
+    constexpr MemoryPrefetch(size_t close_, size_t mid_) : close(close_), mid(mid_) {}
+
+    /**
+     * Returns distances tuned for streaming through memory that does not fit into the
+     * last level cache.
+     *
+     * The prefetches into L2 run 64 prefetch strides (CpuId::prefetch()) ahead, enough
+     * to keep the memory controller busy during the DRAM latency; the prefetches into L1
+     * 4 strides ahead to hide the L2 latency. Both are capped to a small part of the
+     * respective cache so that the lines are not evicted again before they are used.
+     */
+    static MemoryPrefetch tuned();
+
+    /// distance of the prefetches into the L1 cache (prefetchClose)
+    size_t close;
+    /// distance of the prefetches into the L2 cache (prefetchMid)
+    size_t mid;
+};
+
+// PrefetchingMemoryVectorIterator {{{1
+/**
+ * \internal
+ * A forward iterator over the vectors of a Memory object that prefetches the memory at
+ * MemoryPrefetch::close and MemoryPrefetch::mid bytes ahead whenever it is advanced.
+ *
+ * The prefetch addresses may point past the end of the memory; prefetches never fault.
+ */
+template <typename _V, typename Flags> class PrefetchingMemoryVectorIterator
+{
+    MemoryVector<_V, Flags> *d;
+    MemoryPrefetch distance;
+
+public:
+    typedef std::ptrdiff_t difference_type;
+    typedef MemoryVector<_V, Flags> value_type;
+    typedef value_type *pointer;
+    typedef value_type &reference;
+    typedef std::forward_iterator_tag iterator_category;
+
+    constexpr PrefetchingMemoryVectorIterator(MemoryVector<_V, Flags> *dd,
+                                              MemoryPrefetch dist)
+        : d(dd), distance(dist)
+    {
+    }
+
+    Vc_ALWAYS_INLINE reference operator*() const { return *d; }
+    Vc_ALWAYS_INLINE pointer operator->() const { return d; }
+    Vc_ALWAYS_INLINE PrefetchingMemoryVectorIterator &operator++()
+    {
+        ++d;
+        const char *addr = reinterpret_cast<const char *>(d);
+        if (distance.close > 0) {
+            Vc::Detail::prefetchClose(addr + distance.close, VectorAbi::Best<float>());
+        }
+        if (distance.mid > 0) {
+            Vc::Detail::prefetchMid(addr + distance.mid, VectorAbi::Best<float>());
+        }
+        return *this;
+    }
+    Vc_ALWAYS_INLINE PrefetchingMemoryVectorIterator operator++(int)
+    {
+        PrefetchingMemoryVectorIterator r(*this);
+        operator++();
+        return r;
+    }
+
+    Vc_ALWAYS_INLINE difference_type operator-(const PrefetchingMemoryVectorIterator &rhs) const
+    {
+        return d - rhs.d;
+    }
+    Vc_ALWAYS_INLINE bool operator==(const PrefetchingMemoryVectorIterator &rhs) const
+    {
+        return d == rhs.d;
+    }
+    Vc_ALWAYS_INLINE bool operator!=(const PrefetchingMemoryVectorIterator &rhs) const
+    {
+        return d != rhs.d;
+    }
+};
+
+// PrefetchingMemoryRange {{{1
+/**
+ * \internal
+ * The return type of Memory::prefetching(): a range over the vectors of a Memory object
+ * whose iterators issue software prefetches.
+ */
+template <typename V, typename Flags> class PrefetchingMemoryRange
+{
+    MemoryVector<V, Flags> *m_first;
+    MemoryVector<V, Flags> *m_last;
+    MemoryPrefetch m_distance;
+
+public:
+    PrefetchingMemoryRange(MemoryVector<V, Flags> *first, MemoryVector<V, Flags> *last,
+                           MemoryPrefetch distance)
+        : m_first(first), m_last(last), m_distance(distance)
+    {
+    }
+
+    PrefetchingMemoryVectorIterator<V, Flags> begin() const { return {m_first, m_distance}; }
+    PrefetchingMemoryVectorIterator<V, Flags> end() const { return {m_last, m_distance}; }
+};
+// }}}1
 template<typename V, typename Parent, int Dimension, typename RowMemory> class MemoryDimensionBase;
 template<typename V, typename Parent, typename RowMemory> class MemoryDimensionBase<V, Parent, 1, RowMemory> // {{{1
 {
@@ -417,6 +532,56 @@ template<typename V, typename Parent, int Dimension, typename RowMemory> class M
         template<typename Flags = AlignedTag>
         Vc_ALWAYS_INLINE MemoryVectorIterator<const V, Flags>   end(Flags flags = Flags()) const { return &lastVector(flags) + 1; }
 
+        /**
+         * Returns a range over the vectors of this memory object whose iterators issue
+         * software prefetches (Vc::prefetchClose and Vc::prefetchMid) for the memory
+         * \p distance.close and \p distance.mid bytes ahead of the current vector.
+         *
+         * The default distances are tuned from CpuId::prefetch() and the cache sizes (see
+         * MemoryPrefetch::tuned()). Prefetching pays off for arrays that do not fit into
+         * the last level cache:
+         * \code
+         * Memory<float_v> data(1 << 26);
+         * float_v sum = 0.f;
+         * for (const auto &x : data.prefetching()) {
+         *     sum += x;
+         * }
+         * \endcode
+         */
+        template <typename Flags = AlignedTag>
+        Vc_ALWAYS_INLINE PrefetchingMemoryRange<V, Flags> prefetching(
+            MemoryPrefetch distance = MemoryPrefetch::tuned(), Flags flags = Flags())
+        {
+            return {&firstVector(flags), &lastVector(flags) + 1, distance};
+        }
+        //! const overload of the above
+        template <typename Flags = AlignedTag>
+        Vc_ALWAYS_INLINE PrefetchingMemoryRange<const V, Flags> prefetching(
+            MemoryPrefetch distance = MemoryPrefetch::tuned(), Flags flags = Flags()) const
+        {
+            using MV = MemoryVector<const V, Flags>;
+            return {const_cast<MV *>(&firstVector(flags)),
+                    const_cast<MV *>(&lastVector(flags) + 1), distance};
+        }
+
+        /**
+         * Returns a range over the vectors of this memory object whose iterators prefetch
+         * the memory \p L1 bytes ahead into the L1 cache and \p L2 bytes ahead into the L2
+         * cache. The strides have the same meaning as for Vc::Prefetch.
+         */
+        template <size_t L1, size_t L2, typename Flags = AlignedTag>
+        Vc_ALWAYS_INLINE PrefetchingMemoryRange<V, Flags> prefetching(Flags flags = Flags())
+        {
+            return prefetching(MemoryPrefetch(L1, L2), flags);
+        }
+        //! const overload of the above
+        template <size_t L1, size_t L2, typename Flags = AlignedTag>
+        Vc_ALWAYS_INLINE PrefetchingMemoryRange<const V, Flags> prefetching(
+            Flags flags = Flags()) const
+        {
+            return prefetching(MemoryPrefetch(L1, L2), flags);
+        }
+
         /**
          * \param i Selects the offset, where the vector should be read.
          *
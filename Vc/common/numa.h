@@ -0,0 +1,116 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_NUMA_H_
+#define VC_COMMON_NUMA_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include "malloc.h"
+#include "threadpool.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \ingroup Utilities
+ * \headerfile numa.h <Vc/Memory>
+ *
+ * Returns the number of NUMA nodes of the system, or 1 if it cannot be determined.
+ */
+std::size_t numa_node_count();
+
+/**
+ * \ingroup Utilities
+ * \headerfile numa.h <Vc/Memory>
+ *
+ * Binds the pages of [\p ptr, \p ptr + \p bytes) to the NUMA node \p node (Linux
+ * mbind(MPOL_BIND)). Pages that are already populated are migrated.
+ *
+ * Only the pages that lie completely inside the range are affected, so allocate with
+ * Vc::AlignOnPage or Vc::AlignOnHugePage to cover the whole range. Call it before the
+ * memory is first written to avoid the migration.
+ *
+ * \return \c false if the system does not support it or the kernel refuses the request
+ * (e.g. because \p node does not exist). The memory remains usable in that case; only
+ * its placement is left to the default policy.
+ */
+bool numa_bind(void *ptr, std::size_t bytes, int node);
+
+/**
+ * \ingroup Utilities
+ * \headerfile numa.h <Vc/Memory>
+ *
+ * Interleaves the pages of [\p ptr, \p ptr + \p bytes) round-robin over all NUMA nodes
+ * (Linux mbind(MPOL_INTERLEAVE)), which spreads the bandwidth of a buffer that all
+ * threads stream through over all memory controllers.
+ *
+ * \return \c false if the system does not support it or the kernel refuses the request.
+ * \see numa_bind
+ */
+bool numa_interleave(void *ptr, std::size_t bytes);
+
+/**
+ * \ingroup Utilities
+ * \headerfile numa.h <Vc/Memory>
+ *
+ * Initializes the uninitialized memory [\p ptr, \p ptr + \p n) with copies of \p value
+ * on the worker threads of the library's thread pool (see Vc::execution::par_simd).
+ *
+ * Under the default first-touch policy of the kernel, a page is placed on the NUMA node
+ * of the thread that writes to it first. Thus this spreads the pages of a freshly
+ * allocated buffer over the nodes of the participating threads, instead of placing all
+ * of them on the node of the allocating thread. The range is split at multiples of 2
+ * MiB, so that no (huge) page is touched by two threads.
+ */
+template <typename T> void first_touch(T *ptr, std::size_t n, const T &value = T())
+{
+    constexpr std::size_t Chunk = Common::HugePageSize;
+    if (n == 0) {
+        return;
+    }
+    const std::uintptr_t first = reinterpret_cast<std::uintptr_t>(ptr);
+    const std::uintptr_t last = reinterpret_cast<std::uintptr_t>(ptr + n);
+    const std::uintptr_t firstChunk = first & ~std::uintptr_t(Chunk - 1);
+    const std::size_t chunks = (last - firstChunk + Chunk - 1) / Chunk;
+    Detail::parallel_for(chunks, [&](std::size_t i) {
+        const std::uintptr_t begin = std::max(first, firstChunk + i * Chunk);
+        const std::uintptr_t end = std::min(last, firstChunk + (i + 1) * Chunk);
+        // round to whole objects; an object that straddles a chunk boundary belongs to
+        // the chunk it starts in
+        T *const b = ptr + (begin - first + sizeof(T) - 1) / sizeof(T);
+        T *const e = std::min(ptr + n, ptr + (end - first + sizeof(T) - 1) / sizeof(T));
+        std::uninitialized_fill(b, e, value);
+    });
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_NUMA_H_
+
+// vim: foldmethod=marker
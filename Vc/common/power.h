@@ -0,0 +1,235 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifdef Vc_COMMON_MATH_H_INTERNAL
+
+namespace Detail
+{
+// double-double arithmetic {{{
+// An unevaluated sum hi + lo with |lo| ≤ ½ulp(hi), carrying about twice the precision
+// of T. The splitting for the exact product masks off the low mantissa bits instead of
+// multiplying by 2²⁷ + 1, which keeps it correct if the compiler contracts to FMA.
+template <typename V> struct DoubleDouble {
+    V hi, lo;
+};
+
+template <typename V> Vc_ALWAYS_INLINE DoubleDouble<V> two_sum(const V &a, const V &b)
+{
+    const V s = a + b;
+    const V bb = s - a;
+    return {s, (a - (s - bb)) + (b - bb)};
+}
+
+// requires |a| ≥ |b|
+template <typename V> Vc_ALWAYS_INLINE DoubleDouble<V> fast_two_sum(const V &a, const V &b)
+{
+    const V s = a + b;
+    return {s, b - (s - a)};
+}
+
+template <typename V> Vc_ALWAYS_INLINE DoubleDouble<V> two_prod(const V &a, const V &b)
+{
+    typedef Const<typename V::EntryType, typename V::abi> C;
+    const V p = a * b;
+    const V ah = Detail::operator&(a, C::highMask());
+    const V bh = Detail::operator&(b, C::highMask());
+    const V al = a - ah;
+    const V bl = b - bh;
+    return {p, ((ah * bh - p) + ah * bl + al * bh) + al * bl};
+}
+
+template <typename V>
+Vc_ALWAYS_INLINE DoubleDouble<V> operator+(const DoubleDouble<V> &a, const DoubleDouble<V> &b)
+{
+    const DoubleDouble<V> s = two_sum(a.hi, b.hi);
+    return fast_two_sum(s.hi, s.lo + (a.lo + b.lo));
+}
+
+template <typename V>
+Vc_ALWAYS_INLINE DoubleDouble<V> operator*(const DoubleDouble<V> &a, const DoubleDouble<V> &b)
+{
+    const DoubleDouble<V> p = two_prod(a.hi, b.hi);
+    return fast_two_sum(p.hi, p.lo + (a.hi * b.lo + a.lo * b.hi));
+}
+
+// log_dd {{{
+// Returns ln(x) for finite x > 0 as a DoubleDouble with a relative error below 2⁻⁶⁴.
+// x = 2ᵉ * m with m ∈ [√½, √2[, s = (m - 1) / (m + 1) ∈ ]-0.172, 0.172[, and
+// ln(m) = 2 artanh(s) = 2s + ⅔s³ + 2s⁵ * Σ sᵏ / (2k + 5).
+// The terms up to s³ are evaluated in double-double arithmetic.
+template <typename Abi>
+Vc_ALWAYS_INLINE DoubleDouble<Vector<double, Abi>> log_dd(Vector<double, Abi> x)
+{
+    using V = Vector<double, Abi>;
+    using DD = DoubleDouble<V>;
+    typedef Const<double, Abi> C;
+
+    const auto denormal = x < C::min();
+    x(denormal) *= V(Vc::Detail::doubleConstant<1, 0, 54>());  // 2⁵⁴
+    V e = Detail::exponent(x.data());
+    e(denormal) -= 54;
+    x.setZero(C::exponentMask());
+    x = Detail::operator|(x, C::_1_2());  // x ∈ [½, 1[
+    const auto smallX = x < C::_1_sqrt2();
+    x(smallX) += x;
+    e(!smallX) += V::One();
+    const V f = x - V::One();  // exact
+
+    // s = f / (2 + f) in double-double
+    const DD d = two_sum(V(2.), f);
+    const V sh = f / d.hi;
+    const DD p = two_prod(sh, d.hi);
+    const DD s = fast_two_sum(sh, (((f - p.hi) - p.lo) - sh * d.lo) / d.hi);
+
+    const DD s2 = s * s;
+    const DD s3 = s2 * s;
+    const DD two_thirds = {V(Vc::Detail::doubleConstant<1, 0x5555555555555ull, -1>()),
+                           V(Vc::Detail::doubleConstant<1, 0x5555555555555ull, -55>())};
+    const V z = s2.hi;
+    V tail = 2. / 23.;
+    tail = tail * z + 2. / 21.;
+    tail = tail * z + 2. / 19.;
+    tail = tail * z + 2. / 17.;
+    tail = tail * z + 2. / 15.;
+    tail = tail * z + 2. / 13.;
+    tail = tail * z + 2. / 11.;
+    tail = tail * z + 2. / 9.;
+    tail = tail * z + 2. / 7.;
+    tail = tail * z + 2. / 5.;
+    tail *= s3.hi * z;
+
+    // e * ln2_large is exact, ln2_small is far below ulp(e * ln2_large)
+    const DD eln2 = fast_two_sum(e * C::ln2_large(), e * C::ln2_small());
+    const DD series = DD{s.hi + s.hi, s.lo + s.lo} + s3 * two_thirds;
+    return eln2 + DD{series.hi, series.lo + tail};
+}
+
+// pow_kernel {{{
+// xʸ for finite x > 0 (other inputs are fixed up by pow)
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<float, Abi> pow_kernel(const Vector<float, Abi> &x,
+                                               const Vector<float, Abi> &y)
+{
+    // The double precision ln(x) and exp(z) bound the error of z = y * ln(x) by 2⁻⁴⁵,
+    // i.e. far below ½ulp of the float result.
+    using V = Vector<float, Abi>;
+    using D = SimdArray<double, V::Size>;
+    return simd_cast<V>(exp(simd_cast<D>(y) * log(simd_cast<D>(x))));
+}
+
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<double, Abi> pow_kernel(const Vector<double, Abi> &x,
+                                                const Vector<double, Abi> &y)
+{
+    using V = Vector<double, Abi>;
+    using DD = DoubleDouble<V>;
+    typedef Const<double, Abi> C;
+
+    // z = y * ln(x) in double-double, eᶻ = 2ⁿ * eʳ with n = ⌊z * log₂(e) + ½⌋
+    const DD lnx = log_dd(x);
+    DD z = two_prod(y, lnx.hi);
+    z.lo += y * lnx.lo;
+    V n = floor(C::log2_e() * z.hi + 0.5);
+    const auto overflow = z.hi > 1000.;
+    const auto underflow = z.hi < -1000.;
+    n(overflow || underflow) = V::Zero();  // keep ldexp_wide in range
+    const V r = (z.hi - n * C::ln2_large()) + (z.lo - n * C::ln2_small());
+    V result = ldexp_wide(V::One() + expm1_reduced(r), static_cast<SimdArray<int, V::Size>>(n));
+    result(overflow) = std::numeric_limits<double>::infinity();
+    result.setZero(underflow);
+    return result;
+}
+// }}}
+}  // namespace Detail
+
+// pow {{{
+template <typename T, typename Abi>
+inline Detail::enable_if_vector_math<T, Abi> pow(const Vector<T, Abi> &x,
+                                                 const Vector<T, Abi> &y)
+{
+    using V = Vector<T, Abi>;
+    using M = typename V::Mask;
+    constexpr T inf = std::numeric_limits<T>::infinity();
+
+    const V ax = abs(x);
+    V r = Detail::pow_kernel(ax, y);
+
+    // special cases as specified by C99 Annex F.9.4.4
+    const M yIsInteger = floor(y) == y;
+    const M yIsOdd = yIsInteger && floor(y * T(0.5)) != y * T(0.5);
+    const M xIsZero = ax == V::Zero();
+    const M xIsInf = isinf(ax);
+    r(xIsZero && y < V::Zero()) = inf;
+    r(xIsZero && y > V::Zero()) = V::Zero();
+    r(xIsInf && y < V::Zero()) = V::Zero();
+    r(xIsInf && y > V::Zero()) = inf;
+    r(ax == V::One() && isinf(y)) = V::One();
+    r(isnegative(x) && yIsOdd) = -r;
+    r.setQnan((x < V::Zero() && !xIsInf && !yIsInteger) || isnan(x) || isnan(y));
+    r(y == V::Zero() || x == V::One()) = V::One();
+    return r;
+}
+
+// cbrt {{{
+template <typename T, typename Abi>
+inline Detail::enable_if_vector_math<T, Abi> cbrt(const Vector<T, Abi> &x)
+{
+    using V = Vector<T, Abi>;
+    using IV = SimdArray<int, V::Size>;
+    typedef Detail::Const<T, Abi> C;
+
+    V ax = abs(x);
+    const auto denormal = ax < C::min();
+    ax(denormal) *= V(T(Vc::Detail::doubleConstant<1, 0, 54>()));  // 2⁵⁴
+    IV exponent;
+    V a = frexp(ax, &exponent);  // ax = a * 2ᵉ, a ∈ [½, 1[
+    V e = simd_cast<V>(exponent);
+    e(denormal) -= T(54);
+
+    // ∛(a * 2ᵉ) = ∛(a * 2ʳ) * 2^q with e = 3q + r and a * 2ʳ ∈ [½, 4[
+    const V q = floor(e / T(3));
+    const V rem = e - q * T(3);
+    a(rem >= V::One()) += a;
+    a(rem >= T(2)) += a;
+
+    // quadratic least-squares fit with a relative error below 4%, then Halley iterations
+    // (cubic convergence): 4% → 5·10⁻⁵ → 10⁻¹³ → 10⁻³⁹
+    V t = (T(-0.04040273511671032) * a + T(0.3933334400383903)) * a + T(0.6363058688167454);
+    for (int i = 0; i < (std::is_same<T, float>::value ? 2 : 3); ++i) {
+        const V t3 = t * t * t;
+        t -= t * (t3 - a) / (t3 + t3 + a);
+    }
+
+    V r = copysign(ldexp(t, simd_cast<IV>(q)), x);
+    r(ax == V::Zero() || !isfinite(x)) = x;
+    return r;
+}
+// }}}
+
+#endif // Vc_COMMON_MATH_H_INTERNAL
+
+// vim: foldmethod=marker
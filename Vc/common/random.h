@@ -0,0 +1,433 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_RANDOM_H_
+#define VC_COMMON_RANDOM_H_
+
+#include <algorithm>
+#include <cstdint>
+#include "../vector.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \defgroup Random Random Number Generation
+ *
+ * Vectorized pseudo-random number engines and distributions.
+ *
+ * In contrast to Vector::Random(), which uses one hidden state shared by the whole
+ * program, the engines keep independent state per vector lane in the engine object. Every
+ * thread constructs its own engine with the same seed and a distinct stream number;
+ * engines with different streams (and the lanes within one engine) produce
+ * non-overlapping sequences:
+ * \code
+ * Vc::Philox4x32_v engine(seed, threadIndex);
+ * Vc::NormalDistribution<Vc::float_v> normal;
+ * for (...) {
+ *   const float_v z = normal(engine);
+ * }
+ * \endcode
+ * An engine returns a \c uint vector of random bits on every call. The distributions turn
+ * these bits into floating-point vectors of any type and size.
+ */
+
+/**
+ * \ingroup Random
+ *
+ * The Philox4x32-10 counter-based engine (Salmon et al., "Parallel Random Numbers: As
+ * Easy as 1, 2, 3").
+ *
+ * Every output block is the bijective encryption of a 128-bit counter with the 64-bit
+ * seed as key. The counter of lane \c i in stream \c s at block \c n is
+ * `{n mod 2^32, n / 2^32, i, s}`. Thus lanes and streams never overlap, and discard()
+ * takes constant time. Every block yields four vectors; two blocks are generated at
+ * once.
+ *
+ * \tparam V A \c uint vector type, e.g. Vc::uint_v.
+ */
+template <typename V> class Philox4x32
+{
+    static_assert(is_simd_vector<V>::value && std::is_same<typename V::EntryType, uint>::value,
+                  "Philox4x32<V> requires V to be a Vc::Vector<uint, Abi> type");
+
+public:
+    using result_type = V;
+    static constexpr std::size_t Size = V::Size;
+
+    /// Initializes lane \c i to the start of its subsequence in stream \p stream.
+    explicit Philox4x32(std::uint64_t seed = 0, uint stream = 0)
+        : m_key0(uint(seed)), m_key1(uint(seed >> 32)), m_stream(stream)
+    {
+    }
+
+    /// Returns the next vector of random bits.
+    Vc_ALWAYS_INLINE V operator()()
+    {
+        if (m_index == 8) {
+            generate();
+        }
+        return m_buffer[m_index++];
+    }
+
+    /// Advances every lane by \p n outputs.
+    void discard(std::uint64_t n)
+    {
+        // m_buffer holds the blocks m_block - 2 and m_block - 1; the modular arithmetic
+        // also works for the initial state without buffered blocks
+        const std::uint64_t position = (m_block - 2) * 4 + m_index + n;
+        m_block = position / 8 * 2;
+        m_index = 8;
+        if (position % 8 != 0) {
+            generate();
+            m_index = position % 8;
+        }
+    }
+
+private:
+    // Encrypts two consecutive counter blocks. They are independent, which hides the
+    // latency of the multiplications.
+    void generate()
+    {
+        V c[2][4];
+        for (int b = 0; b < 2; ++b) {
+            const std::uint64_t block = m_block + b;
+            c[b][0] = uint(block);
+            c[b][1] = uint(block >> 32);
+            c[b][2] = V(IndexesFromZero);
+            c[b][3] = m_stream;
+        }
+        uint k0 = m_key0;
+        uint k1 = m_key1;
+        const V m0 = 0xD2511F53u;
+        const V m1 = 0xCD9E8D57u;
+        for (int round = 0; round < 10; ++round) {
+            for (int b = 0; b < 2; ++b) {
+                const V hi0 = Detail::mulhi(c[b][0], m0);
+                const V lo0 = c[b][0] * m0;
+                const V hi1 = Detail::mulhi(c[b][2], m1);
+                const V lo1 = c[b][2] * m1;
+                c[b][0] = hi1 ^ c[b][1] ^ V(k0);
+                c[b][1] = lo1;
+                c[b][2] = hi0 ^ c[b][3] ^ V(k1);
+                c[b][3] = lo0;
+            }
+            k0 += 0x9E3779B9u;
+            k1 += 0xBB67AE85u;
+        }
+        for (int i = 0; i < 8; ++i) {
+            m_buffer[i] = c[i / 4][i % 4];
+        }
+        m_index = 0;
+        m_block += 2;
+    }
+
+    V m_buffer[8];
+    uint m_key0, m_key1, m_stream;
+    unsigned m_index = 8;
+    std::uint64_t m_block = 0;
+};
+
+/**
+ * \ingroup Random
+ *
+ * The xoshiro128** engine (Blackman & Vigna, "Scrambled Linear Pseudorandom Number
+ * Generators") with one 128-bit state per lane.
+ *
+ * The constructor expands the seed with SplitMix64 and then spaces the lanes 2^64 outputs
+ * apart and the streams 2^96 outputs apart, using the jump polynomials of the reference
+ * implementation. The period is 2^128 - 1. Xoshiro128** is cheaper per output than
+ * Philox4x32, but discard() takes linear time.
+ *
+ * \tparam V A \c uint vector type, e.g. Vc::uint_v.
+ */
+template <typename V> class Xoshiro128
+{
+    static_assert(is_simd_vector<V>::value && std::is_same<typename V::EntryType, uint>::value,
+                  "Xoshiro128<V> requires V to be a Vc::Vector<uint, Abi> type");
+
+public:
+    using result_type = V;
+    static constexpr std::size_t Size = V::Size;
+
+    /// Initializes the lanes to non-overlapping subsequences of stream \p stream.
+    explicit Xoshiro128(std::uint64_t seed = 0, uint stream = 0)
+    {
+        uint s[4];
+        for (int i = 0; i < 4; i += 2) {
+            // SplitMix64
+            std::uint64_t z = (seed += 0x9e3779b97f4a7c15ull);
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+            z ^= z >> 31;
+            s[i] = uint(z);
+            s[i + 1] = uint(z >> 32);
+        }
+        static constexpr uint longJump[4] = {0xb523952e, 0x0b6f099f, 0xccf5a0ef, 0x1c580662};
+        static constexpr uint jump[4] = {0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b};
+        for (uint i = 0; i < stream; ++i) {
+            scalarJump(s, longJump);
+        }
+        for (std::size_t lane = 0; lane < Size; ++lane) {
+            for (int i = 0; i < 4; ++i) {
+                m_state[i][lane] = s[i];
+            }
+            scalarJump(s, jump);
+        }
+    }
+
+    /// Returns the next vector of random bits.
+    Vc_ALWAYS_INLINE V operator()()
+    {
+        const V s1 = m_state[1];
+        const V x = (s1 << 2) + s1;                   // s[1] * 5
+        const V r = (x << 7) | (x >> 25);             // rotl(s[1] * 5, 7)
+        const V result = (r << 3) + r;                // * 9
+        const V t = s1 << 9;
+        m_state[2] ^= m_state[0];
+        m_state[3] ^= m_state[1];
+        m_state[1] ^= m_state[2];
+        m_state[0] ^= m_state[3];
+        m_state[2] ^= t;
+        m_state[3] = (m_state[3] << 11) | (m_state[3] >> 21);
+        return result;
+    }
+
+    /// Advances every lane by \p n outputs.
+    void discard(std::uint64_t n)
+    {
+        for (; n > 0; --n) {
+            operator()();
+        }
+    }
+
+private:
+    static void scalarNext(uint *s)
+    {
+        const uint t = s[1] << 9;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = (s[3] << 11) | (s[3] >> 21);
+    }
+    static void scalarJump(uint *s, const uint *polynomial)
+    {
+        uint r[4] = {0, 0, 0, 0};
+        for (int i = 0; i < 4; ++i) {
+            for (int b = 0; b < 32; ++b) {
+                if (polynomial[i] & (1u << b)) {
+                    for (int k = 0; k < 4; ++k) {
+                        r[k] ^= s[k];
+                    }
+                }
+                scalarNext(s);
+            }
+        }
+        std::copy(r, r + 4, s);
+    }
+
+    V m_state[4];
+};
+
+/**
+ * \ingroup Random
+ * Philox4x32 engine for the default uint vector type.
+ */
+using Philox4x32_v = Philox4x32<uint_v>;
+/**
+ * \ingroup Random
+ * Xoshiro128 engine for the default uint vector type.
+ */
+using Xoshiro128_v = Xoshiro128<uint_v>;
+
+namespace Detail
+{
+// Random bits for N entries, drawn from as many engine calls as necessary and stored to
+// memory, from where the caller loads them with the vector type it needs.
+template <std::size_t N, typename Engine> struct RandomWords {
+    static constexpr std::size_t EngineSize = Engine::result_type::Size;
+    static constexpr std::size_t Count = (N + EngineSize - 1) / EngineSize * EngineSize;
+
+    Vc_ALWAYS_INLINE explicit RandomWords(Engine &engine)
+    {
+        for (std::size_t i = 0; i < Count; i += EngineSize) {
+            engine().store(reinterpret_cast<uint *>(data + i), Vc::Aligned);
+        }
+    }
+
+    alignas(MemoryAlignment) int data[Count];
+};
+
+// uniform in [0, 1) with 24 random bits
+template <typename V, typename Engine>
+Vc_ALWAYS_INLINE V uniform01(Engine &engine, float)
+{
+    using I = SimdArray<int, V::Size>;
+    const RandomWords<V::Size, Engine> words(engine);
+    const I bits = (I(&words.data[0], Vc::Unaligned) >> 8) & 0xffffff;
+    return simd_cast<V>(bits) * V(1.f / (1 << 24));
+}
+
+// uniform in [0, 1) with 53 random bits
+template <typename V, typename Engine>
+Vc_ALWAYS_INLINE V uniform01(Engine &engine, double)
+{
+    using I = SimdArray<int, V::Size>;
+    const RandomWords<2 * V::Size, Engine> words(engine);
+    const I hi = (I(&words.data[0], Vc::Unaligned) >> 10) & 0x3fffff;
+    const I lo = (I(&words.data[V::Size], Vc::Unaligned) >> 1) & 0x7fffffff;
+    return simd_cast<V>(hi) * V(1. / (1 << 22)) +
+           simd_cast<V>(lo) * V(1. / (std::uint64_t(1) << 53));
+}
+
+template <typename V> struct is_random_distribution_type {
+    static constexpr bool value =
+        is_simd_vector<V>::value && std::is_floating_point<typename V::EntryType>::value;
+};
+}  // namespace Detail
+
+/**
+ * \ingroup Random
+ *
+ * Uniformly distributed values in [a, b).
+ *
+ * Every entry is computed from 24 (float) or 53 (double) random bits.
+ *
+ * \tparam V A floating-point Vector or SimdArray type.
+ */
+template <typename V> class UniformDistribution
+{
+    static_assert(Detail::is_random_distribution_type<V>::value,
+                  "UniformDistribution<V> requires a floating-point Vector or SimdArray");
+    using T = typename V::EntryType;
+
+public:
+    using result_type = V;
+
+    explicit UniformDistribution(T a = 0, T b = 1) : m_a(a), m_width(b - a) {}
+
+    T a() const { return m_a; }
+    T b() const { return m_a + m_width; }
+
+    template <typename Engine> Vc_ALWAYS_INLINE V operator()(Engine &engine)
+    {
+        return V(m_a) + V(m_width) * Detail::uniform01<V>(engine, T());
+    }
+
+private:
+    T m_a, m_width;
+};
+
+/**
+ * \ingroup Random
+ *
+ * Normally distributed values with the given mean and standard deviation.
+ *
+ * The Box-Muller transform maps two uniform vectors to two independent normal vectors.
+ * The second one is returned by the next call. Because the uniform input is quantized to
+ * 24 (float) or 53 (double) bits, |x - mean| does not exceed 5.8 (float) or 8.6
+ * (double) standard deviations.
+ *
+ * \tparam V A floating-point Vector or SimdArray type.
+ */
+template <typename V> class NormalDistribution
+{
+    static_assert(Detail::is_random_distribution_type<V>::value,
+                  "NormalDistribution<V> requires a floating-point Vector or SimdArray");
+    using T = typename V::EntryType;
+
+public:
+    using result_type = V;
+
+    explicit NormalDistribution(T mean = 0, T stddev = 1) : m_mean(mean), m_stddev(stddev) {}
+
+    T mean() const { return m_mean; }
+    T stddev() const { return m_stddev; }
+    /// Discards the buffered second value of the last Box-Muller transform.
+    void reset() { m_hasNext = false; }
+
+    template <typename Engine> V operator()(Engine &engine)
+    {
+        if (m_hasNext) {
+            m_hasNext = false;
+            return m_next;
+        }
+        // 1 - u is in (0, 1], thus the logarithm is finite. The arguments are in the
+        // domain of the fast tier, whose error is negligible compared to the
+        // quantization of u.
+        const V u1 = V(1) - Detail::uniform01<V>(engine, T());
+        const V u2 = Detail::uniform01<V>(engine, T());
+        const V r = V(m_stddev) * sqrt(V(-2) * fast::log(u1));
+        V s, c;
+        fast::sincos(V(T(2 * 3.14159265358979323846)) * u2, &s, &c);
+        m_next = V(m_mean) + r * s;
+        m_hasNext = true;
+        return V(m_mean) + r * c;
+    }
+
+private:
+    V m_next;
+    T m_mean, m_stddev;
+    bool m_hasNext = false;
+};
+
+/**
+ * \ingroup Random
+ *
+ * Exponentially distributed values with rate \p lambda, i.e. mean 1 / \p lambda.
+ *
+ * \tparam V A floating-point Vector or SimdArray type.
+ */
+template <typename V> class ExponentialDistribution
+{
+    static_assert(Detail::is_random_distribution_type<V>::value,
+                  "ExponentialDistribution<V> requires a floating-point Vector or SimdArray");
+    using T = typename V::EntryType;
+
+public:
+    using result_type = V;
+
+    explicit ExponentialDistribution(T lambda = 1) : m_lambda(lambda) {}
+
+    T lambda() const { return m_lambda; }
+
+    template <typename Engine> Vc_ALWAYS_INLINE V operator()(Engine &engine)
+    {
+        const V u = V(1) - Detail::uniform01<V>(engine, T());  // (0, 1]
+        return fast::log(u) * V(T(-1) / m_lambda);
+    }
+
+private:
+    T m_lambda;
+};
+}  // namespace Vc
+
+#endif  // VC_COMMON_RANDOM_H_
+
+// vim: foldmethod=marker
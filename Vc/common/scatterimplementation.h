@@ -112,60 +112,75 @@ Vc_ALWAYS_INLINE void executeScatter(PopcntSwitchT,
         low = _bit_scan_forward(bits);
         bits ^= 1 << low;
         mem[indexes[low]] = v[low];
+        // fallthrough
     case 14:
         high = _bit_scan_reverse(bits);
         mem[indexes[high]] = v[high];
         high = (1 << high);
+        // fallthrough
     case 13:
         low = _bit_scan_forward(bits);
         bits ^= high | (1 << low);
         mem[indexes[low]] = v[low];
+        // fallthrough
     case 12:
         high = _bit_scan_reverse(bits);
         mem[indexes[high]] = v[high];
         high = (1 << high);
+        // fallthrough
     case 11:
         low = _bit_scan_forward(bits);
         bits ^= high | (1 << low);
         mem[indexes[low]] = v[low];
+        // fallthrough
     case 10:
         high = _bit_scan_reverse(bits);
         mem[indexes[high]] = v[high];
         high = (1 << high);
+        // fallthrough
     case 9:
         low = _bit_scan_forward(bits);
         bits ^= high | (1 << low);
         mem[indexes[low]] = v[low];
+        // fallthrough
     case 8:
         high = _bit_scan_reverse(bits);
         mem[indexes[high]] = v[high];
         high = (1 << high);
+        // fallthrough
     case 7:
         low = _bit_scan_forward(bits);
         bits ^= high | (1 << low);
         mem[indexes[low]] = v[low];
+        // fallthrough
     case 6:
         high = _bit_scan_reverse(bits);
         mem[indexes[high]] = v[high];
         high = (1 << high);
+        // fallthrough
     case 5:
         low = _bit_scan_forward(bits);
         bits ^= high | (1 << low);
         mem[indexes[low]] = v[low];
+        // fallthrough
     case 4:
         high = _bit_scan_reverse(bits);
         mem[indexes[high]] = v[high];
         high = (1 << high);
+        // fallthrough
     case 3:
         low = _bit_scan_forward(bits);
         bits ^= high | (1 << low);
         mem[indexes[low]] = v[low];
+        // fallthrough
     case 2:
         high = _bit_scan_reverse(bits);
         mem[indexes[high]] = v[high];
+        // fallthrough
     case 1:
         low = _bit_scan_forward(bits);
         mem[indexes[low]] = v[low];
+        // fallthrough
     case 0:
         break;
     }
@@ -188,28 +203,35 @@ Vc_ALWAYS_INLINE void executeScatter(PopcntSwitchT,
         low = _bit_scan_forward(bits);
         bits ^= 1 << low;
         mem[indexes[low]] = v[low];
+        // fallthrough
     case 6:
         high = _bit_scan_reverse(bits);
         mem[indexes[high]] = v[high];
         high = (1 << high);
+        // fallthrough
     case 5:
         low = _bit_scan_forward(bits);
         bits ^= high | (1 << low);
         mem[indexes[low]] = v[low];
+        // fallthrough
     case 4:
         high = _bit_scan_reverse(bits);
         mem[indexes[high]] = v[high];
         high = (1 << high);
+        // fallthrough
     case 3:
         low = _bit_scan_forward(bits);
         bits ^= high | (1 << low);
         mem[indexes[low]] = v[low];
+        // fallthrough
     case 2:
         high = _bit_scan_reverse(bits);
         mem[indexes[high]] = v[high];
+        // fallthrough
     case 1:
         low = _bit_scan_forward(bits);
         mem[indexes[low]] = v[low];
+        // fallthrough
     case 0:
         break;
     }
@@ -232,12 +254,15 @@ Vc_ALWAYS_INLINE void executeScatter(PopcntSwitchT,
         low = _bit_scan_forward(bits);
         bits ^= 1 << low;
         mem[indexes[low]] = v[low];
+        // fallthrough
     case 2:
         high = _bit_scan_reverse(bits);
         mem[indexes[high]] = v[high];
+        // fallthrough
     case 1:
         low = _bit_scan_forward(bits);
         mem[indexes[low]] = v[low];
+        // fallthrough
     case 0:
         break;
     }
@@ -259,11 +284,29 @@ Vc_ALWAYS_INLINE void executeScatter(PopcntSwitchT,
     case 1:
         low = _bit_scan_forward(bits);
         mem[indexes[low]] = v[low];
+        // fallthrough
     case 0:
         break;
     }
 }
 
+template <typename V, typename MT, typename IT>
+Vc_ALWAYS_INLINE void executeScatter(AdaptiveT,
+                                    V &v,
+                                    MT *mem,
+                                    const IT &indexes,
+                                    typename V::MaskArgument mask)
+{
+    const std::size_t count = mask.count();
+    if (count == V::Size) {
+        v.scatter(mem, indexes);
+    } else if (count <= AdaptiveSparseLimit<V>::value) {
+        executeScatter(BitScanLoopT(), v, mem, indexes, mask);
+    } else {
+        executeScatter(PopcntSwitchT(), v, mem, indexes, mask);
+    }
+}
+
 }  // namespace Common
 }  // namespace Vc
 
@@ -0,0 +1,242 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_SIMD_VECTOR_H_
+#define VC_COMMON_SIMD_VECTOR_H_
+
+#include <stdexcept>
+#include <vector>
+#include "simdize.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \ingroup Simdize
+ * \headerfile simd_vector.h <Vc/simdize>
+ *
+ * A growable container of objects of type \p S that stores them in AoSoA layout.
+ *
+ * The objects are stored as an array of `simdize<S, N>` blocks, i.e. every block holds
+ * one SIMD vector per data member of \p S, and the block at index \c j holds the
+ * objects `j * lanes()` to `(j + 1) * lanes() - 1`. Thus vector(j) hands out a
+ * reference to an aligned simdized object without any load_interleaved or
+ * store_interleaved shuffles. The scalar interface (operator[], push_back, ...) reads
+ * and writes single lanes through proxy references.
+ *
+ * The lanes of the last block that are not part of the container hold `S()`, so that a
+ * loop over all blocks may process them without special treatment of the tail, as long
+ * as the result for those lanes is ignored.
+ *
+ * \code
+ * Vc::simd_vector<Point> points;
+ * points.push_back({1.f, 2.f, 3.f});
+ * for (auto &p : points) {  // iterates over simdize<Point> blocks
+ *     p.x() += 1.f;
+ * }
+ * Point first = points[0];
+ * \endcode
+ *
+ * \tparam S The scalar type, with the same requirements as for simdize. \p S must be
+ *           default constructible.
+ * \tparam N The number of lanes per block, see simdize.
+ */
+template <typename S, std::size_t N = 0> class simd_vector
+{
+public:
+    /// The simdized type that stores a block of lanes() objects.
+    using simd_type = simdize<S, N>;
+    using value_type = S;
+    using size_type = std::size_t;
+
+private:
+    using storage_type = std::vector<simd_type, Vc::Allocator<simd_type>>;
+
+public:
+    /// Iterators over the simd_type blocks.
+    using iterator = typename storage_type::iterator;
+    using const_iterator = typename storage_type::const_iterator;
+
+    /**
+     * Proxy reference to one object inside a simd_type block.
+     *
+     * Assignment from \p S writes every data member to its lane; conversion to \p S
+     * reads them.
+     */
+    class reference
+    {
+    public:
+        reference(simd_type &block, size_type lane) : block_(block), lane_(lane) {}
+        reference(const reference &) = default;
+
+        reference &operator=(const S &x)
+        {
+            Vc::assign(block_, lane_, x);
+            return *this;
+        }
+        reference &operator=(const reference &x) { return operator=(S(x)); }
+        operator S() const { return Vc::extract(block_, lane_); }
+
+        friend void swap(reference a, reference b)
+        {
+            const S tmp = a;
+            a = b;
+            b = tmp;
+        }
+
+    private:
+        simd_type &block_;
+        size_type lane_;
+    };
+    using const_reference = S;
+
+    /// The number of objects per simd_type block.
+    static constexpr size_type lanes() { return simd_type::size(); }
+
+    simd_vector() = default;
+    /// Constructs a container with \p n copies of \p x.
+    explicit simd_vector(size_type n, const S &x = S()) { resize(n, x); }
+    simd_vector(std::initializer_list<S> init)
+    {
+        reserve(init.size());
+        for (const S &x : init) {
+            push_back(x);
+        }
+    }
+
+    /// Returns the number of objects in the container.
+    size_type size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    /// Returns the number of objects the container can hold without reallocation.
+    size_type capacity() const { return blocks_.capacity() * lanes(); }
+    /// Returns the number of simd_type blocks, i.e. size() rounded up to whole blocks.
+    size_type vectorsCount() const { return blocks_.size(); }
+
+    /// Reserves space for at least \p n objects.
+    void reserve(size_type n) { blocks_.reserve((n + lanes() - 1) / lanes()); }
+
+    void clear()
+    {
+        blocks_.clear();
+        size_ = 0;
+    }
+
+    /**
+     * Changes the number of objects to \p n. New objects are copies of \p x.
+     */
+    void resize(size_type n, const S &x = S())
+    {
+        if (n < size_) {
+            blocks_.resize((n + lanes() - 1) / lanes());
+            resetTail(n);
+        } else if (n > size_) {
+            const simd_type broadcast = x;
+            for (; size_ < n && size_ % lanes() != 0; ++size_) {
+                (*this)[size_] = x;
+            }
+            blocks_.resize((n + lanes() - 1) / lanes(), broadcast);
+            resetTail(n);
+        }
+        size_ = n;
+    }
+
+    void push_back(const S &x)
+    {
+        if (size_ % lanes() == 0) {
+            blocks_.emplace_back(S());
+        }
+        Vc::assign(blocks_.back(), size_ % lanes(), x);
+        ++size_;
+    }
+
+    void pop_back()
+    {
+        --size_;
+        if (size_ % lanes() == 0) {
+            blocks_.pop_back();
+        } else {
+            Vc::assign(blocks_.back(), size_ % lanes(), S());
+        }
+    }
+
+    /// Scalar access to the object at index \p i.
+    reference operator[](size_type i) { return {blocks_[i / lanes()], i % lanes()}; }
+    const_reference operator[](size_type i) const
+    {
+        return Vc::extract(blocks_[i / lanes()], i % lanes());
+    }
+    reference at(size_type i)
+    {
+        if (i >= size_) {
+            throw std::out_of_range("Vc::simd_vector::at");
+        }
+        return operator[](i);
+    }
+    const_reference at(size_type i) const
+    {
+        if (i >= size_) {
+            throw std::out_of_range("Vc::simd_vector::at");
+        }
+        return operator[](i);
+    }
+    reference front() { return operator[](0); }
+    const_reference front() const { return operator[](0); }
+    reference back() { return operator[](size_ - 1); }
+    const_reference back() const { return operator[](size_ - 1); }
+
+    /**
+     * Returns a reference to the block that stores the objects `i * lanes()` to
+     * `(i + 1) * lanes() - 1`.
+     */
+    simd_type &vector(size_type i) { return blocks_[i]; }
+    const simd_type &vector(size_type i) const { return blocks_[i]; }
+
+    /// Iterators over the simd_type blocks.
+    iterator begin() { return blocks_.begin(); }
+    const_iterator begin() const { return blocks_.begin(); }
+    const_iterator cbegin() const { return blocks_.cbegin(); }
+    iterator end() { return blocks_.end(); }
+    const_iterator end() const { return blocks_.end(); }
+    const_iterator cend() const { return blocks_.cend(); }
+
+private:
+    // sets the lanes from n to the end of the last block to S()
+    void resetTail(size_type n)
+    {
+        for (size_type i = n; i % lanes() != 0; ++i) {
+            Vc::assign(blocks_.back(), i % lanes(), S());
+        }
+    }
+
+    storage_type blocks_;
+    size_type size_ = 0;
+};
+}  // namespace Vc
+
+#endif  // VC_COMMON_SIMD_VECTOR_H_
+
+// vim: foldmethod=marker
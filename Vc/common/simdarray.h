@@ -33,6 +33,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //#include "../IO"
 
 #include <array>
+#include <limits>
 
 #include "writemaskedvector.h"
 #include "simdarrayhelper.h"
@@ -68,6 +69,9 @@ struct select_best_vector_type_impl<N, T, Candidates...> {
 };
 template <class T, std::size_t N>
 struct select_best_vector_type : select_best_vector_type_impl<N,
+#ifdef Vc_IMPL_AVX512
+                                                              Vc::Vector<T, VectorAbi::Avx512Abi<T>>,
+#endif
 #ifdef Vc_IMPL_AVX2
                                                               Vc::AVX2::Vector<T>,
 #elif defined Vc_IMPL_AVX
@@ -306,6 +310,16 @@ public:
         data.store(std::forward<Args>(args)...);
     }
 
+    Vc_INTRINSIC int compress_store(value_type *mem, const mask_type &mask) const
+    {
+        return data.compress_store(mem, internal_data(mask));
+    }
+
+    Vc_INTRINSIC int expand_load(const value_type *mem, const mask_type &mask)
+    {
+        return data.expand_load(mem, internal_data(mask));
+    }
+
     Vc_INTRINSIC mask_type operator!() const
     {
         return {private_init, !data};
@@ -945,6 +959,18 @@ public:
         data1.store(mem + storage_type0::size(), Split::hi(std::forward<Args>(args))...);
     }
 
+    Vc_INTRINSIC int compress_store(value_type *mem, const mask_type &mask) const
+    {
+        const int n = data0.compress_store(mem, internal_data0(mask));
+        return n + data1.compress_store(mem + n, internal_data1(mask));
+    }
+
+    Vc_INTRINSIC int expand_load(const value_type *mem, const mask_type &mask)
+    {
+        const int n = data0.expand_load(mem, internal_data0(mask));
+        return n + data1.expand_load(mem + n, internal_data1(mask));
+    }
+
     Vc_INTRINSIC mask_type operator!() const
     {
         return {!data0, !data1};
@@ -1803,13 +1829,22 @@ Vc_ALL_COMPARES(Vc_BINARY_OPERATORS_);
  */
 ///@{
 Vc_FORWARD_UNARY_OPERATOR(abs);
+Vc_FORWARD_UNARY_OPERATOR(acos);
 Vc_FORWARD_UNARY_OPERATOR(asin);
+Vc_FORWARD_UNARY_OPERATOR(asinh);
 Vc_FORWARD_UNARY_OPERATOR(atan);
 Vc_FORWARD_BINARY_OPERATOR(atan2);
+Vc_FORWARD_UNARY_OPERATOR(atanh);
+Vc_FORWARD_UNARY_OPERATOR(cbrt);
 Vc_FORWARD_UNARY_OPERATOR(ceil);
 Vc_FORWARD_BINARY_OPERATOR(copysign);
 Vc_FORWARD_UNARY_OPERATOR(cos);
+Vc_FORWARD_UNARY_OPERATOR(cosh);
+Vc_FORWARD_UNARY_OPERATOR(erf);
+Vc_FORWARD_UNARY_OPERATOR(erfc);
 Vc_FORWARD_UNARY_OPERATOR(exp);
+Vc_FORWARD_UNARY_OPERATOR(exp2);
+Vc_FORWARD_UNARY_OPERATOR(expm1);
 Vc_FORWARD_UNARY_OPERATOR(exponent);
 Vc_FORWARD_UNARY_OPERATOR(floor);
 /// Applies the std::fma function component-wise and concurrently.
@@ -1835,13 +1870,19 @@ inline SimdArray<T, N> ldexp(const SimdArray<T, N> &x, const SimdArray<int, N> &
 {
     return SimdArray<T, N>::fromOperation(Common::Operations::Forward_ldexp(), x, e);
 }
+Vc_FORWARD_UNARY_OPERATOR(lgamma);
 Vc_FORWARD_UNARY_OPERATOR(log);
 Vc_FORWARD_UNARY_OPERATOR(log10);
+Vc_FORWARD_UNARY_OPERATOR(log1p);
 Vc_FORWARD_UNARY_OPERATOR(log2);
+Vc_FORWARD_UNARY_OPERATOR(normcdf);
+Vc_FORWARD_UNARY_OPERATOR(normcdfinv);
+Vc_FORWARD_BINARY_OPERATOR(pow);
 Vc_FORWARD_UNARY_OPERATOR(reciprocal);
 Vc_FORWARD_UNARY_OPERATOR(round);
 Vc_FORWARD_UNARY_OPERATOR(rsqrt);
 Vc_FORWARD_UNARY_OPERATOR(sin);
+Vc_FORWARD_UNARY_OPERATOR(sinh);
 /// Determines sine and cosine concurrently and component-wise on \p x.
 template <typename T, std::size_t N>
 void sincos(const SimdArray<T, N> &x, SimdArray<T, N> *sin, SimdArray<T, N> *cos)
@@ -1849,6 +1890,8 @@ void sincos(const SimdArray<T, N> &x, SimdArray<T, N> *sin, SimdArray<T, N> *cos
     SimdArray<T, N>::callOperation(Common::Operations::Forward_sincos(), x, sin, cos);
 }
 Vc_FORWARD_UNARY_OPERATOR(sqrt);
+Vc_FORWARD_UNARY_OPERATOR(tan);
+Vc_FORWARD_UNARY_OPERATOR(tanh);
 Vc_FORWARD_UNARY_OPERATOR(trunc);
 Vc_FORWARD_BINARY_OPERATOR(min);
 Vc_FORWARD_BINARY_OPERATOR(max);
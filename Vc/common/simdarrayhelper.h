@@ -28,6 +28,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef VC_COMMON_SIMDARRAYHELPER_H_
 #define VC_COMMON_SIMDARRAYHELPER_H_
 
+#include <cstring>
 #include "macros.h"
 
 namespace Vc_VERSIONED_NAMESPACE
@@ -88,13 +89,22 @@ Vc_DEFINE_OPERATION(random, v = V::Random());
         }                                                                                \
     }
 Vc_DEFINE_OPERATION_FORWARD(abs);
+Vc_DEFINE_OPERATION_FORWARD(acos);
 Vc_DEFINE_OPERATION_FORWARD(asin);
+Vc_DEFINE_OPERATION_FORWARD(asinh);
 Vc_DEFINE_OPERATION_FORWARD(atan);
 Vc_DEFINE_OPERATION_FORWARD(atan2);
+Vc_DEFINE_OPERATION_FORWARD(atanh);
+Vc_DEFINE_OPERATION_FORWARD(cbrt);
 Vc_DEFINE_OPERATION_FORWARD(cos);
+Vc_DEFINE_OPERATION_FORWARD(cosh);
 Vc_DEFINE_OPERATION_FORWARD(ceil);
 Vc_DEFINE_OPERATION_FORWARD(copysign);
+Vc_DEFINE_OPERATION_FORWARD(erf);
+Vc_DEFINE_OPERATION_FORWARD(erfc);
 Vc_DEFINE_OPERATION_FORWARD(exp);
+Vc_DEFINE_OPERATION_FORWARD(exp2);
+Vc_DEFINE_OPERATION_FORWARD(expm1);
 Vc_DEFINE_OPERATION_FORWARD(exponent);
 Vc_DEFINE_OPERATION_FORWARD(fma);
 Vc_DEFINE_OPERATION_FORWARD(floor);
@@ -104,15 +114,23 @@ Vc_DEFINE_OPERATION_FORWARD(isinf);
 Vc_DEFINE_OPERATION_FORWARD(isnan);
 Vc_DEFINE_OPERATION_FORWARD(isnegative);
 Vc_DEFINE_OPERATION_FORWARD(ldexp);
+Vc_DEFINE_OPERATION_FORWARD(lgamma);
 Vc_DEFINE_OPERATION_FORWARD(log);
 Vc_DEFINE_OPERATION_FORWARD(log10);
+Vc_DEFINE_OPERATION_FORWARD(log1p);
 Vc_DEFINE_OPERATION_FORWARD(log2);
+Vc_DEFINE_OPERATION_FORWARD(normcdf);
+Vc_DEFINE_OPERATION_FORWARD(normcdfinv);
+Vc_DEFINE_OPERATION_FORWARD(pow);
 Vc_DEFINE_OPERATION_FORWARD(reciprocal);
 Vc_DEFINE_OPERATION_FORWARD(round);
 Vc_DEFINE_OPERATION_FORWARD(rsqrt);
 Vc_DEFINE_OPERATION_FORWARD(sin);
+Vc_DEFINE_OPERATION_FORWARD(sinh);
 Vc_DEFINE_OPERATION_FORWARD(sincos);
 Vc_DEFINE_OPERATION_FORWARD(sqrt);
+Vc_DEFINE_OPERATION_FORWARD(tan);
+Vc_DEFINE_OPERATION_FORWARD(tanh);
 Vc_DEFINE_OPERATION_FORWARD(trunc);
 Vc_DEFINE_OPERATION_FORWARD(min);
 Vc_DEFINE_OPERATION_FORWARD(max);
@@ -171,19 +189,41 @@ struct Segment<T_ *, Pieces_, Index_> {
 
     static constexpr std::size_t EntryOffset = Index * type_decayed::size() / Pieces;
 
-    fixed_size_type to_fixed_size() const
-    {
-        return reinterpret_cast<
-#ifdef Vc_GCC
-                   // GCC might ICE if this type is declared with may_alias. If it doesn't
-                   // ICE it warns about ignoring the attribute.
-                   typename std::remove_pointer<fixed_size_type>::type
-#else
-                   MayAlias<typename std::remove_pointer<fixed_size_type>::type>
-#endif
-                       *>(data) +
-               Index;
-    }
+    /**\internal
+     * Converts to a pointer to a temporary copy of the segment, which is written back to
+     * \c data on destruction, i.e. after the operation that received the pointer. A
+     * pointer of type fixed_size_type into \c data would violate strict aliasing (GCC
+     * ignores may_alias on class types) and let the compiler reorder the writes of the
+     * operation, e.g. frexp, with later reads of \c data.
+     */
+    class WriteBack
+    {
+        using value_type = typename std::remove_pointer<fixed_size_type>::type;
+        value_type value;
+        char *target;
+
+    public:
+        explicit WriteBack(type p)
+            : target(reinterpret_cast<char *>(p) + Index * sizeof(value_type))
+        {
+            std::memcpy(static_cast<void *>(&value), target, sizeof(value_type));
+        }
+        WriteBack(WriteBack &&rhs) : value(rhs.value), target(rhs.target)
+        {
+            rhs.target = nullptr;
+        }
+        WriteBack(const WriteBack &) = delete;
+        WriteBack &operator=(const WriteBack &) = delete;
+        ~WriteBack()
+        {
+            if (target) {
+                std::memcpy(target, &value, sizeof(value_type));
+            }
+        }
+        operator fixed_size_type() { return &value; }
+    };
+
+    WriteBack to_fixed_size() const { return WriteBack(data); }
 
     //decltype(std::declval<type>()[0]) operator[](size_t i) { return data[i + EntryOffset]; }
     //decltype(std::declval<type>()[0]) operator[](size_t i) const { return data[i + EntryOffset]; }
@@ -314,6 +354,28 @@ template <std::size_t secondOffset> class Split
         return simd_cast<SSE::Mask<T>, 1>(x);
     }
 #endif  // Vc_IMPL_AVX
+#ifdef Vc_IMPL_AVX512
+    template <class T>
+    static Vc_INTRINSIC AVX2::Vector<T> loImpl(Vector<T, VectorAbi::Avx512> &&x)
+    {
+        return simd_cast<AVX2::Vector<T>, 0>(x);
+    }
+    template <class T>
+    static Vc_INTRINSIC AVX2::Vector<T> hiImpl(Vector<T, VectorAbi::Avx512> &&x)
+    {
+        return simd_cast<AVX2::Vector<T>, 1>(x);
+    }
+    template <class T>
+    static Vc_INTRINSIC AVX2::Mask<T> loImpl(Mask<T, VectorAbi::Avx512> &&x)
+    {
+        return simd_cast<AVX2::Mask<T>, 0>(x);
+    }
+    template <class T>
+    static Vc_INTRINSIC AVX2::Mask<T> hiImpl(Mask<T, VectorAbi::Avx512> &&x)
+    {
+        return simd_cast<AVX2::Mask<T>, 1>(x);
+    }
+#endif  // Vc_IMPL_AVX512
     template <typename T>
     static constexpr bool is_vector_or_mask(){
         return (Traits::is_simd_vector<T>::value && !Traits::isSimdArray<T>::value) ||
@@ -466,8 +528,8 @@ static Vc_INTRINSIC V *actual_value(Op, SimdArray<U, M, V, M> *x)
   return &internal_data(*x);
 }
 template <typename Op, typename T, size_t Pieces, size_t Index>
-static Vc_INTRINSIC typename Segment<T, Pieces, Index>::fixed_size_type actual_value(
-    Op, Segment<T, Pieces, Index> &&seg)
+static Vc_INTRINSIC auto actual_value(Op, Segment<T, Pieces, Index> &&seg)
+    -> decltype(seg.to_fixed_size())
 {
     return seg.to_fixed_size();
 }
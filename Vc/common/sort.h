@@ -0,0 +1,644 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_SORT_H_
+#define VC_COMMON_SORT_H_
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include "../vector.h"
+#include "algorithms.h"
+#include "simdarray.h"
+#include "threadpool.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// sort constants {{{
+/// Ranges with at least this many elements are sorted on the thread pool.
+constexpr std::size_t simd_sort_parallel_threshold = std::size_t(1) << 17;
+/// Number of registers in a tile that is sorted completely before the global merge
+/// passes. A tile of 1024 registers fits into the L1/L2 data cache for all ABIs.
+constexpr std::size_t simd_sort_tile_registers = 1024;
+
+template <class T> struct is_simd_sortable
+    : public std::integral_constant<bool, std::is_same<T, float>::value ||
+                                              std::is_same<T, double>::value ||
+                                              std::is_same<T, int>::value ||
+                                              std::is_same<T, unsigned int>::value> {
+};
+// }}}
+// SortBuffer {{{
+// owning, vector-aligned scratch memory
+template <class T> class SortBuffer
+{
+public:
+    explicit SortBuffer(std::size_t n) : m_data(Vc::malloc<T, Vc::AlignOnVector>(n)) {}
+    ~SortBuffer() { Vc::free(m_data); }
+    SortBuffer(const SortBuffer &) = delete;
+    SortBuffer &operator=(const SortBuffer &) = delete;
+    T *get() const { return m_data; }
+
+private:
+    T *m_data;
+};
+// }}}
+// xor_permute {{{
+// returns the vector where lane i holds v[i ^ j]
+template <class V> Vc_INTRINSIC V xor_permute(const V &v, int j)
+{
+    return V::generate([&](int i) { return v[i ^ j]; });
+}
+// }}}
+// SortKeys {{{
+// Sorts keys only. The register-level step uses Vector::sorted() (the optimized
+// sorting networks in src/*_sorthelper.cpp); two sorted registers are merged with one
+// bitonic split.
+template <class T> struct SortKeys {
+    using V = Vector<T>;
+    static constexpr std::size_t N = V::Size;
+    using Buffer = SortBuffer<T>;
+
+    T *key;
+
+    SortKeys at(std::size_t i) const { return {key + i}; }
+    static SortKeys from(const Buffer &b) { return {b.get()}; }
+
+    static void copy(SortKeys src, SortKeys dst, std::size_t n)
+    {
+        std::copy(src.key, src.key + n, dst.key);
+    }
+
+    // sorts each register-sized block of [h, h + n), n is a multiple of N
+    static void sortRegisters(SortKeys h, std::size_t n)
+    {
+        for (std::size_t i = 0; i < n; i += N) {
+            V(h.key + i, Vc::Unaligned).sorted().store(h.key + i, Vc::Unaligned);
+        }
+    }
+
+    // a receives the smaller, b the larger half of the two sorted registers
+    static Vc_INTRINSIC void mergeRegisters(V &a, V &b)
+    {
+        const V r = b.reversed();
+        b = max(a, r).sorted();
+        a = min(a, r).sorted();
+    }
+
+    // merges the sorted runs [a, a + na) and [b, b + nb) into out, na and nb are
+    // non-zero multiples of N
+    static void merge(SortKeys a, std::size_t na, SortKeys b, std::size_t nb,
+                      SortKeys out)
+    {
+        const T *pa = a.key, *pb = b.key;
+        const T *const aEnd = pa + na, *const bEnd = pb + nb;
+        T *o = out.key;
+        V lo(pa, Vc::Unaligned);
+        V hi(pb, Vc::Unaligned);
+        pa += N;
+        pb += N;
+        for (;;) {
+            mergeRegisters(lo, hi);
+            lo.store(o, Vc::Unaligned);
+            o += N;
+            if (pa != aEnd && (pb == bEnd || !(*pb < *pa))) {
+                lo.load(pa, Vc::Unaligned);
+                pa += N;
+            } else if (pb != bEnd) {
+                lo.load(pb, Vc::Unaligned);
+                pb += N;
+            } else {
+                break;
+            }
+        }
+        hi.store(o, Vc::Unaligned);
+    }
+
+    // [h, h + n0) is sorted; merges the remaining n - n0 < N elements into it
+    static void mergeTail(SortKeys h, std::size_t n0, std::size_t n)
+    {
+        T tail[N];
+        const std::size_t nt = n - n0;
+        for (std::size_t i = 0; i < nt; ++i) {  // insertion sort of the tail
+            std::size_t j = i;
+            for (; j > 0 && h.key[n0 + i] < tail[j - 1]; --j) {
+                tail[j] = tail[j - 1];
+            }
+            tail[j] = h.key[n0 + i];
+        }
+        std::size_t i = n0, j = nt, o = n;
+        while (j > 0) {
+            if (i > 0 && tail[j - 1] < h.key[i - 1]) {
+                h.key[--o] = h.key[--i];
+            } else {
+                h.key[--o] = tail[--j];
+            }
+        }
+    }
+};
+// }}}
+// SortKeyValues {{{
+// Sorts keys and applies the same permutation to the values. The value registers have
+// as many lanes as the key registers, therefore the network is implemented with masked
+// assignments instead of Vector::sorted().
+template <class K, class P> struct SortKeyValues {
+    using V = Vector<K>;
+    static constexpr std::size_t N = V::Size;
+    using PV = fixed_size_simd<P, N>;
+    using I = fixed_size_simd<int, N>;
+
+    struct Buffer {
+        explicit Buffer(std::size_t n) : key(n), value(n) {}
+        SortBuffer<K> key;
+        SortBuffer<P> value;
+    };
+
+    K *key;
+    P *value;
+
+    SortKeyValues at(std::size_t i) const { return {key + i, value + i}; }
+    static SortKeyValues from(const Buffer &b) { return {b.key.get(), b.value.get()}; }
+
+    static void copy(SortKeyValues src, SortKeyValues dst, std::size_t n)
+    {
+        std::copy(src.key, src.key + n, dst.key);
+        std::copy(src.value, src.value + n, dst.value);
+    }
+
+    // one compare-exchange stage of a bitonic network: lanes i and i ^ j are compared,
+    // lanes where keepMin is set keep the smaller key
+    static Vc_INTRINSIC void exchange(V &k, PV &p, int j, const typename I::mask_type &keepMin)
+    {
+        const V pk = xor_permute(k, j);
+        const PV pp = xor_permute(p, j);
+        const auto keepMinK = simd_cast<typename V::mask_type>(keepMin);
+        const auto take = (keepMinK && pk < k) || (!keepMinK && k < pk);
+        p(simd_cast<typename PV::mask_type>(take)) = pp;
+        k(take) = pk;
+    }
+
+    // sorts the bitonic register (k, p)
+    static Vc_INTRINSIC void bitonicClean(V &k, PV &p)
+    {
+        const I idx([](int i) { return i; });
+        for (int j = N / 2; j > 0; j /= 2) {
+            exchange(k, p, j, (idx & j) == 0);
+        }
+    }
+
+    static void sortRegisters(SortKeyValues h, std::size_t n)
+    {
+        const I idx([](int i) { return i; });
+        for (std::size_t i = 0; i < n; i += N) {
+            V k(h.key + i, Vc::Unaligned);
+            PV p(h.value + i, Vc::Unaligned);
+            for (int size = 2; size <= int(N); size *= 2) {
+                const auto ascending = (idx & size) == 0;
+                for (int j = size / 2; j > 0; j /= 2) {
+                    exchange(k, p, j, !(((idx & j) == 0) ^ ascending));
+                }
+            }
+            k.store(h.key + i, Vc::Unaligned);
+            p.store(h.value + i, Vc::Unaligned);
+        }
+    }
+
+    static Vc_INTRINSIC void mergeRegisters(V &ka, PV &pa, V &kb, PV &pb)
+    {
+        const V rk = kb.reversed();
+        const PV rp = pb.reversed();
+        const auto m = rk < ka;
+        const auto mp = simd_cast<typename PV::mask_type>(m);
+        kb = iif(m, ka, rk);
+        pb = iif(mp, pa, rp);
+        ka = iif(m, rk, ka);
+        pa = iif(mp, rp, pa);
+        bitonicClean(ka, pa);
+        bitonicClean(kb, pb);
+    }
+
+    static void merge(SortKeyValues a, std::size_t na, SortKeyValues b, std::size_t nb,
+                      SortKeyValues out)
+    {
+        std::size_t ia = N, ib = N;
+        V klo(a.key, Vc::Unaligned), khi(b.key, Vc::Unaligned);
+        PV plo(a.value, Vc::Unaligned), phi(b.value, Vc::Unaligned);
+        for (std::size_t o = 0;; o += N) {
+            mergeRegisters(klo, plo, khi, phi);
+            klo.store(out.key + o, Vc::Unaligned);
+            plo.store(out.value + o, Vc::Unaligned);
+            if (ia != na && (ib == nb || !(b.key[ib] < a.key[ia]))) {
+                klo.load(a.key + ia, Vc::Unaligned);
+                plo.load(a.value + ia, Vc::Unaligned);
+                ia += N;
+            } else if (ib != nb) {
+                klo.load(b.key + ib, Vc::Unaligned);
+                plo.load(b.value + ib, Vc::Unaligned);
+                ib += N;
+            } else {
+                khi.store(out.key + o + N, Vc::Unaligned);
+                phi.store(out.value + o + N, Vc::Unaligned);
+                return;
+            }
+        }
+    }
+
+    static void mergeTail(SortKeyValues h, std::size_t n0, std::size_t n)
+    {
+        K tk[N];
+        P tp[N];
+        const std::size_t nt = n - n0;
+        for (std::size_t i = 0; i < nt; ++i) {  // insertion sort of the tail
+            std::size_t j = i;
+            for (; j > 0 && h.key[n0 + i] < tk[j - 1]; --j) {
+                tk[j] = tk[j - 1];
+                tp[j] = tp[j - 1];
+            }
+            tk[j] = h.key[n0 + i];
+            tp[j] = h.value[n0 + i];
+        }
+        std::size_t i = n0, j = nt, o = n;
+        while (j > 0) {
+            --o;
+            if (i > 0 && tk[j - 1] < h.key[i - 1]) {
+                --i;
+                h.key[o] = h.key[i];
+                h.value[o] = h.value[i];
+            } else {
+                --j;
+                h.key[o] = tk[j];
+                h.value[o] = tp[j];
+            }
+        }
+    }
+};
+// }}}
+// simd_sort_impl {{{
+// Bottom-up merge sort of [h, h + n). Tiles of simd_sort_tile_registers registers are
+// sorted independently (in parallel for large n) while they are hot in cache, followed
+// by global merge passes whose independent merges are distributed over the pool. The
+// n % N trailing elements are merged in at the end.
+template <class H> void simd_sort_impl(H h, std::size_t n)
+{
+    constexpr std::size_t N = H::N;
+    constexpr std::size_t tile = N * simd_sort_tile_registers;
+    const std::size_t n0 = n - n % N;
+    if (n0 > N) {
+        typename H::Buffer buffer(n0);
+        const H scratch = H::from(buffer);
+        const bool parallel = n0 >= simd_sort_parallel_threshold;
+
+        // merges all pairs of runs of width w from src into dst; returns whether
+        // the pass was executed in parallel
+        auto mergePass = [&](H src, H dst, std::size_t begin, std::size_t end,
+                             std::size_t w, bool inParallel) {
+            const std::size_t pairs = (end - begin + 2 * w - 1) / (2 * w);
+            auto mergePair = [&](std::size_t k) {
+                const std::size_t first = begin + k * 2 * w;
+                const std::size_t mid = std::min(first + w, end);
+                const std::size_t last = std::min(first + 2 * w, end);
+                if (mid == last) {
+                    H::copy(src.at(first), dst.at(first), last - first);
+                } else {
+                    H::merge(src.at(first), mid - first, src.at(mid), last - mid,
+                             dst.at(first));
+                }
+            };
+            if (inParallel && pairs > 1) {
+                Detail::parallel_for(pairs, mergePair);
+            } else {
+                for (std::size_t k = 0; k < pairs; ++k) {
+                    mergePair(k);
+                }
+            }
+        };
+
+        // sort every tile; the result is in h
+        auto sortTile = [&](std::size_t t) {
+            const std::size_t begin = t * tile;
+            const std::size_t end = std::min(begin + tile, n0);
+            H::sortRegisters(h.at(begin), end - begin);
+            H src = h, dst = scratch;
+            for (std::size_t w = N; w < end - begin; w *= 2) {
+                mergePass(src, dst, begin, end, w, false);
+                std::swap(src, dst);
+            }
+            if (src.key != h.key) {
+                H::copy(src.at(begin), h.at(begin), end - begin);
+            }
+        };
+        const std::size_t tiles = (n0 + tile - 1) / tile;
+        if (parallel) {
+            Detail::parallel_for(tiles, sortTile);
+        } else {
+            for (std::size_t t = 0; t < tiles; ++t) {
+                sortTile(t);
+            }
+        }
+
+        H src = h, dst = scratch;
+        for (std::size_t w = tile; w < n0; w *= 2) {
+            mergePass(src, dst, 0, n0, w, parallel);
+            std::swap(src, dst);
+        }
+        if (src.key != h.key) {
+            H::copy(src, h, n0);
+        }
+    } else if (n0 == N) {
+        H::sortRegisters(h, N);
+    }
+    if (n0 != n) {
+        H::mergeTail(h, n0, n);
+    }
+}
+// }}}
+// NaN keys {{{
+// The min/max based sorting networks would duplicate or drop NaN keys. They are
+// therefore moved behind all other keys before sorting; the functions return the
+// number of remaining keys.
+struct simd_sort_isnan {
+    template <class V> Vc_INTRINSIC auto operator()(const V &x) const -> decltype(isnan(x))
+    {
+        return isnan(x);
+    }
+};
+
+template <class T> Vc_INTRINSIC std::size_t simd_sort_drop_nans(T *, std::size_t n, std::false_type)
+{
+    return n;
+}
+template <class T> std::size_t simd_sort_drop_nans(T *key, std::size_t n, std::true_type)
+{
+    T *const nan = simd_find_if(key, key + n, simd_sort_isnan());
+    if (nan == key + n) {
+        return n;
+    }
+    return simd_partition(nan, key + n, simd_not_fn<simd_sort_isnan>{{}}) - key;
+}
+
+template <class K, class P>
+Vc_INTRINSIC std::size_t simd_sort_drop_nans(K *, P *, std::size_t n, std::false_type)
+{
+    return n;
+}
+template <class K, class P>
+std::size_t simd_sort_drop_nans(K *key, P *value, std::size_t n, std::true_type)
+{
+    // NaN keys are rare; after the vectorized search the pairs are moved one by one
+    std::size_t i = simd_find_if(key, key + n, simd_sort_isnan()) - key;
+    for (std::size_t j = i; j < n; ++j) {
+        if (!(key[j] != key[j])) {
+            std::swap(key[i], key[j]);
+            std::swap(value[i], value[j]);
+            ++i;
+        }
+    }
+    return i;
+}
+// }}}
+// simd_sort_partitioned {{{
+template <class T> struct simd_less_than_value {
+    T value;
+    template <class V> Vc_INTRINSIC auto operator()(const V &x) const -> decltype(x < x)
+    {
+        return x < V(value);
+    }
+};
+template <class T> struct simd_less_equal_value {
+    T value;
+    template <class V> Vc_INTRINSIC auto operator()(const V &x) const -> decltype(x <= x)
+    {
+        return x <= V(value);
+    }
+};
+
+// median of one register of keys sampled evenly from [key, key + n)
+template <class T> Vc_INTRINSIC T simd_sort_pivot(const T *key, std::size_t n)
+{
+    using V = Vector<T>;
+    const V sample =
+        V::generate([&](std::size_t i) { return key[i * (n - 1) / (V::Size - 1)]; });
+    return sample.sorted()[V::Size / 2];
+}
+
+// Top level of simd_sort for ranges above simd_sort_parallel_threshold. Ranges are
+// split around a sampled pivot with simd_partition (two compress_stores per register)
+// until there are enough independent ranges for the thread pool; each range is then
+// merge-sorted by a single thread. Contrary to the global merge passes, the partition
+// passes work in place and run in parallel over all ranges from the second pass on.
+template <class T> void simd_sort_partitioned(T *key, std::size_t n)
+{
+    constexpr std::size_t N = Vector<T>::Size;
+    struct Range {
+        T *first;
+        std::size_t n;
+    };
+    const std::size_t target = 4 * parallel_concurrency();
+    const std::size_t limit = std::max(n / target, N * simd_sort_tile_registers);
+
+    std::vector<Range> ranges = {{key, n}};
+    std::vector<Range> parts;
+    // every pass shrinks all ranges above limit, the pass limit only guards against
+    // degenerate pivots
+    for (int pass = 0; pass < 64 && ranges.size() < target; ++pass) {
+        parts.assign(2 * ranges.size(), Range{key, 0});
+        bool split = false;
+        for (const Range &r : ranges) {
+            split = split || r.n > limit;
+        }
+        if (!split) {
+            break;
+        }
+        parallel_for(ranges.size(), [&](std::size_t k) {
+            const Range r = ranges[k];
+            T *const last = r.first + r.n;
+            if (r.n <= limit) {
+                parts[2 * k] = r;
+                return;
+            }
+            const T pivot = simd_sort_pivot(r.first, r.n);
+            T *mid = simd_partition(r.first, last, simd_less_than_value<T>{pivot});
+            if (mid == r.first) {
+                // pivot is the smallest key: [first, mid) holds only keys equal to the
+                // pivot and is sorted already
+                mid = simd_partition(r.first, last, simd_less_equal_value<T>{pivot});
+                parts[2 * k + 1] = {mid, std::size_t(last - mid)};
+            } else {
+                parts[2 * k] = {r.first, std::size_t(mid - r.first)};
+                parts[2 * k + 1] = {mid, std::size_t(last - mid)};
+            }
+        });
+        ranges.clear();
+        for (const Range &r : parts) {
+            if (r.n > 1) {
+                ranges.push_back(r);
+            }
+        }
+    }
+
+    // the largest ranges first, so that the small ones fill up the idle threads
+    std::sort(ranges.begin(), ranges.end(),
+              [](const Range &a, const Range &b) { return a.n > b.n; });
+    parallel_for(ranges.size(), [&](std::size_t k) {
+        simd_sort_impl(SortKeys<T>{ranges[k].first}, ranges[k].n);
+    });
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithm <Vc/algorithm>
+ *
+ * Sorts the contiguous range [\p first, \p last) in ascending order.
+ *
+ * The range is sorted with a SIMD merge sort: every register is sorted with the
+ * sorting network of Vector::sorted() and sorted runs are combined with a vectorized
+ * bitonic merge. Ranges with more than Detail::simd_sort_parallel_threshold elements
+ * are first split with the vectorized partition of simd_partition around sampled
+ * pivots, and the parts are sorted concurrently on the library's thread pool.
+ * Temporary memory of at most the size of the range is allocated.
+ *
+ * \param first Iterator to the first element of a contiguous range of \c float, \c
+ *              double, \c int, or \c unsigned \c int.
+ * \param last Iterator one past the last element of the range.
+ *
+ * \note The sort is not stable. NaNs are moved behind all other keys, in unspecified
+ * order; the result is therefore always a permutation of the input.
+ */
+template <class RandomIt>
+inline enable_if<
+    Detail::is_simd_sortable<typename std::iterator_traits<RandomIt>::value_type>::value,
+    void>
+simd_sort(RandomIt first, RandomIt last)
+{
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    if (last - first < 2) {
+        return;
+    }
+    T *const key = std::addressof(*first);
+    const std::size_t n = Detail::simd_sort_drop_nans(key, std::size_t(last - first),
+                                                      std::is_floating_point<T>());
+    if (Vector<T>::Size == 1) {
+        // without SIMD registers the merge network has nothing to gain
+        std::sort(key, key + n);
+    } else if (n >= Detail::simd_sort_parallel_threshold) {
+        Detail::simd_sort_partitioned(key, n);
+    } else {
+        Detail::simd_sort_impl(Detail::SortKeys<T>{key}, n);
+    }
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithm <Vc/algorithm>
+ *
+ * Sorts the keys in [\p first, \p last) in ascending order and reorders the range
+ * starting at \p values in the same way.
+ *
+ * \param first Iterator to the first key of a contiguous range (see simd_sort).
+ * \param last Iterator one past the last key.
+ * \param values Iterator to the first element of a contiguous range of \c double, \c
+ *               float, \c int, \c unsigned \c int, \c short, or \c unsigned \c short
+ *               with at least \p last - \p first elements.
+ *
+ * Contrary to the key-only simd_sort, large ranges are not partitioned first: moving
+ * the values along would need a second pair of compress_stores per register, while the
+ * merge passes already run on the thread pool.
+ *
+ * \note The sort is not stable: the relative order of values with equal keys is
+ * unspecified. Keys that are NaN are moved, with their values, behind all other keys.
+ */
+template <class RandomIt, class ValueIt>
+inline enable_if<
+    Detail::is_simd_sortable<typename std::iterator_traits<RandomIt>::value_type>::value,
+    void>
+simd_sort(RandomIt first, RandomIt last, ValueIt values)
+{
+    using K = typename std::iterator_traits<RandomIt>::value_type;
+    using P = typename std::iterator_traits<ValueIt>::value_type;
+    static_assert(Traits::is_valid_vector_argument<P>::value,
+                  "simd_sort requires values of type double, float, int, unsigned int, "
+                  "short, or unsigned short");
+    if (last - first < 2) {
+        return;
+    }
+    K *const key = std::addressof(*first);
+    P *const value = std::addressof(*values);
+    const std::size_t n = Detail::simd_sort_drop_nans(key, value, std::size_t(last - first),
+                                                      std::is_floating_point<K>());
+    Detail::simd_sort_impl(Detail::SortKeyValues<K, P>{key, value}, n);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithm <Vc/algorithm>
+ *
+ * Writes the permutation that sorts [\p first, \p last) to the range starting at \p
+ * indexes, i.e. <tt>first[indexes[0]] <= first[indexes[1]] <= ...</tt>. The input
+ * range is not modified.
+ * The indexes of NaN keys come last.
+ *
+ * \param first Iterator to the first key of a contiguous range (see simd_sort).
+ * \param last Iterator one past the last key.
+ * \param indexes Iterator to the first element of a contiguous range of \c int or \c
+ *                unsigned \c int with at least \p last - \p first elements.
+ */
+template <class RandomIt, class IndexIt>
+inline enable_if<
+    Detail::is_simd_sortable<typename std::iterator_traits<RandomIt>::value_type>::value,
+    void>
+simd_argsort(RandomIt first, RandomIt last, IndexIt indexes)
+{
+    using K = typename std::iterator_traits<RandomIt>::value_type;
+    using I = typename std::iterator_traits<IndexIt>::value_type;
+    static_assert(std::is_same<I, int>::value || std::is_same<I, unsigned int>::value,
+                  "simd_argsort requires int or unsigned int indexes");
+    const std::size_t n = last - first;
+    Detail::SortBuffer<K> keys(n);
+    std::copy(first, last, keys.get());
+    I *const idx = std::addressof(*indexes);
+    for (std::size_t i = 0; i < n; ++i) {
+        idx[i] = I(i);
+    }
+    if (n < 2) {
+        return;
+    }
+    const std::size_t m =
+        Detail::simd_sort_drop_nans(keys.get(), idx, n, std::is_floating_point<K>());
+    Detail::simd_sort_impl(Detail::SortKeyValues<K, I>{keys.get(), idx}, m);
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_SORT_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,352 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifdef Vc_COMMON_MATH_H_INTERNAL
+
+namespace Detail
+{
+// The kernels below are written for Vector<double, Abi> of any ABI (including Scalar).
+// Single-precision arguments are evaluated in double precision via SimdArray<double, N>.
+
+// erf_small {{{
+// erf(x) = x * P(x² - ½) for |x| ≤ 1.02, minimax fit with a relative error below 6·10⁻¹⁷.
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<double, Abi> erf_small(const Vector<double, Abi> &x)
+{
+    const Vector<double, Abi> v = x * x - 0.5;
+    Vector<double, Abi> p = -7.6380225137661143e-10;
+    p = p * v + 9.4338436136885538e-09;
+    p = p * v - 1.0421452578790268e-07;
+    p = p * v + 1.0536314485916694e-06;
+    p = p * v - 9.6148060441122913e-06;
+    p = p * v + 7.8296497082573952e-05;
+    p = p * v - 5.6118942239607636e-04;
+    p = p * v + 3.4802744965531768e-03;
+    p = p * v - 1.8283884489140902e-02;
+    p = p * v + 7.9409986755937370e-02;
+    p = p * v - 2.8107217804543438e-01;
+    p = p * v + 9.6546873866986727e-01;
+    return x * p;
+}
+
+// erfcx_kernel {{{
+// eˣ² * erfc(x) for x ∈ [½, 27.5]: with t = 1 / (x + 2), eˣ² * erfc(x) = t * P(t - t₀),
+// where t₀ is the center of the t interval. Minimax fit with a relative error below
+// 5·10⁻¹⁷. Finite and positive for all x ≥ ½, including +∞.
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<double, Abi> erfcx_kernel(const Vector<double, Abi> &x)
+{
+    const Vector<double, Abi> t = 1. / (x + 2.);
+    const Vector<double, Abi> v = t - 0.21694915254237288;
+    Vector<double, Abi> p = -1453826.4415131724;
+    p = p * v + 85965.429399321365;
+    p = p * v + 486567.21318129782;
+    p = p * v - 110064.459408814;
+    p = p * v - 66674.179943132389;
+    p = p * v + 38001.679549143548;
+    p = p * v - 561.28410766984393;
+    p = p * v - 6997.7058455073802;
+    p = p * v + 2582.3836955067777;
+    p = p * v + 616.44678909194295;
+    p = p * v - 777.02264207772032;
+    p = p * v + 89.478509201021396;
+    p = p * v + 166.33680845982357;
+    p = p * v - 63.875280214176357;
+    p = p * v - 32.74503989167102;
+    p = p * v + 24.154859357866325;
+    p = p * v + 8.2236011292730602;
+    p = p * v - 8.7454431911269559;
+    p = p * v - 4.2237709960885201;
+    p = p * v + 2.9793629019916574;
+    p = p * v + 4.2068167945770751;
+    p = p * v + 2.4614614126348635;
+    p = p * v + 0.93553177555064704;
+    return t * p;
+}
+
+// erfc_tail {{{
+// erfc(x) for x ≥ ½, where x = h + l is given as the sum of h = round(x * 2²¹) * 2⁻²¹
+// and a remainder |l| ≤ 2⁻²². h has at most 26 significant bits, thus h² is exact and
+// e^(-x²) = e^(-h²) * e^(-d) with d = l * (2h + l) and |d| < 2⁻¹⁶. Results that would be
+// smaller than about 2⁻¹⁰²² are flushed to zero.
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<double, Abi> erfc_tail(const Vector<double, Abi> &x,
+                                               const Vector<double, Abi> &h,
+                                               const Vector<double, Abi> &l)
+{
+    using V = Vector<double, Abi>;
+    const V d = l * (h + h + l);
+    const V expd = 1. - d * (1. - d * (0.5 - d * (1. / 6.)));
+    V r = exp(-(h * h)) * expd * erfcx_kernel(x);
+    r.setZero(x > 27.);  // also fixes h = ∞, l = NaN
+    return r;
+}
+
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<double, Abi> round_to_2pow21(const Vector<double, Abi> &x)
+{
+    return round(x * 2097152.) * (1. / 2097152.);
+}
+
+// erf {{{
+template <typename Abi> Vector<double, Abi> erf_kernel(const Vector<double, Abi> &x)
+{
+    using V = Vector<double, Abi>;
+    const V ax = abs(x);
+    const auto small = ax < 1.;
+    V r = erf_small(x);
+    if (!all_of(small)) {
+        const V h = round_to_2pow21(ax);
+        r(!small) = copysign(1. - erfc_tail(ax, h, ax - h), x);
+    }
+    return r;
+}
+
+// erfc {{{
+template <typename Abi> Vector<double, Abi> erfc_kernel(const Vector<double, Abi> &x)
+{
+    using V = Vector<double, Abi>;
+    const V ax = abs(x);
+    const auto small = ax < 0.5;
+    V r = 1. - erf_small(x);
+    if (!all_of(small)) {
+        const V h = round_to_2pow21(ax);
+        V t = erfc_tail(ax, h, ax - h);
+        t(x < 0.) = 2. - t;
+        r(!small) = t;
+    }
+    return r;
+}
+
+// normcdf {{{
+// Φ(x) = ½erfc(u) with u = -x / √2. For |u| ≥ ½ the rounding error of u is carried in
+// the remainder l of erfc_tail: l = (|x| - h√2) / √2, where √2 = s₀ + s₁ with a 25-bit
+// s₀, so that h * s₀ is exact and |x| - h * s₀ is exact by Sterbenz' lemma.
+template <typename Abi> Vector<double, Abi> normcdf_kernel(const Vector<double, Abi> &x)
+{
+    using V = Vector<double, Abi>;
+    constexpr double sqrt1_2 = 0.7071067811865476;
+    const V u = x * -sqrt1_2;
+    const V au = abs(u);
+    const auto small = au < 0.5;
+    V r = 0.5 - 0.5 * erf_small(u);
+    if (!all_of(small)) {
+        const V h = round_to_2pow21(au);
+        const V l = ((abs(x) - h * 1.4142135679721832) + h * 5.599088178737374e-09) * sqrt1_2;
+        V t = 0.5 * erfc_tail(au, h, l);
+        t(x > 0.) = 1. - t;
+        r(!small) = t;
+    }
+    return r;
+}
+
+// normcdfinv {{{
+// An initial approximation with a relative error below 2·10⁻⁶ is refined with one step of
+// Halley's method, which for Φ reads x ← x - w / (1 + ½xw) with w = (Φ(x) - p) / φ(x).
+// Central region |p - ½| ≤ 0.425: x = q * A(q²) with q = p - ½ (exact), and
+//     w = (½erf(x / √2) - q) * √(2π) * e^(x²/2).
+// Tails: x = ∓y with y = r * B(1/r - s₀), r = √(-2 ln p'), and p' = min(p, 1 - p) (exact);
+// with Φ(-y) / φ(y) = √(π/2) * erfcx(y / √2) the step for y avoids under- and overflow:
+//     w = √(π/2) * erfcx(y / √2) - √(2π) * e^(y²/2 + ln p').
+// In the tails the error of the initial approximation is below 8·10⁻⁹, which Halley's
+// method reduces below 2⁻⁶⁰ up to p' = 2⁻¹⁰⁷⁴.
+template <typename Abi> Vector<double, Abi> normcdfinv_kernel(const Vector<double, Abi> &p)
+{
+    using V = Vector<double, Abi>;
+    constexpr double sqrt1_2 = 0.7071067811865476;
+    constexpr double sqrt2pi = 2.5066282746310007;
+    constexpr double sqrtpi_2 = 1.2533141373155003;
+    const V q = p - 0.5;
+    const auto central = abs(q) <= 0.425;
+    V x = V::Zero();
+    if (any_of(central)) {
+        const V r = q * q;
+        V a = 440759.82959615276;
+        a = a * r - 246998.23173395346;
+        a = a * r + 60558.827547646208;
+        a = a * r - 7542.9481952545275;
+        a = a * r + 598.44570507149206;
+        a = a * r - 5.9135628971475738;
+        a = a * r + 6.1881994395728839;
+        a = a * r + 2.6218873165045995;
+        a = a * r + 2.5066319276947615;
+        const V x0 = q * a;
+        const V w = (0.5 * erf_kernel(x0 * sqrt1_2) - q) * sqrt2pi * exp(0.5 * x0 * x0);
+        x(central) = x0 - w / (1. + 0.5 * x0 * w);
+    }
+    if (!all_of(central)) {
+        const V lp = log(iif(q < 0., p, 1. - p));
+        const V r = sqrt(-2. * lp);
+        const V s = 1. / r;
+        V b0 = -9.9979242280920779;
+        V b1 = 143706.27620675077;
+        const V s0 = s - 0.30303629492925566;
+        const V s1 = s - 0.096286701208981;
+        b0 = b0 * s0 + 4.5472379409042425;
+        b1 = b1 * s1 - 16280.175860074267;
+        b0 = b0 * s0 - 1.8905057168863282;
+        b1 = b1 * s1 + 549.13363634715324;
+        b0 = b0 * s0 + 1.1500216586583218;
+        b1 = b1 * s1 - 151.57476321007249;
+        b0 = b0 * s0 - 0.84036737856546606;
+        b1 = b1 * s1 + 39.473602671909454;
+        b0 = b0 * s0 + 0.75512186487441824;
+        b1 = b1 * s1 - 9.0188999221768658;
+        b0 = b0 * s0 - 0.9535406763708002;
+        b1 = b1 * s1 + 3.0432906421863928;
+        b0 = b0 * s0 - 1.0804612428444851;
+        b1 = b1 * s1 - 1.8648248027651522;
+        b0 = b0 * s0 + 0.79579649911087758;
+        b1 = b1 * s1 - 0.54048982769857101;
+        b1 = b1 * s1 + 0.96951508438135325;
+        const V y0 = r * iif(r < 6., b0, b1);
+        const V w = sqrtpi_2 * erfcx_kernel(y0 * sqrt1_2) - sqrt2pi * exp(0.5 * y0 * y0 + lp);
+        const V y = y0 + w / (1. - 0.5 * y0 * w);
+        x(!central) = iif(q < 0., -y, y);
+    }
+    x(p == 0.) = -std::numeric_limits<double>::infinity();
+    x(p == 1.) = std::numeric_limits<double>::infinity();
+    x(!(p >= 0. && p <= 1.)) = std::numeric_limits<double>::quiet_NaN();
+    return x;
+}
+
+// lgamma {{{
+// lgamma(x) for x > 0:
+// - x ≥ 8: Stirling's series (x - ½)(ln x - 1) + ½ln(2π) - ½ + Σₖ B₂ₖ / (2k(2k - 1)x²ᵏ⁻¹),
+//   k = 1..9, with a truncation error below 2⁻⁶⁰ relative to the result.
+// - [1, 2[: lgamma(x) = (x - 1)(x - 2) * R(x - 1.5), minimax fit with a relative error below
+//   6·10⁻¹⁷. The zeros at 1 and 2 are thus exact.
+// - [2, 8[: lgamma(x) = lgamma(z) + ln((x - 1) * ... * z) with z = x - k ∈ [1, 2[ (exact).
+// - ]0, 1[: lgamma(x) = lgamma(x + 1) - ln(x) with lgamma(x + 1) = x(x - 1) * R(x - ½).
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<double, Abi> lgamma_positive(const Vector<double, Abi> &x)
+{
+    using V = Vector<double, Abi>;
+    const auto large = x >= 8.;
+    V r = V::Zero();
+    if (!all_of(large)) {
+        const auto tiny = x < 1.;
+        V z = x;
+        V prod = V::One();
+        for (int i = 0; i < 6; ++i) {
+            const auto m = z >= 2.;
+            z(m) -= 1.;
+            prod(m) *= z;
+        }
+        const V a = iif(tiny, x, z - 1.);
+        V p = 1.2169636267574609e-05;
+        const V c = a - 0.5;
+        p = p * c - 1.8542525466876245e-05;
+        p = p * c + 1.3149036892388965e-05;
+        p = p * c - 2.1470244596071891e-05;
+        p = p * c + 4.3047296822686076e-05;
+        p = p * c - 6.7946045857431665e-05;
+        p = p * c + 1.0534936601837145e-04;
+        p = p * c - 1.6856941547391049e-04;
+        p = p * c + 2.7131476006480860e-04;
+        p = p * c - 4.3803554715165697e-04;
+        p = p * c + 7.1151895541789840e-04;
+        p = p * c - 1.1644113394125681e-03;
+        p = p * c + 1.9229163202768389e-03;
+        p = p * c - 3.2120742227826631e-03;
+        p = p * c + 5.4464578388390321e-03;
+        p = p * c - 9.4256224447618817e-03;
+        p = p * c + 1.6797098631279747e-02;
+        p = p * c - 3.1308487501054229e-02;
+        p = p * c + 6.2911401074564346e-02;
+        p = p * c - 1.4595989591430594e-01;
+        p = p * c + 4.8312895054098087e-01;
+        const V l = log(iif(tiny, x, prod));
+        r(!large) = a * (a - 1.) * p + iif(tiny, -l, l);
+    }
+    if (any_of(large)) {
+        const V w = 1. / x;
+        const V w2 = w * w;
+        V s = 43867. / 244188.;
+        s = s * w2 - 3617. / 122400.;
+        s = s * w2 + 1. / 156.;
+        s = s * w2 - 691. / 360360.;
+        s = s * w2 + 1. / 1188.;
+        s = s * w2 - 1. / 1680.;
+        s = s * w2 + 1. / 1260.;
+        s = s * w2 - 1. / 360.;
+        s = s * w2 + 1. / 12.;
+        r(large) = (x - 0.5) * (log(x) - 1.) + (0.4189385332046727 + s * w);
+    }
+    return r;
+}
+
+// For x < 0 the reflection formula Γ(x) Γ(-x) = -π / (x sin(πx)) gives
+//     lgamma(x) = ln(π) - ln|x sin(πx)| - lgamma(-x),
+// with sin(πx) = ±sin(π(x - round(x))). For -2⁻⁵² < x < 0, lgamma(x) = lgamma(-x) to
+// within the precision of the result.
+template <typename Abi> Vector<double, Abi> lgamma_kernel(const Vector<double, Abi> &x)
+{
+    using V = Vector<double, Abi>;
+    const V ax = abs(x);
+    V r = lgamma_positive(ax);
+    const auto reflect = x < -2.2204460492503131e-16;
+    if (any_of(reflect)) {
+        const V s = abs(sin(3.141592653589793 * (x - round(x))));
+        V t = 1.1447298858494002 - log(ax * s) - r;
+        t(isinf(x)) = std::numeric_limits<double>::infinity();
+        r(reflect) = t;
+    }
+    return r;
+}
+}  // namespace Detail
+
+// erf, erfc, lgamma, normcdf, normcdfinv {{{
+// All ABIs, including Scalar, use the kernels above, so that the documented error bounds
+// do not depend on the C library.
+#define Vc_SPECIAL_FUNCTION_(name_)                                                      \
+    template <typename Abi>                                                              \
+    inline Vector<double, detail::not_fixed_size_abi<Abi>> name_(                        \
+        const Vector<double, Abi> &x)                                                    \
+    {                                                                                    \
+        return Detail::name_##_kernel(x);                                                \
+    }                                                                                    \
+    template <typename Abi>                                                              \
+    inline Vector<float, detail::not_fixed_size_abi<Abi>> name_(                         \
+        const Vector<float, Abi> &x)                                                     \
+    {                                                                                    \
+        return simd_cast<Vector<float, Abi>>(                                            \
+            name_(simd_cast<SimdArray<double, Vector<float, Abi>::Size>>(x)));           \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+Vc_SPECIAL_FUNCTION_(erf);
+Vc_SPECIAL_FUNCTION_(erfc);
+Vc_SPECIAL_FUNCTION_(lgamma);
+Vc_SPECIAL_FUNCTION_(normcdf);
+Vc_SPECIAL_FUNCTION_(normcdfinv);
+#undef Vc_SPECIAL_FUNCTION_
+// }}}
+
+#endif // Vc_COMMON_MATH_H_INTERNAL
+
+// vim: foldmethod=marker
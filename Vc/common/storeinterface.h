@@ -89,4 +89,17 @@ Vc_INTRINSIC void Vc_VDECL store(EntryType *mem, MaskType mask, Flags flags) con
 }
 //@}
 
+/**
+ * Store the entries where \p mask is set contiguously to \p mem.
+ *
+ * In contrast to the masked store above, the selected values are packed: the first
+ * selected entry is stored to `mem[0]`, the second to `mem[1]`, and so on.
+ *
+ * \param mem A pointer to memory with room for at least `mask.count()` values. No memory
+ *            after them is written.
+ * \param mask Determines the entries that are stored.
+ * \return The number of values written to \p mem, i.e. `mask.count()`.
+ */
+Vc_INTRINSIC_L int Vc_VDECL compress_store(EntryType *mem, MaskType mask) const Vc_INTRINSIC_R;
+
 // vim: foldmethod=marker
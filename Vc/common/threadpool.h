@@ -0,0 +1,73 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_THREADPOOL_H_
+#define VC_COMMON_THREADPOOL_H_
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+/**\internal
+ * Returns the number of threads (including the calling thread) that parallel_for
+ * distributes work to.
+ */
+std::size_t parallel_concurrency();
+
+/**\internal
+ * Calls \p fn(\p ctx, i) for every i in [0, \p n) on the worker threads of the library's
+ * thread pool. The calling thread participates and the function returns after all calls
+ * have completed. Indexes are handed out dynamically, so idle threads pick up the
+ * remaining work of slow ones.
+ *
+ * Nested calls and calls issued while another thread uses the pool execute serially on
+ * the calling thread. The first exception thrown by \p fn is rethrown to the caller.
+ */
+void parallel_for_impl(std::size_t n, void (*fn)(void *, std::size_t), void *ctx);
+
+/**\internal
+ * Convenience wrapper for parallel_for_impl that accepts any callable taking a
+ * std::size_t.
+ */
+template <class F> inline void parallel_for(std::size_t n, F &&f)
+{
+    using Fun = typename std::remove_reference<F>::type;
+    parallel_for_impl(n,
+                      [](void *ctx, std::size_t i) { (*static_cast<Fun *>(ctx))(i); },
+                      const_cast<void *>(static_cast<const void *>(std::addressof(f))));
+}
+}  // namespace Detail
+}  // namespace Vc
+
+#endif  // VC_COMMON_THREADPOOL_H_
+
+// vim: foldmethod=marker
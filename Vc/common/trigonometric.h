@@ -69,6 +69,13 @@ template<typename Impl> struct Trigonometric
     template<typename T> static T asin (const T &_x);
     template<typename T> static T atan (const T &_x);
     template<typename T> static T atan2(const T &y, const T &x);
+    template<typename T> static T tan  (const T &_x);
+    template<typename T> static T acos (const T &_x);
+    template<typename T> static T sinh (const T &_x);
+    template<typename T> static T cosh (const T &_x);
+    template<typename T> static T tanh (const T &_x);
+    template<typename T> static T asinh(const T &_x);
+    template<typename T> static T atanh(const T &_x);
 };
 }  // namespace Common
 
@@ -202,6 +209,118 @@ Vc_INTRINSIC Vector<T, detail::not_fixed_size_abi<Abi>> atan2(const Vector<T, Ab
     return Detail::Trig<T, Abi>::atan2(y, x);
 }
 
+/**
+ * \ingroup Math
+ * Returns the tangent of all input values in \p x.
+ *
+ * \param x The values to apply the tangent function on.
+ * \returns the tangent of \p x.
+ *
+ * \note The single-precision implementation has an error of max. 1 ulp (mean 0.001 ulp) in the range [-8192, 8192]; it is evaluated in double precision.
+ * \note The double-precision implementation has an error of max. 3.2 ulp (mean 0.36 ulp) in the range [-8192, 8192].
+ */
+template <typename T, typename Abi>
+Vc_INTRINSIC Vector<T, detail::not_fixed_size_abi<Abi>> tan(const Vector<T, Abi> &x)
+{
+    return Detail::Trig<T, Abi>::tan(x);
+}
+
+/**
+ * \ingroup Math
+ * Returns the arccosine of all input values in \p x.
+ *
+ * \param x The values to apply the arccosine function on.
+ * \returns the arccosine of \p x.
+ *
+ * \note The single-precision implementation has an error of max. 1.3 ulp (mean 0.23 ulp).
+ * \note The double-precision implementation has an error of max. 1.2 ulp (mean 0.18 ulp).
+ */
+template <typename T, typename Abi>
+Vc_INTRINSIC Vector<T, detail::not_fixed_size_abi<Abi>> acos(const Vector<T, Abi> &x)
+{
+    return Detail::Trig<T, Abi>::acos(x);
+}
+
+/**
+ * \ingroup Math
+ * Returns the hyperbolic sine of all input values in \p x.
+ *
+ * \param x The values to apply the hyperbolic sine function on.
+ * \returns the hyperbolic sine of \p x.
+ *
+ * \note The single-precision implementation has an error of max. 2.4 ulp (mean 0.08 ulp) in the range [-88, 88].
+ * \note The double-precision implementation has an error of max. 4 ulp (mean 0.07 ulp) in the range [-709, 709].
+ */
+template <typename T, typename Abi>
+Vc_INTRINSIC Vector<T, detail::not_fixed_size_abi<Abi>> sinh(const Vector<T, Abi> &x)
+{
+    return Detail::Trig<T, Abi>::sinh(x);
+}
+
+/**
+ * \ingroup Math
+ * Returns the hyperbolic cosine of all input values in \p x.
+ *
+ * \param x The values to apply the hyperbolic cosine function on.
+ * \returns the hyperbolic cosine of \p x.
+ *
+ * \note The single-precision implementation has an error of max. 2.4 ulp (mean 0.08 ulp) in the range [-88, 88].
+ * \note The double-precision implementation has an error of max. 4 ulp (mean 0.10 ulp) in the range [-709, 709].
+ */
+template <typename T, typename Abi>
+Vc_INTRINSIC Vector<T, detail::not_fixed_size_abi<Abi>> cosh(const Vector<T, Abi> &x)
+{
+    return Detail::Trig<T, Abi>::cosh(x);
+}
+
+/**
+ * \ingroup Math
+ * Returns the hyperbolic tangent of all input values in \p x.
+ *
+ * \param x The values to apply the hyperbolic tangent function on.
+ * \returns the hyperbolic tangent of \p x.
+ *
+ * \note The single-precision implementation has an error of max. 2.3 ulp (mean 0.21 ulp) in the range [-1, 1].
+ * \note The double-precision implementation has an error of max. 2.5 ulp (mean 0.22 ulp) in the range [-1, 1].
+ */
+template <typename T, typename Abi>
+Vc_INTRINSIC Vector<T, detail::not_fixed_size_abi<Abi>> tanh(const Vector<T, Abi> &x)
+{
+    return Detail::Trig<T, Abi>::tanh(x);
+}
+
+/**
+ * \ingroup Math
+ * Returns the inverse hyperbolic sine of all input values in \p x.
+ *
+ * \param x The values to apply the inverse hyperbolic sine function on.
+ * \returns the inverse hyperbolic sine of \p x.
+ *
+ * \note The single-precision implementation has an error of max. 1.8 ulp (mean 0.17 ulp) in the range [-3, 3].
+ * \note The double-precision implementation has an error of max. 2 ulp (mean 0.17 ulp) in the range [-3, 3].
+ */
+template <typename T, typename Abi>
+Vc_INTRINSIC Vector<T, detail::not_fixed_size_abi<Abi>> asinh(const Vector<T, Abi> &x)
+{
+    return Detail::Trig<T, Abi>::asinh(x);
+}
+
+/**
+ * \ingroup Math
+ * Returns the inverse hyperbolic tangent of all input values in \p x.
+ *
+ * \param x The values to apply the inverse hyperbolic tangent function on.
+ * \returns the inverse hyperbolic tangent of \p x.
+ *
+ * \note The single-precision implementation has an error of max. 1.9 ulp (mean 0.17 ulp).
+ * \note The double-precision implementation has an error of max. 1.9 ulp (mean 0.16 ulp).
+ */
+template <typename T, typename Abi>
+Vc_INTRINSIC Vector<T, detail::not_fixed_size_abi<Abi>> atanh(const Vector<T, Abi> &x)
+{
+    return Detail::Trig<T, Abi>::atanh(x);
+}
+
 /**
  * \ingroup Math
  *
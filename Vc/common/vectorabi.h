@@ -36,6 +36,12 @@ template <typename T>
 using Avx1Abi = typename std::conditional<std::is_integral<T>::value, VectorAbi::Sse,
                                           VectorAbi::Avx>::type;
 
+template <typename T>
+using Avx512Abi = typename std::conditional<
+    std::is_same<T, double>::value || std::is_same<T, float>::value ||
+        std::is_same<T, int>::value || std::is_same<T, unsigned int>::value,
+    VectorAbi::Avx512, VectorAbi::Avx>::type;
+
 template <typename T> struct DeduceCompatible {
 #ifdef __x86_64__
     using type = Sse;
@@ -52,8 +58,10 @@ struct DeduceBest {
             CurrentImplementation::is_between(SSE2Impl, SSE42Impl), Sse,
             typename std::conditional<
                 CurrentImplementation::is(AVXImpl), Avx1Abi<T>,
-                typename std::conditional<CurrentImplementation::is(AVX2Impl), Avx,
-                                          void>::type>::type>::type>::type;
+                typename std::conditional<
+                    CurrentImplementation::is(AVX2Impl), Avx,
+                    typename std::conditional<CurrentImplementation::is(AVX512Impl),
+                                              Avx512Abi<T>, void>::type>::type>::type>::type>::type;
 };
 template <typename T> using Best = typename DeduceBest<T>::type;
 }  // namespace VectorAbi
@@ -0,0 +1,163 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_DISPATCH_H_
+#define VC_DISPATCH_H_
+
+#include <atomic>
+#include <utility>
+#include "global.h"
+#include "support.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// DispatchTrampoline {{{
+template <class Dispatcher, class F> struct DispatchTrampoline;
+template <class Dispatcher, class R, class... Args>
+struct DispatchTrampoline<Dispatcher, R (*)(Args...)> {
+    static R call(Args... args)
+    {
+        return Dispatcher::resolve()(std::forward<Args>(args)...);
+    }
+};
+//}}}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile dispatch.h <Vc/dispatch.h>
+ *
+ * Selects the best compiled variant of a kernel at runtime.
+ *
+ * The kernel is a class template with one Vc::Implementation template parameter and a
+ * static member function \c call. Each variant is defined in a translation unit that
+ * is compiled with the corresponding \c Vc_IMPL (or \c -m) flags and specializes the
+ * kernel for \c Vc::CurrentImplementation::current():
+ *
+ * \code
+ * // saxpy.h
+ * template <Vc::Implementation> struct Saxpy {
+ *     static void call(float a, const float *x, float *y, std::size_t n);
+ * };
+ *
+ * // saxpy.cpp, compiled once with -msse2 and once with -mavx2 -mfma
+ * template <> void Saxpy<Vc::CurrentImplementation::current()>::call(
+ *     float a, const float *x, float *y, std::size_t n)
+ * {
+ *     // use Vc::float_v ...
+ * }
+ *
+ * // main.cpp
+ * using SaxpyDispatch = Vc::Dispatch<Saxpy, Vc::SSE2Impl, Vc::AVX2Impl>;
+ * SaxpyDispatch::call(2.f, x, y, n);
+ * \endcode
+ *
+ * The first call determines the variant with the highest Vc::Implementation that
+ * Vc::isImplementationSupported returns \c true for and stores its address in a
+ * function pointer. All subsequent calls are a plain indirect call through that
+ * pointer.
+ *
+ * \note Helper functions that are used by a kernel variant and are not inlined must
+ * have internal linkage (e.g. an unnamed namespace). Otherwise the linker may pick the
+ * copy compiled with the widest instruction set for all variants.
+ *
+ * \tparam Kernel The kernel class template.
+ * \tparam Impls The list of implementations the kernel was compiled for. The
+ *               variant for the first entry is the fallback if none of the listed
+ *               implementations is supported.
+ */
+template <template <Implementation> class Kernel, Implementation Impl0,
+          Implementation... Impls>
+class Dispatch
+{
+public:
+    /// The type of the function pointer that is called for every call().
+    using function_type = decltype(&Kernel<Impl0>::call);
+
+    /**
+     * Returns the Vc::Implementation of the variant that call() executes.
+     */
+    static Implementation selected()
+    {
+        const Implementation impls[] = {Impl0, Impls...};
+        Implementation best = Impl0;
+        for (Implementation impl : impls) {
+            if (impl > best && isImplementationSupported(impl)) {
+                best = impl;
+            }
+        }
+        return best;
+    }
+
+    /**
+     * Determines the best variant and stores it for subsequent calls to call().
+     *
+     * \return A pointer to the selected variant.
+     */
+    static function_type resolve()
+    {
+        const Implementation impls[] = {Impl0, Impls...};
+        const function_type functions[] = {&Kernel<Impl0>::call, &Kernel<Impls>::call...};
+        const Implementation best = selected();
+        function_type f = functions[0];
+        for (std::size_t i = 0; i < sizeof(impls) / sizeof(impls[0]); ++i) {
+            if (impls[i] == best) {
+                f = functions[i];
+            }
+        }
+        s_function.store(f, std::memory_order_relaxed);
+        return f;
+    }
+
+    /**
+     * Calls the best supported variant of the kernel with \p args.
+     */
+    template <class... Args>
+    static Vc_ALWAYS_INLINE auto call(Args &&... args)
+        -> decltype(std::declval<function_type>()(std::forward<Args>(args)...))
+    {
+        return s_function.load(std::memory_order_relaxed)(std::forward<Args>(args)...);
+    }
+
+private:
+    static std::atomic<function_type> s_function;
+};
+
+template <template <Implementation> class Kernel, Implementation Impl0,
+          Implementation... Impls>
+std::atomic<typename Dispatch<Kernel, Impl0, Impls...>::function_type>
+    Dispatch<Kernel, Impl0, Impls...>::s_function{
+        &Detail::DispatchTrampoline<Dispatch<Kernel, Impl0, Impls...>,
+                                    function_type>::call};
+
+}  // namespace Vc
+
+#endif  // VC_DISPATCH_H_
+
+// vim: foldmethod=marker
@@ -105,6 +105,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define Vc_RESET_DIAGNOSTICS _Pragma("GCC diagnostic pop")
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wignored-attributes"
+#if Vc_GCC >= 0xc0000 && Vc_GCC < 0xc0300
+// GCC 12.1 and 12.2 warn about the _mm*_undefined_* placeholders inside the AVX2 and
+// AVX-512 intrinsics headers whenever a gather or any unmasked AVX-512 intrinsic is
+// inlined (GCC PR 105593).
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
 #else
 #define Vc_RESET_DIAGNOSTICS
 #endif
@@ -173,6 +180,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define SSE4_2 0x00700000
 #define AVX    0x00800000
 #define AVX2   0x00900000
+#define AVX512 0x00A00000
 
 #define XOP    0x00000001
 #define FMA4   0x00000002
@@ -220,7 +228,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifndef Vc_IMPL
 
-#  if defined(__AVX2__)
+#  if defined(__AVX512F__) && defined(__AVX512VL__) && defined(__AVX512BW__) &&         \
+      defined(__AVX512DQ__)
+#    define Vc_IMPL_AVX512 1
+#    define Vc_IMPL_AVX2 1
+#    define Vc_IMPL_AVX 1
+#  elif defined(__AVX2__)
 #    define Vc_IMPL_AVX2 1
 #    define Vc_IMPL_AVX 1
 #  elif defined(__AVX__)
@@ -279,7 +292,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #else // Vc_IMPL
 
-#  if (Vc_IMPL & IMPL_MASK) == AVX2 // AVX2 supersedes SSE
+#  if (Vc_IMPL & IMPL_MASK) == AVX512 // AVX512 (F+VL+BW+DQ) supersedes AVX2
+#    define Vc_IMPL_AVX512 1
+#    define Vc_IMPL_AVX2 1
+#    define Vc_IMPL_AVX 1
+#  elif (Vc_IMPL & IMPL_MASK) == AVX2 // AVX2 supersedes SSE
 #    define Vc_IMPL_AVX2 1
 #    define Vc_IMPL_AVX 1
 #  elif (Vc_IMPL & IMPL_MASK) == AVX // AVX supersedes SSE
@@ -382,6 +399,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #        if defined(Vc_IMPL_AVX2)
 #            undef Vc_IMPL_AVX2
 #        endif
+#        if defined(Vc_IMPL_AVX512)
+#            undef Vc_IMPL_AVX512
+#        endif
 #    endif
 #endif
 
@@ -400,6 +420,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #undef SSE4_2
 #undef AVX
 #undef AVX2
+#undef AVX512
 
 #undef XOP
 #undef FMA4
@@ -412,7 +433,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #undef IMPL_MASK
 #undef EXT_MASK
 
-#if defined Vc_IMPL_AVX2
+#if defined Vc_IMPL_AVX512
+#define Vc_DEFAULT_IMPL_AVX512
+#elif defined Vc_IMPL_AVX2
 #define Vc_DEFAULT_IMPL_AVX2
 #elif defined Vc_IMPL_AVX
 #define Vc_DEFAULT_IMPL_AVX
@@ -460,9 +483,17 @@ enum MallocAlignment {
     /**
      * Align on boundary of page sizes (e.g. 4096 Bytes on x86) and pad to allow
      * full page access to the end. Thus the allocated memory contains a multiple of
-     * 4096 bytes.
+     * the page size of the system.
+     */
+    AlignOnPage,
+    /**
+     * Align on boundary of 2 MiB and pad to a multiple of 2 MiB, the size of huge pages
+     * on x86 and AArch64 (with 4 KiB base pages). On Linux the kernel is advised to back
+     * the memory with transparent huge pages (madvise(MADV_HUGEPAGE)). If the kernel
+     * does not support them, the memory is still allocated with the same alignment and
+     * padding, but is backed by base pages.
      */
-    AlignOnPage
+    AlignOnHugePage
 };
 
 /**
@@ -493,6 +524,8 @@ enum Implementation : std::uint_least32_t { // TODO: make enum class
     AVX2Impl,
     /// Intel Xeon Phi
     MICImpl,
+    /// x86 AVX + AVX2 + AVX512F + AVX512VL + AVX512BW + AVX512DQ
+    AVX512Impl,
     ImplementationMask = 0xfff
 };
 
@@ -501,7 +534,7 @@ enum Implementation : std::uint_least32_t { // TODO: make enum class
  *
  * The list of available instructions is not easily described by a linear list of instruction sets.
  * On x86 the following instruction sets always include their predecessors:
- * SSE2, SSE3, SSSE3, SSE4.1, SSE4.2, AVX, AVX2
+ * SSE2, SSE3, SSSE3, SSE4.1, SSE4.2, AVX, AVX2, AVX512
  *
  * But there are additional instructions that are not necessarily required by this list. These are
  * covered in this enum.
@@ -576,6 +609,8 @@ template <unsigned int Features> struct ImplementationT {
 using CurrentImplementation = ImplementationT<
 #ifdef Vc_IMPL_Scalar
     ScalarImpl
+#elif defined(Vc_IMPL_AVX512)
+    AVX512Impl
 #elif defined(Vc_IMPL_AVX2)
     AVX2Impl
 #elif defined(Vc_IMPL_AVX)
@@ -134,6 +134,41 @@ template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> cos  (const Scala
     return Scalar::Vector<T>(std::cos(x.data()));
 }
 
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> acos (const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::acos(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> tan  (const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::tan(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> sinh (const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::sinh(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> cosh (const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::cosh(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> tanh (const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::tanh(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> asinh(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::asinh(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> atanh(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::atanh(x.data()));
+}
+
 template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> log  (const Scalar::Vector<T> &x)
 {
     return Scalar::Vector<T>(std::log(x.data()));
@@ -154,6 +189,31 @@ template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> exp (const Scalar
     return Scalar::Vector<T>(std::exp(x.data()));
 }
 
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> exp2(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::exp2(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> expm1(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::expm1(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> log1p(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::log1p(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> cbrt(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::cbrt(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> pow(const Scalar::Vector<T> &x, const Scalar::Vector<T> &y)
+{
+    return Scalar::Vector<T>(std::pow(x.data(), y.data()));
+}
+
 template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> atan (const Scalar::Vector<T> &x)
 {
     return Scalar::Vector<T>(std::atan( x.data() ));
@@ -63,6 +63,16 @@ load_concept<U, Flags>::type Vector<T, VectorAbi::Scalar>::load(const U *mem, Fl
     m_data = mem[0];
 }
 
+template <typename T>
+Vc_INTRINSIC int Vector<T, VectorAbi::Scalar>::expand_load(const EntryType *mem, Mask mask)
+{
+    if (mask.data()) {
+        m_data = mem[0];
+        return 1;
+    }
+    return 0;
+}
+
 // store member functions{{{1
 template <typename T>
 template <typename U, typename Flags, typename>
@@ -78,6 +88,16 @@ Vc_INTRINSIC void Vector<T, VectorAbi::Scalar>::store(U *mem, Mask mask, Flags)
         mem[0] = m_data;
 }
 
+template <typename T>
+Vc_INTRINSIC int Vector<T, VectorAbi::Scalar>::compress_store(EntryType *mem, Mask mask) const
+{
+    if (mask.data()) {
+        mem[0] = m_data;
+        return 1;
+    }
+    return 0;
+}
+
 // gather {{{1
 template <typename T>
 template <class MT, class IT, int Scale>
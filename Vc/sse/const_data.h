@@ -84,6 +84,12 @@ template<> struct c_log<double>
     alignas(64) static const unsigned long long data[21 * Size];
 };
 
+struct c_compress
+{
+    alignas(64) static const unsigned long long compress[256];
+    alignas(64) static const unsigned long long expand[256];
+};
+
 }  // namespace SSE
 }  // namespace Vc
 
@@ -583,6 +583,32 @@ Vc_INTRINSIC __m128i mul(__m128i a, __m128i b,  uchar) {
 #endif
 }
 
+// mulhi{{{1
+// High half of the double-width product, i.e. (a * b) >> (8 * sizeof(T)).
+Vc_INTRINSIC __m128i mulhi(__m128i a, __m128i b,   uint) {
+    const __m128i ab02 = _mm_mul_epu32(a, b);  // [a0 * b0, a2 * b2]
+    const __m128i ab13 = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+#ifdef Vc_IMPL_SSE4_1
+    return _mm_blend_epi16(_mm_srli_epi64(ab02, 32), ab13, 0xcc);
+#else
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(ab02, 0xd), _mm_shuffle_epi32(ab13, 0xd));
+#endif
+}
+Vc_INTRINSIC __m128i mulhi(__m128i a, __m128i b,    int) {
+#ifdef Vc_IMPL_SSE4_1
+    const __m128i ab02 = _mm_mul_epi32(a, b);  // [a0 * b0, a2 * b2]
+    const __m128i ab13 = _mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_blend_epi16(_mm_srli_epi64(ab02, 32), ab13, 0xcc);
+#else
+    // signed high half = unsigned high half - (a < 0 ? b : 0) - (b < 0 ? a : 0)
+    const __m128i hi = mulhi(a, b, uint());
+    return _mm_sub_epi32(_mm_sub_epi32(hi, _mm_and_si128(_mm_srai_epi32(a, 31), b)),
+                         _mm_and_si128(_mm_srai_epi32(b, 31), a));
+#endif
+}
+Vc_INTRINSIC __m128i mulhi(__m128i a, __m128i b,  short) { return _mm_mulhi_epi16(a, b); }
+Vc_INTRINSIC __m128i mulhi(__m128i a, __m128i b, ushort) { return _mm_mulhi_epu16(a, b); }
+
 // div{{{1
 Vc_INTRINSIC __m128  div(__m128  a, __m128  b,  float) { return _mm_div_ps(a, b); }
 Vc_INTRINSIC __m128d div(__m128d a, __m128d b, double) { return _mm_div_pd(a, b); }
@@ -782,7 +808,9 @@ template <typename T> Vc_INTRINSIC Vc_CONST SSE::Vector<T> sorted(SSE::Vector<T>
                ? SSE2Impl
                : CurrentImplementation::is_between(SSE41Impl, SSE42Impl)
                      ? SSE41Impl
-                     : CurrentImplementation::current() > (x);
+                     : CurrentImplementation::is(AVX512Impl)
+                           ? AVX2Impl
+                           : CurrentImplementation::current() > (x);
 }
 
 // sanitize{{{1
@@ -817,6 +845,164 @@ static Vc_INTRINSIC Vc_CONST enable_if<(sizeof(V) == 16), V> rotated(V v, int am
     return sse_cast<V>(_mm_setzero_si128());
 }
 
+// compress/expand{{{1
+/**\internal
+ * Stores the low \p bytes bytes of \p v to \p mem and leaves the memory after it untouched.
+ * \p bytes must be an even number not larger than 16.
+ */
+Vc_INTRINSIC void partial_store16(void *mem, __m128i v, std::size_t bytes)
+{
+    char *p = static_cast<char *>(mem);
+    if (bytes == 16) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v);
+        return;
+    }
+    if (bytes & 8) {
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(p), v);
+        v = _mm_srli_si128(v, 8);
+        p += 8;
+    }
+    if (bytes & 4) {
+        *aliasing_cast<int>(p) = _mm_cvtsi128_si32(v);
+        v = _mm_srli_si128(v, 4);
+        p += 4;
+    }
+    if (bytes & 2) {
+        *aliasing_cast<short>(p) = static_cast<short>(_mm_cvtsi128_si32(v));
+    }
+}
+
+/**\internal
+ * Loads \p bytes bytes from \p mem into the low bytes of the returned register without
+ * reading past them. The remaining bytes are zero.
+ */
+Vc_INTRINSIC __m128i partial_load16(const void *mem, std::size_t bytes)
+{
+    const char *p = static_cast<const char *>(mem);
+    if (bytes == 16) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    }
+    __m128i r = _mm_setzero_si128();
+    if (bytes & 2) {
+        bytes -= 2;
+        r = _mm_cvtsi32_si128(*aliasing_cast<unsigned short>(p + bytes));
+    }
+    if (bytes & 4) {
+        bytes -= 4;
+        r = _mm_or_si128(_mm_slli_si128(r, 4), _mm_cvtsi32_si128(*aliasing_cast<int>(p + bytes)));
+    }
+    if (bytes & 8) {
+        r = _mm_or_si128(_mm_slli_si128(r, 8),
+                         _mm_loadl_epi64(reinterpret_cast<const __m128i *>(p)));
+    }
+    return r;
+}
+
+#ifdef Vc_IMPL_SSSE3
+/**\internal
+ * Turns the lane indexes of a SSE::c_compress entry (one byte per lane) into the pshufb
+ * control that moves lanes of \p B bytes accordingly.
+ */
+template <std::size_t B>
+Vc_INTRINSIC __m128i lane_shuffle_control(const unsigned long long *lanes)
+{
+    const __m128i idx = _mm_shuffle_epi8(
+        _mm_loadl_epi64(reinterpret_cast<const __m128i *>(lanes)),
+        _mm_setr_epi8(0 / B, 1 / B, 2 / B, 3 / B, 4 / B, 5 / B, 6 / B, 7 / B, 8 / B, 9 / B,
+                      10 / B, 11 / B, 12 / B, 13 / B, 14 / B, 15 / B));
+    return _mm_add_epi8(_mm_slli_epi16(idx, B == 2 ? 1 : B == 4 ? 2 : 3),
+                        _mm_setr_epi8(0 % B, 1 % B, 2 % B, 3 % B, 4 % B, 5 % B, 6 % B,
+                                      7 % B, 8 % B, 9 % B, 10 % B, 11 % B, 12 % B,
+                                      13 % B, 14 % B, 15 % B));
+}
+#endif
+
+/**\internal
+ * Stores the lanes of \p v selected by \p bits (one bit per lane) contiguously to \p mem
+ * and returns their number.
+ */
+template <typename T> Vc_INTRINSIC int compress_store16(T *mem, __m128i v, int bits)
+{
+#ifdef Vc_IMPL_SSSE3
+    const int n = popcnt8(bits);
+    partial_store16(mem,
+                    _mm_shuffle_epi8(v, lane_shuffle_control<sizeof(T)>(
+                                            &SSE::c_compress::compress[bits])),
+                    n * sizeof(T));
+    return n;
+#else
+    alignas(16) T tmp[16 / sizeof(T)];
+    _mm_store_si128(reinterpret_cast<__m128i *>(tmp), v);
+    int n = 0;
+    for (std::size_t i = 0; i < 16 / sizeof(T); ++i) {
+        if (bits & (1 << i)) {
+            mem[n++] = tmp[i];
+        }
+    }
+    return n;
+#endif
+}
+
+/**\internal
+ * Loads one element from \p mem for every bit set in \p bits and returns them in the
+ * lanes of those bits. The other lanes of the result are unspecified.
+ */
+template <typename T> Vc_INTRINSIC __m128i expand_load16(const T *mem, int bits)
+{
+#ifdef Vc_IMPL_SSSE3
+    return _mm_shuffle_epi8(
+        partial_load16(mem, popcnt8(bits) * sizeof(T)),
+        lane_shuffle_control<sizeof(T)>(&SSE::c_compress::expand[bits]));
+#else
+    alignas(16) T tmp[16 / sizeof(T)] = {};
+    for (std::size_t i = 0; i < 16 / sizeof(T); ++i) {
+        if (bits & (1 << i)) {
+            tmp[i] = *mem++;
+        }
+    }
+    return _mm_load_si128(reinterpret_cast<const __m128i *>(tmp));
+#endif
+}
+
+#ifdef Vc_IMPL_AVX512
+Vc_INTRINSIC int compress_store16(float *mem, __m128i v, int bits)
+{
+    _mm_mask_compressstoreu_ps(mem, __mmask8(bits), _mm_castsi128_ps(v));
+    return popcnt4(bits);
+}
+Vc_INTRINSIC int compress_store16(double *mem, __m128i v, int bits)
+{
+    _mm_mask_compressstoreu_pd(mem, __mmask8(bits), _mm_castsi128_pd(v));
+    return popcnt4(bits);
+}
+Vc_INTRINSIC int compress_store16(int *mem, __m128i v, int bits)
+{
+    _mm_mask_compressstoreu_epi32(mem, __mmask8(bits), v);
+    return popcnt4(bits);
+}
+Vc_INTRINSIC int compress_store16(uint *mem, __m128i v, int bits)
+{
+    _mm_mask_compressstoreu_epi32(mem, __mmask8(bits), v);
+    return popcnt4(bits);
+}
+Vc_INTRINSIC __m128i expand_load16(const float *mem, int bits)
+{
+    return _mm_castps_si128(_mm_maskz_expandloadu_ps(__mmask8(bits), mem));
+}
+Vc_INTRINSIC __m128i expand_load16(const double *mem, int bits)
+{
+    return _mm_castpd_si128(_mm_maskz_expandloadu_pd(__mmask8(bits), mem));
+}
+Vc_INTRINSIC __m128i expand_load16(const int *mem, int bits)
+{
+    return _mm_maskz_expandloadu_epi32(__mmask8(bits), mem);
+}
+Vc_INTRINSIC __m128i expand_load16(const uint *mem, int bits)
+{
+    return _mm_maskz_expandloadu_epi32(__mmask8(bits), mem);
+}
+#endif  // Vc_IMPL_AVX512
+
 //InterleaveImpl{{{1
 template<typename V, size_t Size, size_t VSize> struct InterleaveImpl;
 template<typename V> struct InterleaveImpl<V, 8, 16> {
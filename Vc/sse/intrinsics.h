@@ -624,7 +624,9 @@ template <int Scale> __m128 gather(const float *addr, __m128i idx)
 }
 template <int Scale> __m128d gather(const double *addr, __m128i idx)
 {
-    return _mm_i32gather_pd(addr, idx, Scale);
+    // see the AVX2 overload: avoid the undefined source register of the unmasked intrinsic
+    return _mm_mask_i32gather_pd(_mm_setzero_pd(), addr, idx,
+                                 _mm_castsi128_pd(_mm_set1_epi64x(-1)), Scale);
 }
 template <int Scale> __m128i gather(const int *addr, __m128i idx)
 {
@@ -271,6 +271,22 @@ Vc_INTRINSIC void Vector<T, VectorAbi::Sse>::store(U *mem, Mask mask, Flags flag
     HV::template store<Flags>(mem, data(), mask.data());
 }
 
+template <typename T>
+Vc_INTRINSIC int Vector<T, VectorAbi::Sse>::compress_store(EntryType *mem, Mask mask) const
+{
+    return Detail::compress_store16(mem, SSE::sse_cast<__m128i>(data()), mask.toInt());
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+// expand_load {{{1
+template <typename T>
+Vc_INTRINSIC int Vector<T, VectorAbi::Sse>::expand_load(const EntryType *mem, Mask mask)
+{
+    const int bits = mask.toInt();
+    assign(SSE::sse_cast<VectorType>(Detail::expand_load16(mem, bits)), mask);
+    return Detail::popcnt8(bits);
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////
 // operator- {{{1
 template<typename T> Vc_ALWAYS_INLINE Vc_PURE Vector<T, VectorAbi::Sse> Vector<T, VectorAbi::Sse>::operator-() const
@@ -362,6 +378,8 @@ inline void Vector<T, VectorAbi::Sse>::gatherImplementation(
                                             Common::GatherScatterImplementation::BitScanLoop
 #elif defined Vc_USE_POPCNT_BSF_GATHERS
               Common::GatherScatterImplementation::PopcntSwitch
+#elif defined Vc_USE_ADAPTIVE_GATHERS
+              Common::GatherScatterImplementation::Adaptive
 #else
               Common::GatherScatterImplementation::SimpleLoop
 #endif
@@ -389,6 +407,8 @@ inline void Vector<T, VectorAbi::Sse>::scatterImplementation(MT *mem, IT &&index
                                             Common::GatherScatterImplementation::BitScanLoop
 #elif defined Vc_USE_POPCNT_BSF_GATHERS
               Common::GatherScatterImplementation::PopcntSwitch
+#elif defined Vc_USE_ADAPTIVE_GATHERS
+              Common::GatherScatterImplementation::Adaptive
 #else
               Common::GatherScatterImplementation::SimpleLoop
 #endif
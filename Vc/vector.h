@@ -37,6 +37,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifdef Vc_IMPL_AVX
 # include "avx/vector.h"
 #endif
+#ifdef Vc_IMPL_AVX512
+# include "avx512/vector.h"
+#endif
 
 namespace Vc_VERSIONED_NAMESPACE
 {
@@ -230,6 +233,11 @@ constexpr std::size_t MemoryAlignment = alignof(MemoryAlignedBase);
 # include "avx/math.h"
 # include "avx/simd_cast_caller.tcc"
 #endif
+#if defined(Vc_IMPL_AVX512)
+# include "avx512/helperimpl.h"
+# include "avx512/math.h"
+# include "avx512/simd_cast_caller.tcc"
+#endif
 
 #include "common/math.h"
 
@@ -243,6 +251,7 @@ constexpr std::size_t MemoryAlignment = alignof(MemoryAlignedBase);
 #include "common/vectortuple.h"
 #include "common/where.h"
 #include "common/iif.h"
+#include "common/divider.h"
 
 #ifndef Vc_NO_STD_FUNCTIONS
 namespace std
@@ -251,23 +260,38 @@ namespace std
   using Vc::max;
 
   using Vc::abs;
+  using Vc::acos;
   using Vc::asin;
+  using Vc::asinh;
   using Vc::atan;
   using Vc::atan2;
+  using Vc::atanh;
+  using Vc::cbrt;
   using Vc::ceil;
   using Vc::cos;
+  using Vc::cosh;
+  using Vc::erf;
+  using Vc::erfc;
   using Vc::exp;
+  using Vc::exp2;
+  using Vc::expm1;
   using Vc::fma;
   using Vc::trunc;
   using Vc::floor;
   using Vc::frexp;
   using Vc::ldexp;
+  using Vc::lgamma;
   using Vc::log;
   using Vc::log10;
+  using Vc::log1p;
   using Vc::log2;
+  using Vc::pow;
   using Vc::round;
   using Vc::sin;
+  using Vc::sinh;
   using Vc::sqrt;
+  using Vc::tan;
+  using Vc::tanh;
 
   using Vc::isfinite;
   using Vc::isnan;
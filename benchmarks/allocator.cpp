@@ -0,0 +1,78 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+
+using namespace Vc;
+using Benchmark::fakeRead;
+
+// Number of temporaries per event.
+constexpr std::size_t N = 1000;
+
+/* An "event" allocates N short-lived float arrays of varying size, writes one vector to
+ * each, and frees them. The arena variant releases them with a single reset.
+ */
+void benchmarkTemporaries(Benchmark::Runner &runner)
+{
+    const auto sizes = Benchmark::randomValues<std::size_t>(N, 1, 256);
+    const float_v one = 1.f;
+    runner.throughput("temporaries/Memory/malloc", N, [&] {
+        for (std::size_t n : sizes) {
+            Memory<float_v> m(n);
+            m.vector(0) = one;
+            fakeRead(m[0]);
+        }
+    });
+    runner.throughput("temporaries/Memory/thread_arena", N, [&] {
+        for (std::size_t n : sizes) {
+            Memory<float_v> m(n, thread_arena());
+            m.vector(0) = one;
+            fakeRead(m[0]);
+        }
+        thread_arena().reset();
+    });
+    runner.throughput("temporaries/std::vector/Allocator", N, [&] {
+        for (std::size_t n : sizes) {
+            std::vector<float, Allocator<float>> v(n);
+            fakeRead(v[0]);
+        }
+    });
+    runner.throughput("temporaries/std::vector/ArenaAllocator", N, [&] {
+        for (std::size_t n : sizes) {
+            std::vector<float, ArenaAllocator<float>> v(n);
+            fakeRead(v[0]);
+        }
+        thread_arena().reset();
+    });
+}
+
+int main(int argc, char **argv)
+{
+    Benchmark::Runner runner(argc, argv);
+    benchmarkTemporaries(runner);
+    return runner.finish();
+}
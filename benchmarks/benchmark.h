@@ -0,0 +1,289 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+#ifndef VC_BENCHMARKS_BENCHMARK_H_
+#define VC_BENCHMARKS_BENCHMARK_H_
+
+#include <Vc/Vc>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/**
+ * A minimal benchmark harness. Every benchmark is a callable that processes a fixed
+ * number of items per call. The harness calls it often enough to fill the requested
+ * measurement time, keeps the fastest of several repetitions, and prints all results as
+ * one JSON document:
+ *
+ * \code
+ * { "implementation": "AVX2", "vc_version": "1.4.1-dev", "compiler": "...",
+ *   "float_v_size": 8, "results": [
+ *   { "name": "load/float_v/aligned", "kind": "throughput", "items": 2048,
+ *     "calls": 4096, "ns_per_item": 0.061, "cycles_per_item": 0.18 }, ... ] }
+ * \endcode
+ *
+ * Throughput benchmarks process independent data, latency benchmarks feed the result of
+ * every operation into the next one.
+ *
+ * Command line: `--out <file>` writes the JSON to a file instead of stdout, `--filter
+ * <substring>` runs only the matching benchmarks, `--min-time <ms>` sets the time per
+ * repetition (default 10).
+ */
+namespace Benchmark
+{
+// keep the compiler from optimizing away the computation of x {{{1
+template <class T> Vc_ALWAYS_INLINE void fakeRead(const T &x)
+{
+#ifdef _MSC_VER
+    _ReadWriteBarrier();
+    *static_cast<const volatile char *>(static_cast<const void *>(&x));
+#else
+    asm volatile("" ::"m"(x));
+#endif
+}
+// make the compiler forget what it knows about the value of x
+template <class T> Vc_ALWAYS_INLINE void fakeModify(T &x)
+{
+#ifdef _MSC_VER
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : "+m"(x));
+#endif
+}
+
+// cycle counter {{{1
+inline unsigned long long cycles()
+{
+#if defined _MSC_VER && (defined _M_IX86 || defined _M_X64)
+    return __rdtsc();
+#elif defined __x86_64__ || defined __i386__
+    unsigned int lo, hi;
+    asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+    return (static_cast<unsigned long long>(hi) << 32) | lo;
+#else
+    return 0;
+#endif
+}
+
+// names {{{1
+inline const char *implementationName()
+{
+    switch (Vc::CurrentImplementation::current()) {
+    case Vc::ScalarImpl: return "Scalar";
+    case Vc::SSE2Impl: return "SSE2";
+    case Vc::SSE3Impl: return "SSE3";
+    case Vc::SSSE3Impl: return "SSSE3";
+    case Vc::SSE41Impl: return "SSE4_1";
+    case Vc::SSE42Impl: return "SSE4_2";
+    case Vc::AVXImpl: return "AVX";
+    case Vc::AVX2Impl: return "AVX2";
+    case Vc::AVX512Impl: return "AVX512";
+    default: return "unknown";
+    }
+}
+
+template <class T> struct TypeName;
+#define Vc_BENCHMARK_TYPE_NAME(T_, name_)                                                \
+    template <> struct TypeName<T_> {                                                    \
+        static const char *get() { return name_; }                                       \
+    }
+Vc_BENCHMARK_TYPE_NAME(float, "float");
+Vc_BENCHMARK_TYPE_NAME(double, "double");
+Vc_BENCHMARK_TYPE_NAME(int, "int");
+Vc_BENCHMARK_TYPE_NAME(unsigned int, "uint");
+Vc_BENCHMARK_TYPE_NAME(short, "short");
+Vc_BENCHMARK_TYPE_NAME(unsigned short, "ushort");
+#undef Vc_BENCHMARK_TYPE_NAME
+
+/// "float_v", "SimdArray<float,19>", ...
+template <class V> std::string vectorName()
+{
+    using T = typename V::value_type;
+    if (std::is_same<V, Vc::Vector<T>>::value) {
+        return std::string(TypeName<T>::get()) + "_v";
+    }
+    return "SimdArray<" + std::string(TypeName<T>::get()) + "," +
+           std::to_string(V::size()) + ">";
+}
+
+// random input {{{1
+template <class T> std::vector<T> randomValues(std::size_t n, double lo, double hi)
+{
+    std::mt19937 engine(n);
+    std::uniform_real_distribution<double> dist(lo, hi);
+    std::vector<T> r(n);
+    for (auto &x : r) {
+        x = static_cast<T>(dist(engine));
+    }
+    return r;
+}
+
+// Runner {{{1
+class Runner
+{
+public:
+    Runner(int argc, char **argv)
+    {
+        for (int i = 1; i + 1 < argc; i += 2) {
+            if (0 == std::strcmp(argv[i], "--out")) {
+                m_outFile = argv[i + 1];
+            } else if (0 == std::strcmp(argv[i], "--filter")) {
+                m_filter = argv[i + 1];
+            } else if (0 == std::strcmp(argv[i], "--min-time")) {
+                m_minTime = std::chrono::duration<double, std::milli>(std::atof(argv[i + 1]));
+            }
+        }
+    }
+
+    /// Measures \p f, which processes \p items items per call, independent of each other.
+    template <class F> void throughput(const std::string &name, std::size_t items, F &&f)
+    {
+        run("throughput", name, items, f);
+    }
+
+    /// Measures \p f, which performs a chain of \p items dependent operations per call.
+    template <class F> void latency(const std::string &name, std::size_t items, F &&f)
+    {
+        run("latency", name, items, f);
+    }
+
+    /// Writes the JSON document and returns the exit code for main.
+    int finish() const
+    {
+        FILE *out = m_outFile.empty() ? stdout : std::fopen(m_outFile.c_str(), "w");
+        if (!out) {
+            std::perror(m_outFile.c_str());
+            return 1;
+        }
+        std::fprintf(out,
+                     "{\n  \"implementation\": \"%s\",\n  \"vc_version\": \"%s\",\n"
+                     "  \"compiler\": \"%s\",\n  \"float_v_size\": %d,\n  \"results\": [",
+                     implementationName(), Vc_VERSION_STRING, escaped(compiler()).c_str(),
+                     int(Vc::float_v::size()));
+        const char *separator = "\n";
+        for (const Result &r : m_results) {
+            std::fprintf(out,
+                         "%s    { \"name\": \"%s\", \"kind\": \"%s\", \"items\": %zu, "
+                         "\"calls\": %zu, \"ns_per_item\": %.6g, \"cycles_per_item\": %.6g }",
+                         separator, escaped(r.name).c_str(), r.kind, r.items, r.calls,
+                         r.nsPerItem, r.cyclesPerItem);
+            separator = ",\n";
+        }
+        std::fprintf(out, "\n  ]\n}\n");
+        if (out != stdout) {
+            std::fclose(out);
+        }
+        return 0;
+    }
+
+private:
+    struct Result {
+        std::string name;
+        const char *kind;
+        std::size_t items, calls;
+        double nsPerItem, cyclesPerItem;
+    };
+
+    static std::string compiler()
+    {
+#if defined __GNUC__ && !defined __clang__ && !defined __INTEL_COMPILER
+        return "GCC " __VERSION__;
+#elif defined __VERSION__
+        return __VERSION__;
+#elif defined _MSC_FULL_VER
+        return "MSVC " + std::to_string(_MSC_FULL_VER);
+#else
+        return "unknown";
+#endif
+    }
+
+    static std::string escaped(const std::string &s)
+    {
+        std::string r;
+        for (char c : s) {
+            if (c == '"' || c == '\\') {
+                r += '\\';
+            }
+            r += c;
+        }
+        return r;
+    }
+
+    template <class F>
+    void run(const char *kind, const std::string &name, std::size_t items, F &f)
+    {
+        if (!m_filter.empty() && name.find(m_filter) == std::string::npos) {
+            return;
+        }
+        using clock = std::chrono::steady_clock;
+        // double the number of calls until one repetition takes at least m_minTime
+        std::size_t calls = 1;
+        for (;;) {
+            const auto start = clock::now();
+            for (std::size_t i = 0; i < calls; ++i) {
+                f();
+            }
+            if (clock::now() - start >= m_minTime || calls >= (std::size_t(1) << 40)) {
+                break;
+            }
+            calls *= 2;
+        }
+        double bestNs = 1e300, bestCycles = 1e300;
+        for (int rep = 0; rep < 5; ++rep) {
+            const auto start = clock::now();
+            const auto startCycles = cycles();
+            for (std::size_t i = 0; i < calls; ++i) {
+                f();
+            }
+            const auto endCycles = cycles();
+            const std::chrono::duration<double, std::nano> elapsed = clock::now() - start;
+            bestNs = std::min(bestNs, elapsed.count());
+            bestCycles = std::min(bestCycles, double(endCycles - startCycles));
+        }
+        const double n = double(calls) * double(items);
+        m_results.push_back({name, kind, items, calls, bestNs / n, bestCycles / n});
+        std::fprintf(stderr, "%-48s %-10s %10.4f ns/item\n", name.c_str(), kind,
+                     bestNs / n);
+    }
+
+    std::vector<Result> m_results;
+    std::string m_outFile, m_filter;
+    std::chrono::duration<double, std::milli> m_minTime{10};
+};
+//}}}1
+}  // namespace Benchmark
+
+#endif  // VC_BENCHMARKS_BENCHMARK_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,94 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+
+using namespace Vc;
+using Benchmark::fakeModify;
+using Benchmark::fakeRead;
+
+// Number of entries processed per call.
+constexpr std::size_t N = 1024;
+
+/* Integer division by a divisor that is only known at runtime, once with the builtin
+ * vector operators (divisor broadcast to a vector) and once with a precomputed
+ * Vc::Divider. 7 and 1000 need the MultiplyAdd code path for 32-bit unsigned types and
+ * the Multiply path otherwise; 64 takes the Shift path.
+ */
+template <class V> void benchmarkDivider(Benchmark::Runner &runner, int divisor)
+{
+    using T = typename V::EntryType;
+    const std::string suffix =
+        "/" + Benchmark::vectorName<V>() + "/" + std::to_string(divisor);
+    const auto input = Benchmark::randomValues<T>(
+        N, std::is_signed<T>::value ? double(std::numeric_limits<T>::min()) : 0.,
+        double(std::numeric_limits<T>::max()));
+    Memory<V, N> in, out;
+    std::copy(input.begin(), input.end(), in.entries());
+    T d = divisor;
+    fakeModify(d);
+    const Divider<T> divider(d);
+
+    runner.throughput("operator/" + suffix, N, [&] {
+        const V dv = d;
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            (V(&in[i], Aligned) / dv).store(&out[i], Aligned);
+        }
+        fakeRead(out[0]);
+    });
+    runner.throughput("Divider/" + suffix, N, [&] {
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            (V(&in[i], Aligned) / divider).store(&out[i], Aligned);
+        }
+        fakeRead(out[0]);
+    });
+    runner.throughput("operator%" + suffix, N, [&] {
+        const V dv = d;
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            (V(&in[i], Aligned) % dv).store(&out[i], Aligned);
+        }
+        fakeRead(out[0]);
+    });
+    runner.throughput("Divider%" + suffix, N, [&] {
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            (V(&in[i], Aligned) % divider).store(&out[i], Aligned);
+        }
+        fakeRead(out[0]);
+    });
+}
+
+int main(int argc, char **argv)
+{
+    Benchmark::Runner runner(argc, argv);
+    for (int divisor : {7, 64, 1000}) {
+        benchmarkDivider<int_v>(runner, divisor);
+        benchmarkDivider<uint_v>(runner, divisor);
+        benchmarkDivider<short_v>(runner, divisor);
+        benchmarkDivider<ushort_v>(runner, divisor);
+    }
+    return runner.finish();
+}
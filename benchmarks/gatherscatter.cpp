@@ -0,0 +1,283 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+#ifndef Vc_IMPL_Scalar
+#include <Vc/common/gatherimplementation.h>
+#include <Vc/common/scatterimplementation.h>
+#endif
+
+using namespace Vc;
+using Benchmark::fakeRead;
+using Benchmark::fakeModify;
+
+// Number of entries in the gathered-from / scattered-to table.
+constexpr std::size_t TableSize = 4096;
+// Number of gathers / scatters per call.
+constexpr std::size_t Repetitions = 256;
+
+// input data {{{1
+template <class V> struct Input {
+    using T = typename V::EntryType;
+    using IT = typename V::IndexType;
+    using M = typename V::MaskType;
+    static constexpr std::size_t MaskCount = 64;
+
+    Input()
+    {
+        std::mt19937 engine(1);
+        std::uniform_int_distribution<int> dist(0, TableSize - 1);
+        for (auto &x : table) {
+            x = T(1);
+        }
+        for (std::size_t i = 0; i < Repetitions; ++i) {
+            indexes.push_back(IT([&](int) { return dist(engine); }));
+        }
+        masks.resize(MaskCount);
+    }
+
+    // fill the masks with random bits, with the given percentage of set lanes
+    void setDensity(int percent)
+    {
+        std::mt19937 engine(percent);
+        std::uniform_int_distribution<int> dist(0, 99);
+        for (auto &m : masks) {
+            for (std::size_t i = 0; i < V::Size; ++i) {
+                m[i] = dist(engine) < percent;
+            }
+        }
+    }
+
+    Memory<V, TableSize> table;
+    std::vector<IT, Allocator<IT>> indexes;
+    std::vector<M, Allocator<M>> masks;
+};
+
+#ifndef Vc_IMPL_Scalar
+// The Scalar implementation has no gather/scatter strategies, only the unmasked and
+// masked member functions are measured there.
+using Common::GatherScatterImplementation;
+
+// Which GatherScatterImplementation strategies can be instantiated for V {{{1
+template <class V, GatherScatterImplementation I> struct Supported : std::true_type {
+};
+// PopcntSwitch is implemented for 2, 4, 8, and 16 entries
+template <class V>
+struct Supported<V, GatherScatterImplementation::PopcntSwitch>
+    : std::integral_constant<bool, V::Size == 2 || V::Size == 4 || V::Size == 8 ||
+                                       V::Size == 16> {
+};
+// Adaptive falls back to PopcntSwitch for dense masks
+template <class V>
+struct Supported<V, GatherScatterImplementation::Adaptive>
+    : Supported<V, GatherScatterImplementation::PopcntSwitch> {
+};
+
+inline const char *implementationName(GatherScatterImplementation i)
+{
+    switch (i) {
+    case GatherScatterImplementation::SimpleLoop: return "SimpleLoop";
+    case GatherScatterImplementation::SetIndexZero: return "SetIndexZero";
+    case GatherScatterImplementation::BitScanLoop: return "BitScanLoop";
+    case GatherScatterImplementation::PopcntSwitch: return "PopcntSwitch";
+    case GatherScatterImplementation::Adaptive: return "Adaptive";
+    }
+    return "unknown";
+}
+
+// gathers {{{1
+template <class V, GatherScatterImplementation I>
+void benchmarkMaskedGather(Benchmark::Runner &runner, Input<V> &in, const std::string &name,
+                           std::false_type)
+{
+}
+template <class V, GatherScatterImplementation I>
+void benchmarkMaskedGather(Benchmark::Runner &runner, Input<V> &in, const std::string &name,
+                           std::true_type)
+{
+    using Selector = std::integral_constant<GatherScatterImplementation, I>;
+    const auto *mem = in.table.entries();
+    runner.throughput(name, Repetitions * V::Size, [&] {
+        for (std::size_t i = 0; i < Repetitions; ++i) {
+            V x = V(0);
+            Common::executeGather(Selector(), x, mem, in.indexes[i],
+                                  in.masks[i % in.MaskCount]);
+            fakeRead(x);
+        }
+    });
+    // the next index depends on the previously gathered values (all equal to 1)
+    runner.latency(name, Repetitions, [&] {
+        auto idx = in.indexes[0];
+        for (std::size_t i = 0; i < Repetitions; ++i) {
+            V x = V(1);
+            Common::executeGather(Selector(), x, mem, idx, in.masks[i % in.MaskCount]);
+            idx += simd_cast<typename V::IndexType>(x) - 1;
+        }
+        fakeRead(idx);
+    });
+}
+
+template <class V, GatherScatterImplementation I>
+void benchmarkMaskedScatter(Benchmark::Runner &runner, Input<V> &in,
+                            const std::string &name, std::false_type)
+{
+}
+template <class V, GatherScatterImplementation I>
+void benchmarkMaskedScatter(Benchmark::Runner &runner, Input<V> &in,
+                            const std::string &name, std::true_type)
+{
+    using Selector = std::integral_constant<GatherScatterImplementation, I>;
+    auto *mem = in.table.entries();
+    V x = V(1);
+    fakeModify(x);
+    runner.throughput(name, Repetitions * V::Size, [&] {
+        for (std::size_t i = 0; i < Repetitions; ++i) {
+            Common::executeScatter(Selector(), x, mem, in.indexes[i],
+                                   in.masks[i % in.MaskCount]);
+        }
+        fakeRead(*mem);
+    });
+}
+
+template <class V, GatherScatterImplementation I>
+void benchmarkImplementation(Benchmark::Runner &runner, Input<V> &in,
+                             const std::string &suffix)
+{
+    const std::string name = Benchmark::vectorName<V>() + "/" + implementationName(I) + suffix;
+    benchmarkMaskedGather<V, I>(runner, in, "gather/" + name, Supported<V, I>());
+    benchmarkMaskedScatter<V, I>(runner, in, "scatter/" + name, Supported<V, I>());
+}
+#endif  // Vc_IMPL_Scalar
+
+template <class V> void benchmarkGatherScatter(Benchmark::Runner &runner)
+{
+    Input<V> in;
+    const std::string prefix = Benchmark::vectorName<V>() + "/";
+    const auto *mem = in.table.entries();
+    auto *out = in.table.entries();
+
+    // unmasked gather/scatter as implemented by the Vector type
+    runner.throughput("gather/" + prefix + "unmasked", Repetitions * V::Size, [&] {
+        for (std::size_t i = 0; i < Repetitions; ++i) {
+            V x(mem, in.indexes[i]);
+            fakeRead(x);
+        }
+    });
+    runner.latency("gather/" + prefix + "unmasked", Repetitions, [&] {
+        auto idx = in.indexes[0];
+        for (std::size_t i = 0; i < Repetitions; ++i) {
+            V x(mem, idx);
+            idx += simd_cast<typename V::IndexType>(x) - 1;
+        }
+        fakeRead(idx);
+    });
+    runner.throughput("scatter/" + prefix + "unmasked", Repetitions * V::Size, [&] {
+        V x = V(1);
+        fakeModify(x);
+        for (std::size_t i = 0; i < Repetitions; ++i) {
+            x.scatter(out, in.indexes[i]);
+        }
+        fakeRead(*out);
+    });
+
+    // masked gather/scatter for every implementation strategy and a range of mask
+    // densities, which shows the crossover points of the strategies
+    for (int density : {100, 90, 75, 50, 25, 10}) {
+        in.setDensity(density);
+        const std::string suffix = "/density" + std::to_string(density);
+        runner.throughput("gather/" + prefix + "masked" + suffix, Repetitions * V::Size, [&] {
+            for (std::size_t i = 0; i < Repetitions; ++i) {
+                V x = V(0);
+                x.gather(mem, in.indexes[i], in.masks[i % in.MaskCount]);
+                fakeRead(x);
+            }
+        });
+#ifndef Vc_IMPL_Scalar
+        benchmarkImplementation<V, GatherScatterImplementation::SimpleLoop>(runner, in, suffix);
+        benchmarkImplementation<V, GatherScatterImplementation::SetIndexZero>(runner, in, suffix);
+        benchmarkImplementation<V, GatherScatterImplementation::BitScanLoop>(runner, in, suffix);
+        benchmarkImplementation<V, GatherScatterImplementation::PopcntSwitch>(runner, in, suffix);
+        benchmarkImplementation<V, GatherScatterImplementation::Adaptive>(runner, in, suffix);
+#endif
+    }
+}
+
+// simd_gather_for_each {{{1
+// Number of entries in the gathered-from table of simd_gather_for_each, large enough to
+// make the gathers miss all caches.
+constexpr std::size_t LargeTableSize = 1 << 24;
+// Number of indexes per call.
+constexpr std::size_t StreamLength = 1 << 16;
+
+// the inner loop of a sparse matrix-vector product
+template <class T> struct Dot {
+    const T *values;
+    T *sum;
+    template <class V> void operator()(const V &x, std::size_t i) const
+    {
+        *sum += (V(values + i, Unaligned) * x).sum();
+    }
+};
+
+template <class V> void benchmarkGatherStream(Benchmark::Runner &runner)
+{
+    using T = typename V::EntryType;
+    const auto table = Benchmark::randomValues<T>(LargeTableSize, 0, 1);
+    const auto values = Benchmark::randomValues<T>(StreamLength, 0, 1);
+    std::vector<int> indexes(StreamLength);
+    std::mt19937 engine(1);
+    std::uniform_int_distribution<int> dist(0, LargeTableSize - 1);
+    for (auto &i : indexes) {
+        i = dist(engine);
+    }
+    const GatherPrefetch distances[] = {{0, 0}, {4, 0}, {8, 0}, {16, 0}, {32, 0}, {8, 32}};
+    for (const auto prefetch : distances) {
+        const std::string name = "gatherstream/" + Benchmark::vectorName<V>() + "/close" +
+                                 std::to_string(prefetch.close) + "/mid" +
+                                 std::to_string(prefetch.mid);
+        runner.throughput(name, StreamLength, [&] {
+            T sum = 0;
+            simd_gather_for_each<V>(table.data(), indexes.data(), StreamLength,
+                                    Dot<T>{values.data(), &sum}, prefetch);
+            fakeRead(sum);
+        });
+    }
+}
+
+int main(int argc, char **argv)  //{{{1
+{
+    Benchmark::Runner runner(argc, argv);
+    benchmarkGatherScatter<float_v>(runner);
+    benchmarkGatherScatter<double_v>(runner);
+    benchmarkGatherScatter<int_v>(runner);
+    benchmarkGatherScatter<short_v>(runner);
+    benchmarkGatherStream<float_v>(runner);
+    benchmarkGatherStream<double_v>(runner);
+    return runner.finish();
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,117 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+#include <random>
+
+using namespace Vc;
+using Benchmark::fakeRead;
+
+// Number of keys processed per call.
+constexpr std::size_t N = 4096;
+
+// hash functions {{{1
+// f is called with vectors, fScalar with single keys.
+template <class V, class F, class FScalar>
+void benchmarkHash(Benchmark::Runner &runner, const std::string &name, F &&f,
+                   FScalar &&fScalar)
+{
+    using T = typename V::EntryType;
+    const std::string fullName = "hash/" + Benchmark::vectorName<V>() + "/" + name;
+    const auto input = Benchmark::randomValues<T>(N, 0, std::numeric_limits<T>::max());
+    Memory<V, N> in;
+    std::copy(input.begin(), input.end(), in.entries());
+    Memory<uint_v, N> out;
+
+    runner.throughput(fullName, N, [&] {
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            simd_cast<SimdArray<uint, V::Size>>(f(V(&in[i], Aligned)))
+                .store(&out[i], Aligned);
+        }
+        fakeRead(out[0]);
+    });
+    runner.throughput("hash/" + std::string(Benchmark::TypeName<T>::get()) + "/" + name, N,
+                      [&] {
+                          for (std::size_t i = 0; i < N; ++i) {
+                              out[i] = fScalar(input[i]);
+                          }
+                          fakeRead(out[0]);
+                      });
+}
+
+// simd_hash_table::find {{{1
+// Probes with 50% hit rate into tables that fit into L1, L2, and L3 or memory.
+void benchmarkProbe(Benchmark::Runner &runner, std::size_t tableSize)
+{
+    const std::string suffix = "/" + std::to_string(tableSize);
+    std::default_random_engine engine(1);
+    std::uniform_int_distribution<uint> dist(0, 2 * tableSize - 1);
+    simd_hash_table<float> table(tableSize);
+    while (table.size() < tableSize) {
+        const uint key = dist(engine);
+        table.insert(key, float(key));
+    }
+    std::vector<uint> keys(N);
+    for (auto &k : keys) {
+        k = dist(engine);
+    }
+    std::vector<float> values(N);
+    runner.throughput("probe/simd_hash_table::find(range)" + suffix, N, [&] {
+        table.find(keys.data(), N, values.data());
+        fakeRead(values[0]);
+    });
+    runner.throughput("probe/simd_hash_table::find(uint)" + suffix, N, [&] {
+        for (std::size_t i = 0; i < N; ++i) {
+            values[i] = 0;
+            table.find(keys[i], values[i]);
+        }
+        fakeRead(values[0]);
+    });
+}
+
+int main(int argc, char **argv)  //{{{1
+{
+    Benchmark::Runner runner(argc, argv);
+    benchmarkHash<uint_v>(runner, "murmur3", [](uint_v x) { return hash_murmur3(x); },
+                          [](uint x) { return hash_murmur3(x); });
+    benchmarkHash<uint_v>(runner, "xxh32", [](uint_v x) { return hash_xxh32(x); },
+                          [](uint x) { return hash_xxh32(x); });
+    benchmarkHash<uint_v>(runner, "crc32c", [](uint_v x) { return hash_crc32c(x); },
+                          [](uint x) { return hash_crc32c(x); });
+    benchmarkHash<ushort_v>(runner, "murmur3", [](ushort_v x) { return hash_murmur3(x); },
+                            [](ushort x) { return hash_murmur3(x); });
+    benchmarkHash<ushort_v>(runner, "xxh32", [](ushort_v x) { return hash_xxh32(x); },
+                            [](ushort x) { return hash_xxh32(x); });
+    benchmarkHash<ushort_v>(runner, "crc32c", [](ushort_v x) { return hash_crc32c(x); },
+                            [](ushort x) { return hash_crc32c(x); });
+    for (std::size_t n : {std::size_t(1) << 10, std::size_t(1) << 15, std::size_t(1) << 22}) {
+        benchmarkProbe(runner, n);
+    }
+    return runner.finish();
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,97 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+
+using namespace Vc;
+using Benchmark::fakeRead;
+
+// Number of values per call.
+constexpr std::size_t N = 1 << 16;
+
+/* Every histogram is filled from uniformly distributed values and from a constant value.
+ * The latter makes every vector conflict in all lanes and serializes the increments of
+ * the scalar loop on a single counter.
+ */
+template <class T> void benchmarkHistogram(Benchmark::Runner &runner, std::size_t nbins)
+{
+    const auto uniform = Benchmark::randomValues<T>(N, 0, nbins - 1);
+    const std::vector<T> constant(N, T(nbins / 2));
+    std::vector<uint> bins(nbins);
+    for (const auto *data : {&uniform, &constant}) {
+        const std::string name = std::string(Benchmark::TypeName<T>::get()) + "/" +
+                                 std::to_string(nbins) +
+                                 (data == &uniform ? "/uniform" : "/constant");
+        runner.throughput("simd_histogram/" + name, N, [&] {
+            simd_histogram(data->begin(), data->end(), bins.begin(), bins.end());
+            fakeRead(bins[0]);
+        });
+        runner.throughput("scalar/" + name, N, [&] {
+            for (T x : *data) {
+                if (std::size_t(x) < nbins) {
+                    ++bins[x];
+                }
+            }
+            fakeRead(bins[0]);
+        });
+    }
+}
+
+// scatter_add of float_v into a table of the given size
+void benchmarkScatterAdd(Benchmark::Runner &runner, std::size_t tableSize)
+{
+    using IV = float_v::IndexType;
+    std::vector<float> table(tableSize);
+    const auto indexes = Benchmark::randomValues<int>(N, 0, tableSize - 1);
+    const auto values = Benchmark::randomValues<float>(N, 0, 1);
+    const std::string name = Benchmark::vectorName<float_v>() + "/" + std::to_string(tableSize);
+    runner.throughput("scatter_add/" + name, N, [&] {
+        for (std::size_t i = 0; i < N; i += float_v::Size) {
+            scatter_add(table.data(), IV(&indexes[i], Unaligned),
+                        float_v(&values[i], Unaligned));
+        }
+        fakeRead(table[0]);
+    });
+    runner.throughput("scatter_add/float/" + std::to_string(tableSize), N, [&] {
+        for (std::size_t i = 0; i < N; ++i) {
+            table[indexes[i]] += values[i];
+        }
+        fakeRead(table[0]);
+    });
+}
+
+int main(int argc, char **argv)
+{
+    Benchmark::Runner runner(argc, argv);
+    for (std::size_t nbins : {16, 256, 2048, 65536}) {
+        benchmarkHistogram<int>(runner, nbins);
+        benchmarkHistogram<ushort>(runner, nbins);
+    }
+    benchmarkScatterAdd(runner, 16);
+    benchmarkScatterAdd(runner, 65536);
+    return runner.finish();
+}
@@ -0,0 +1,229 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+
+using namespace Vc;
+using Benchmark::fakeRead;
+using Benchmark::fakeModify;
+
+// Size of the buffers in bytes; small enough to stay in L1.
+constexpr std::size_t BufferBytes = 16 * 1024;
+
+template <class V> void benchmarkLoadStore(Benchmark::Runner &runner)
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t N = BufferBytes / sizeof(T);
+    const std::string prefix = Benchmark::vectorName<V>() + "/";
+    // one extra vector for the unaligned variants
+    Memory<V, N + V::Size> mem;
+    for (std::size_t i = 0; i < mem.entriesCount(); ++i) {
+        mem[i] = T(0);
+    }
+    T *const data = mem.entries();
+
+    runner.throughput("load/" + prefix + "aligned", N, [&] {
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            V x(data + i, Aligned);
+            fakeRead(x);
+        }
+    });
+    runner.throughput("load/" + prefix + "unaligned", N, [&] {
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            V x(data + i + 1, Unaligned);
+            fakeRead(x);
+        }
+    });
+    // every load address depends on the value returned by the previous load (all zeros)
+    runner.latency("load/" + prefix + "aligned", N / V::Size, [&] {
+        std::size_t offset = 0;
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            V x(data + offset, Aligned);
+            offset = static_cast<std::size_t>(x[0]);
+        }
+        fakeRead(offset);
+    });
+
+    V value = V(1);
+    fakeModify(value);
+    runner.throughput("store/" + prefix + "aligned", N, [&] {
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            value.store(data + i, Aligned);
+        }
+        fakeRead(*data);
+    });
+    runner.throughput("store/" + prefix + "unaligned", N, [&] {
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            value.store(data + i + 1, Unaligned);
+        }
+        fakeRead(*data);
+    });
+    runner.throughput("store/" + prefix + "streaming", N, [&] {
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            value.store(data + i, Streaming | Aligned);
+        }
+        fakeRead(*data);
+    });
+
+    // alternating mask patterns, so that the branch predictor cannot learn a single one
+    typename V::MaskType masks[4] = {
+        V([](int i) { return i; }) < V(V::Size / 2),
+        V([](int i) { return i % 2; }) == V(0),
+        V([](int i) { return i; }) == V(0),
+        V([](int i) { return i; }) >= V(0)};
+    fakeModify(masks);
+    runner.throughput("store/" + prefix + "masked", N, [&] {
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            value.store(data + i, masks[(i / V::Size) & 3], Aligned);
+        }
+        fakeRead(*data);
+    });
+    runner.throughput("store/" + prefix + "compress_store", N, [&] {
+        T *out = data;
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            out += value.compress_store(out, masks[(i / V::Size) & 3]);
+        }
+        fakeRead(*data);
+    });
+    runner.throughput("load/" + prefix + "expand_load", N, [&] {
+        const T *in = data;
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            V x = value;
+            in += x.expand_load(in, masks[(i / V::Size) & 3]);
+            fakeRead(x);
+        }
+    });
+    // store followed by a load of the same address (store forwarding)
+    runner.latency("store/" + prefix + "store_load", N / V::Size, [&] {
+        V x = value;
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            x.store(data, Aligned);
+            x.load(data, Aligned);
+        }
+        fakeRead(x);
+    });
+}
+
+// Loads of float_v from random positions in a buffer much larger than the TLB reach
+// with base pages. Every load misses the caches; with base pages most also miss the
+// TLB.
+void benchmarkHugePages(Benchmark::Runner &runner)
+{
+    constexpr std::size_t Bytes = 512 * 1024 * 1024;
+    constexpr std::size_t Loads = 1 << 16;
+    const auto offsets =
+        Benchmark::randomValues<int>(Loads, 0, Bytes / sizeof(float) / float_v::Size - 1);
+    for (MallocAlignment A : {AlignOnVector, AlignOnHugePage}) {
+        Memory<float_v> mem(Bytes / sizeof(float), A);
+        mem.setZero();
+        const float *data = mem.entries();
+        runner.throughput(
+            std::string("load/float_v/random/") +
+                (A == AlignOnVector ? "AlignOnVector" : "AlignOnHugePage"),
+            Loads, [&] {
+                float_v sum = 0.f;
+                for (std::size_t i = 0; i < Loads; ++i) {
+                    sum += float_v(data + offsets[i] * float_v::Size, Aligned);
+                }
+                fakeRead(sum);
+            });
+    }
+}
+
+// Range copy and fill of a buffer far larger than the last level cache. The standard
+// algorithms read every destination cache line before overwriting it and evict the
+// working set; simd_copy and simd_fill switch to non-temporal stores.
+void benchmarkStreamingRanges(Benchmark::Runner &runner)
+{
+    constexpr std::size_t N = 64 * 1024 * 1024;
+    std::vector<float, Allocator<float>> in(N, 1.f), out(N);
+    runner.throughput("range/float/std::copy", N, [&] {
+        std::copy(in.begin(), in.end(), out.begin());
+        fakeRead(out[0]);
+    });
+    runner.throughput("range/float/simd_copy", N, [&] {
+        simd_copy(in.begin(), in.end(), out.begin());
+        fakeRead(out[0]);
+    });
+    runner.throughput("range/float/std::fill", N, [&] {
+        std::fill(out.begin(), out.end(), 2.f);
+        fakeRead(out[0]);
+    });
+    runner.throughput("range/float/simd_fill", N, [&] {
+        simd_fill(out.begin(), out.end(), 2.f);
+        fakeRead(out[0]);
+    });
+}
+
+// Sequential reduction over an array far larger than the last level cache, iterated with
+// the plain Memory iterators and with Memory::prefetching(), which additionally issues
+// software prefetches ahead of the loads.
+void benchmarkPrefetchingIteration(Benchmark::Runner &runner)
+{
+    constexpr std::size_t N = 64 * 1024 * 1024;
+    Memory<float_v> mem(N);
+    for (std::size_t i = 0; i < mem.vectorsCount(); ++i) {
+        mem.vector(i) = 1.f;
+    }
+    runner.throughput("iterate/float_v/Memory::begin", N, [&] {
+        float_v sum = 0.f;
+        for (const auto &x : mem) {
+            sum += x;
+        }
+        fakeRead(sum);
+    });
+    runner.throughput("iterate/float_v/Memory::prefetching", N, [&] {
+        float_v sum = 0.f;
+        for (const auto &x : mem.prefetching()) {
+            sum += x;
+        }
+        fakeRead(sum);
+    });
+    runner.throughput("iterate/float_v/Memory::prefetching<1024, 8192>", N, [&] {
+        float_v sum = 0.f;
+        for (const auto &x : mem.prefetching<1024, 8192>()) {
+            sum += x;
+        }
+        fakeRead(sum);
+    });
+}
+
+int main(int argc, char **argv)
+{
+    Benchmark::Runner runner(argc, argv);
+    benchmarkHugePages(runner);
+    benchmarkStreamingRanges(runner);
+    benchmarkPrefetchingIteration(runner);
+    benchmarkLoadStore<float_v>(runner);
+    benchmarkLoadStore<double_v>(runner);
+    benchmarkLoadStore<int_v>(runner);
+    benchmarkLoadStore<short_v>(runner);
+    benchmarkLoadStore<SimdArray<float, 32>>(runner);
+    return runner.finish();
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,116 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+
+using namespace Vc;
+using Benchmark::fakeRead;
+
+// Number of entries processed per call.
+constexpr std::size_t N = 1024;
+
+/* Every function is measured twice: for throughput on N independent inputs from the given
+ * domain, and for latency as a chain x = f(x). The functions used in the chain map their
+ * domain into itself (e.g. exp(-x) on [0, 1]), so that the chain never leaves the
+ * measured input range.
+ */
+template <class V, class F>
+void benchmarkFunction(Benchmark::Runner &runner, const std::string &name, double lo,
+                       double hi, F &&f)
+{
+    using T = typename V::EntryType;
+    const std::string fullName = "math/" + Benchmark::vectorName<V>() + "/" + name;
+    const auto input = Benchmark::randomValues<T>(N, lo, hi);
+    Memory<V, N> in, out;
+    std::copy(input.begin(), input.end(), in.entries());
+
+    runner.throughput(fullName, N, [&] {
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            f(V(&in[i], Aligned)).store(&out[i], Aligned);
+        }
+        fakeRead(out[0]);
+    });
+    runner.latency(fullName, N / V::Size, [&] {
+        V x(&in[0], Aligned);
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            x = f(x);
+        }
+        fakeRead(x);
+    });
+}
+
+template <class V> void benchmarkMath(Benchmark::Runner &runner)
+{
+    benchmarkFunction<V>(runner, "sqrt", 0, 1e3, [](V x) { return sqrt(x); });
+    benchmarkFunction<V>(runner, "rsqrt", 0.5, 2, [](V x) { return rsqrt(x); });
+    benchmarkFunction<V>(runner, "reciprocal", 0.5, 2, [](V x) { return reciprocal(x); });
+    benchmarkFunction<V>(runner, "exp", 0, 1, [](V x) { return exp(-x); });
+    benchmarkFunction<V>(runner, "log", 1, 2, [](V x) { return log(x + V(1)); });
+    benchmarkFunction<V>(runner, "log2", 1, 2, [](V x) { return log2(x + V(1)); });
+    benchmarkFunction<V>(runner, "log10", 1, 10, [](V x) { return log10(x) * V(9) + V(1); });
+    benchmarkFunction<V>(runner, "sin", -3, 3, [](V x) { return sin(x); });
+    benchmarkFunction<V>(runner, "cos", -3, 3, [](V x) { return cos(x); });
+    benchmarkFunction<V>(runner, "sincos", -3, 3, [](V x) {
+        V s, c;
+        sincos(x, &s, &c);
+        return s + c;
+    });
+    benchmarkFunction<V>(runner, "fast::exp", 0, 1, [](V x) { return fast::exp(-x); });
+    benchmarkFunction<V>(runner, "fast::log", 1, 2, [](V x) { return fast::log(x + V(1)); });
+    benchmarkFunction<V>(runner, "fast::log2", 1, 2,
+                         [](V x) { return fast::log2(x + V(1)); });
+    benchmarkFunction<V>(runner, "fast::log10", 1, 10,
+                         [](V x) { return fast::log10(x) * V(9) + V(1); });
+    benchmarkFunction<V>(runner, "fast::sin", -3, 3, [](V x) { return fast::sin(x); });
+    benchmarkFunction<V>(runner, "fast::cos", -3, 3, [](V x) { return fast::cos(x); });
+    benchmarkFunction<V>(runner, "fast::sincos", -3, 3, [](V x) {
+        V s, c;
+        fast::sincos(x, &s, &c);
+        return s + c;
+    });
+    benchmarkFunction<V>(runner, "erf", -3, 3, [](V x) { return erf(x); });
+    benchmarkFunction<V>(runner, "erfc", 0, 2, [](V x) { return erfc(x); });
+    benchmarkFunction<V>(runner, "lgamma", 1, 10,
+                         [](V x) { return lgamma(x) * V(0.5) + V(1); });
+    benchmarkFunction<V>(runner, "normcdf", -3, 3, [](V x) { return normcdf(x); });
+    benchmarkFunction<V>(runner, "normcdfinv", 0.01, 0.99,
+                         [](V x) { return normcdfinv(x) * V(0.1) + V(0.5); });
+    benchmarkFunction<V>(runner, "asin", -1, 1, [](V x) { return asin(x); });
+    benchmarkFunction<V>(runner, "atan", -10, 10, [](V x) { return atan(x); });
+    benchmarkFunction<V>(runner, "atan2", -10, 10, [](V x) { return atan2(x, V(0.5)); });
+    benchmarkFunction<V>(runner, "round", -1e3, 1e3, [](V x) { return round(x); });
+    benchmarkFunction<V>(runner, "floor", -1e3, 1e3, [](V x) { return floor(x); });
+    benchmarkFunction<V>(runner, "abs", -1e3, 1e3, [](V x) { return abs(x); });
+}
+
+int main(int argc, char **argv)
+{
+    Benchmark::Runner runner(argc, argv);
+    benchmarkMath<float_v>(runner);
+    benchmarkMath<double_v>(runner);
+    return runner.finish();
+}
@@ -0,0 +1,126 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+#include <Vc/random>
+#include <random>
+
+using namespace Vc;
+using Benchmark::fakeRead;
+
+// Number of entries generated per call.
+constexpr std::size_t N = 1024;
+
+// engines {{{1
+template <class Engine> void benchmarkEngine(Benchmark::Runner &runner, const std::string &name)
+{
+    using V = typename Engine::result_type;
+    Engine engine(1);
+    Memory<V, N> out;
+    runner.throughput("engine/" + name, N, [&] {
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            engine().store(&out[i], Aligned);
+        }
+        fakeRead(out[0]);
+    });
+}
+
+// distributions {{{1
+template <class V, class Engine>
+void benchmarkDistributions(Benchmark::Runner &runner, const std::string &engineName)
+{
+    const std::string suffix = "/" + Benchmark::vectorName<V>() + "/" + engineName;
+    Engine engine(1);
+    Memory<V, N> out;
+    UniformDistribution<V> uniform;
+    NormalDistribution<V> normal;
+    ExponentialDistribution<V> exponential;
+    runner.throughput("uniform" + suffix, N, [&] {
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            uniform(engine).store(&out[i], Aligned);
+        }
+        fakeRead(out[0]);
+    });
+    runner.throughput("normal" + suffix, N, [&] {
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            normal(engine).store(&out[i], Aligned);
+        }
+        fakeRead(out[0]);
+    });
+    runner.throughput("exponential" + suffix, N, [&] {
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            exponential(engine).store(&out[i], Aligned);
+        }
+        fakeRead(out[0]);
+    });
+}
+
+// the standard library as reference {{{1
+template <class T> void benchmarkStd(Benchmark::Runner &runner)
+{
+    const std::string suffix =
+        "/" + std::string(Benchmark::TypeName<T>::get()) + "/std::mt19937";
+    std::mt19937 engine(1);
+    std::vector<T> out(N);
+    std::uniform_real_distribution<T> uniform;
+    std::normal_distribution<T> normal;
+    std::exponential_distribution<T> exponential;
+    runner.throughput("uniform" + suffix, N, [&] {
+        for (T &x : out) {
+            x = uniform(engine);
+        }
+        fakeRead(out[0]);
+    });
+    runner.throughput("normal" + suffix, N, [&] {
+        for (T &x : out) {
+            x = normal(engine);
+        }
+        fakeRead(out[0]);
+    });
+    runner.throughput("exponential" + suffix, N, [&] {
+        for (T &x : out) {
+            x = exponential(engine);
+        }
+        fakeRead(out[0]);
+    });
+}
+
+int main(int argc, char **argv)  //{{{1
+{
+    Benchmark::Runner runner(argc, argv);
+    benchmarkEngine<Philox4x32_v>(runner, "Philox4x32_v");
+    benchmarkEngine<Xoshiro128_v>(runner, "Xoshiro128_v");
+    benchmarkDistributions<float_v, Philox4x32_v>(runner, "Philox4x32_v");
+    benchmarkDistributions<float_v, Xoshiro128_v>(runner, "Xoshiro128_v");
+    benchmarkDistributions<double_v, Philox4x32_v>(runner, "Philox4x32_v");
+    benchmarkDistributions<double_v, Xoshiro128_v>(runner, "Xoshiro128_v");
+    benchmarkStd<float>(runner);
+    benchmarkStd<double>(runner);
+    return runner.finish();
+}
+
+// vim: foldmethod=marker
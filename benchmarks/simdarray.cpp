@@ -0,0 +1,103 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+
+using namespace Vc;
+using Benchmark::fakeRead;
+using Benchmark::fakeModify;
+
+// Number of SimdArray objects processed per call.
+constexpr std::size_t N = 64;
+
+template <class A, class F>
+void benchmarkOp(Benchmark::Runner &runner, const std::string &name, std::vector<A> &data,
+                 F &&f)
+{
+    const std::string fullName = "simdarray/" + Benchmark::vectorName<A>() + "/" + name;
+    runner.throughput(fullName, N * A::size(), [&] {
+        for (std::size_t i = 0; i < N; ++i) {
+            auto r = f(data[i]);
+            fakeRead(r);
+        }
+    });
+    runner.latency(fullName, N, [&] {
+        A x = data[0];
+        for (std::size_t i = 0; i < N; ++i) {
+            x = f(x);
+        }
+        fakeRead(x);
+    });
+}
+
+template <class A> void benchmarkSimdArray(Benchmark::Runner &runner)
+{
+    using T = typename A::value_type;
+    std::vector<A> data(N);
+    const auto values = Benchmark::randomValues<T>(N * A::size(), 1, 2);
+    for (std::size_t i = 0; i < N; ++i) {
+        data[i] = A([&](std::size_t j) { return values[i * A::size() + j]; });
+    }
+    A one = A(1);
+    fakeModify(one);
+
+    benchmarkOp(runner, "add", data, [&](const A &x) { return x + one; });
+    benchmarkOp(runner, "mul", data, [&](const A &x) { return x * one; });
+    benchmarkOp(runner, "fma", data, [&](const A &x) { return x * one + one; });
+    benchmarkOp(runner, "div", data, [&](const A &x) { return x / one; });
+    benchmarkOp(runner, "where", data, [&](const A &x) {
+        A r = x;
+        where(x > one) | r = one;
+        return r;
+    });
+    benchmarkOp(runner, "sum", data, [&](const A &x) { return A(x.sum()); });
+    benchmarkOp(runner, "max", data, [&](const A &x) { return A(x.max()); });
+    benchmarkOp(runner, "shifted", data, [&](const A &x) { return x.shifted(1); });
+    benchmarkOp(runner, "rotated", data, [&](const A &x) { return x.rotated(1); });
+    benchmarkOp(runner, "reversed", data, [&](const A &x) { return x.reversed(); });
+    benchmarkOp(runner, "partialSum", data, [&](const A &x) { return x.partialSum(); });
+    benchmarkOp(runner, "any", data, [&](const A &x) {
+        return any_of(x > one) ? one : x;
+    });
+    benchmarkOp(runner, "convert", data, [&](const A &x) {
+        using I = fixed_size_simd<int, A::size()>;
+        return simd_cast<A>(simd_cast<I>(x));
+    });
+}
+
+int main(int argc, char **argv)
+{
+    Benchmark::Runner runner(argc, argv);
+    benchmarkSimdArray<SimdArray<float, float_v::size()>>(runner);
+    benchmarkSimdArray<SimdArray<float, 2 * float_v::size()>>(runner);
+    benchmarkSimdArray<SimdArray<float, 19>>(runner);
+    benchmarkSimdArray<SimdArray<float, 32>>(runner);
+    benchmarkSimdArray<SimdArray<double, 16>>(runner);
+    benchmarkSimdArray<SimdArray<int, 32>>(runner);
+    benchmarkSimdArray<SimdArray<short, 32>>(runner);
+    return runner.finish();
+}
@@ -0,0 +1,200 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+#include <numeric>
+
+using namespace Vc;
+using Benchmark::fakeRead;
+using Benchmark::fakeModify;
+
+// Number of structures processed per call.
+constexpr std::size_t N = 1024;
+
+template <typename T> struct Point3 {
+    T x, y, z;
+
+    Vc_SIMDIZE_INTERFACE((x, y, z));
+};
+template <typename T> struct Point4 {
+    T x, y, z, w;
+
+    Vc_SIMDIZE_INTERFACE((x, y, z, w));
+};
+
+// InterleavedMemoryWrapper {{{1
+template <class V> void benchmarkWrapper(Benchmark::Runner &runner)
+{
+    using T = typename V::EntryType;
+    using IT = typename V::IndexType;
+    const std::string prefix = "interleaved/" + Benchmark::vectorName<V>() + "/";
+    std::vector<Point3<T>> data3(N, Point3<T>{1, 1, 1});
+    std::vector<Point4<T>> data4(N, Point4<T>{1, 1, 1, 1});
+    auto wrapper3 = make_interleave_wrapper<V>(data3.data());
+    auto wrapper4 = make_interleave_wrapper<V>(data4.data());
+
+    runner.throughput(prefix + "load3", N, [&] {
+        for (std::size_t i = 0; i + V::Size <= N; i += V::Size) {
+            V x, y, z;
+            tie(x, y, z) = wrapper3[i];
+            fakeRead(x);
+            fakeRead(y);
+            fakeRead(z);
+        }
+    });
+    runner.throughput(prefix + "load4", N, [&] {
+        for (std::size_t i = 0; i + V::Size <= N; i += V::Size) {
+            V x, y, z, w;
+            tie(x, y, z, w) = wrapper4[i];
+            fakeRead(x);
+            fakeRead(y);
+            fakeRead(z);
+            fakeRead(w);
+        }
+    });
+    V v = V(1);
+    fakeModify(v);
+    runner.throughput(prefix + "store3", N, [&] {
+        for (std::size_t i = 0; i + V::Size <= N; i += V::Size) {
+            wrapper3[i] = tie(v, v, v);
+        }
+        fakeRead(data3[0]);
+    });
+    runner.throughput(prefix + "store4", N, [&] {
+        for (std::size_t i = 0; i + V::Size <= N; i += V::Size) {
+            wrapper4[i] = tie(v, v, v, v);
+        }
+        fakeRead(data4[0]);
+    });
+
+    // gather of structures at random positions (the wrapper requires unique indexes
+    // within one index vector)
+    std::vector<int> permutation(N);
+    std::iota(permutation.begin(), permutation.end(), 0);
+    std::shuffle(permutation.begin(), permutation.end(), std::mt19937(1));
+    std::vector<IT, Allocator<IT>> indexes;
+    for (std::size_t i = 0; i + V::Size <= N; i += V::Size) {
+        indexes.push_back(IT([&](std::size_t j) { return permutation[i + j]; }));
+    }
+    runner.throughput(prefix + "gather3", N, [&] {
+        for (const IT &idx : indexes) {
+            V x, y, z;
+            tie(x, y, z) = wrapper3[idx];
+            fakeRead(x);
+            fakeRead(y);
+            fakeRead(z);
+        }
+    });
+    // the next indexes depend on the previously loaded values (all equal to 1)
+    runner.latency(prefix + "gather3", N / V::Size, [&] {
+        IT idx = indexes[0];
+        for (std::size_t i = 0; i < N / V::Size; ++i) {
+            V x, y, z;
+            tie(x, y, z) = wrapper3[idx];
+            idx += simd_cast<IT>(x) - 1;
+        }
+        fakeRead(idx);
+    });
+    runner.throughput(prefix + "scatter3", N, [&] {
+        for (const IT &idx : indexes) {
+            wrapper3[idx] = tie(v, v, v);
+        }
+        fakeRead(data3[0]);
+    });
+}
+
+// simdize {{{1
+template <class T> void benchmarkSimdize(Benchmark::Runner &runner)
+{
+    using S = simdize<Point3<T>>;
+    constexpr std::size_t Size = S::size();
+    const std::string prefix =
+        "simdize/Point3<" + std::string(Benchmark::TypeName<T>::get()) + ">/";
+    std::vector<Point3<T>> data(N, Point3<T>{1, 1, 1});
+
+    runner.throughput(prefix + "load_interleaved", N, [&] {
+        for (std::size_t i = 0; i + Size <= N; i += Size) {
+            S p;
+            load_interleaved(p, &data[i]);
+            fakeRead(p);
+        }
+    });
+    S value;
+    load_interleaved(value, &data[0]);
+    fakeModify(value);
+    runner.throughput(prefix + "store_interleaved", N, [&] {
+        for (std::size_t i = 0; i + Size <= N; i += Size) {
+            store_interleaved(value, &data[i]);
+        }
+        fakeRead(data[0]);
+    });
+    runner.throughput(prefix + "insert", N, [&] {
+        S p;
+        for (std::size_t i = 0; i + Size <= N; i += Size) {
+            for (std::size_t j = 0; j < Size; ++j) {
+                decorate(p)[j] = data[i + j];
+            }
+            fakeRead(p);
+        }
+    });
+    runner.throughput(prefix + "extract", N, [&] {
+        for (std::size_t i = 0; i + Size <= N; i += Size) {
+            for (std::size_t j = 0; j < Size; ++j) {
+                data[i + j] = decorate(value)[j];
+            }
+        }
+        fakeRead(data[0]);
+    });
+
+    // the same structures stored in AoSoA layout need no shuffles
+    simd_vector<Point3<T>> soa(N, Point3<T>{1, 1, 1});
+    runner.throughput(prefix + "simd_vector/load", N, [&] {
+        for (std::size_t i = 0; i < soa.vectorsCount(); ++i) {
+            S p = soa.vector(i);
+            fakeRead(p);
+        }
+    });
+    runner.throughput(prefix + "simd_vector/store", N, [&] {
+        for (std::size_t i = 0; i < soa.vectorsCount(); ++i) {
+            soa.vector(i) = value;
+        }
+        fakeRead(soa.vector(0));
+    });
+}
+
+int main(int argc, char **argv)  //{{{1
+{
+    Benchmark::Runner runner(argc, argv);
+    benchmarkWrapper<float_v>(runner);
+    benchmarkWrapper<double_v>(runner);
+    benchmarkWrapper<int_v>(runner);
+    benchmarkSimdize<float>(runner);
+    benchmarkSimdize<double>(runner);
+    return runner.finish();
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,109 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+
+using namespace Vc;
+using Benchmark::fakeRead;
+
+// Vector::sorted {{{1
+template <class V> void benchmarkSorted(Benchmark::Runner &runner)
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t Count = 64;
+    const std::string name = "sorted/" + Benchmark::vectorName<V>();
+    const auto values = Benchmark::randomValues<T>(Count * V::Size, 0, 100);
+    std::vector<V, Allocator<V>> data(Count);
+    for (std::size_t i = 0; i < Count; ++i) {
+        data[i] = V([&](std::size_t j) { return values[i * V::Size + j]; });
+    }
+
+    runner.throughput(name, Count * V::Size, [&] {
+        for (const V &x : data) {
+            V r = x.sorted();
+            fakeRead(r);
+        }
+    });
+    // reversing the sorted vector makes sure the next sort has work to do
+    runner.latency(name, Count, [&] {
+        V x = data[0];
+        for (std::size_t i = 0; i < Count; ++i) {
+            x = x.sorted().reversed();
+        }
+        fakeRead(x);
+    });
+}
+
+// simd_sort {{{1
+// Every call copies the unsorted input before sorting it. The std::sort results carry
+// the same overhead and serve as the reference.
+template <class T> void benchmarkSimdSort(Benchmark::Runner &runner, std::size_t n)
+{
+    const std::string suffix =
+        "/" + std::string(Benchmark::TypeName<T>::get()) + "/" + std::to_string(n);
+    const auto input = Benchmark::randomValues<T>(n, -1e4, 1e4);
+    std::vector<T> data(n);
+    std::vector<std::uint32_t> values(n), indexes(n);
+
+    runner.throughput("simd_sort" + suffix, n, [&] {
+        std::copy(input.begin(), input.end(), data.begin());
+        simd_sort(data.begin(), data.end());
+        fakeRead(data[0]);
+    });
+    runner.throughput("simd_sort_key_value" + suffix, n, [&] {
+        std::copy(input.begin(), input.end(), data.begin());
+        simd_sort(data.begin(), data.end(), values.begin());
+        fakeRead(data[0]);
+    });
+    runner.throughput("simd_argsort" + suffix, n, [&] {
+        simd_argsort(input.begin(), input.end(), indexes.begin());
+        fakeRead(indexes[0]);
+    });
+    runner.throughput("std::sort" + suffix, n, [&] {
+        std::copy(input.begin(), input.end(), data.begin());
+        std::sort(data.begin(), data.end());
+        fakeRead(data[0]);
+    });
+}
+
+int main(int argc, char **argv)  //{{{1
+{
+    Benchmark::Runner runner(argc, argv);
+    benchmarkSorted<float_v>(runner);
+    benchmarkSorted<double_v>(runner);
+    benchmarkSorted<int_v>(runner);
+    benchmarkSorted<short_v>(runner);
+    benchmarkSorted<SimdArray<float, 32>>(runner);
+    for (std::size_t n : {std::size_t(1) << 10, std::size_t(1) << 16, std::size_t(1) << 20}) {
+        benchmarkSimdSort<float>(runner, n);
+        benchmarkSimdSort<double>(runner, n);
+        benchmarkSimdSort<int>(runner, n);
+    }
+    return runner.finish();
+}
+
+// vim: foldmethod=marker
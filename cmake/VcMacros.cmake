@@ -370,6 +370,8 @@ int main() { return 0; }
          set(_use_var "USE_${Vc_IMPL}")
          if(Vc_IMPL STREQUAL "SSE")
             set(_use_var "USE_SSE2")
+         elseif(Vc_IMPL STREQUAL "AVX512")
+            set(_use_var "USE_AVX512VL")
          endif()
          if(NOT ${_use_var})
             message(WARNING "The selected value for Vc_IMPL (${Vc_IMPL}) will not work because the relevant instructions are not enabled via compiler flags.")
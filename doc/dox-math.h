@@ -94,14 +94,144 @@ VECTOR_TYPE log2(const VECTOR_TYPE &v);
  */
 VECTOR_TYPE log10(const VECTOR_TYPE &v);
 
+/**
+ * \ingroup Math
+ *
+ * \param v The values to apply the logarithm on.
+ * \returns the natural logarithm of 1 + \p v, accurate also for \p v close to 0.
+ *
+ * \note The single-precision implementation has an error of max. 1.2 ulp (mean 0.08 ulp) in the range ]-1, 10].
+ * \note The double-precision implementation has an error of max. 1.3 ulp (mean 0.10 ulp) in the range ]-1, 10].
+ */
+VECTOR_TYPE log1p(const VECTOR_TYPE &v);
+
 /**
  * \ingroup Math
  *
  * \param v The values to apply the exponential function on.
  * \returns the exponential of \p v.
+ *
+ * \note The single-precision implementation has an error of max. 1 ulp (mean 0.27 ulp) in the range [-87, 88].
+ * \note The double-precision implementation has an error of max. 1.7 ulp (mean 0.29 ulp) in the range [-708, 708].
+ * \see Vc::fast::exp for a faster variant with a restricted domain.
  */
 VECTOR_TYPE exp(const VECTOR_TYPE &v);
 
+/**
+ * \ingroup Math
+ *
+ * \param v The values to apply the exponential function on.
+ * \returns 2 raised to the power of \p v.
+ *
+ * \note The single-precision implementation has an error of max. 1 ulp (mean 0.06 ulp) in the range [-120, 120].
+ * \note The double-precision implementation has an error of max. 1.1 ulp (mean 0.06 ulp) in the range [-120, 120].
+ */
+VECTOR_TYPE exp2(const VECTOR_TYPE &v);
+
+/**
+ * \ingroup Math
+ *
+ * \param v The values to apply the exponential function on.
+ * \returns \f$e^v - 1\f$, accurate also for \p v close to 0.
+ *
+ * \note The single-precision implementation has an error of max. 1.5 ulp (mean 0.07 ulp) in the range [-60, 80].
+ * \note The double-precision implementation has an error of max. 2 ulp (mean 0.09 ulp) in the range [-60, 80].
+ */
+VECTOR_TYPE expm1(const VECTOR_TYPE &v);
+
+/**
+ * \ingroup Math
+ *
+ * \param x The base.
+ * \param y The exponent.
+ * \returns \p x raised to the power of \p y, with the special cases of std::pow (C99 Annex F).
+ *
+ * \note The single-precision implementation is evaluated in double precision and has an error of max. 1 ulp (mean < 0.001 ulp) for \p x in ]0, 30] and \p y in [-30, 30].
+ * \note The double-precision implementation uses a double-double logarithm and has an error of max. 1.1 ulp (mean 0.06 ulp) for \p x in ]0, 30] and \p y in [-30, 30].
+ */
+VECTOR_TYPE pow(const VECTOR_TYPE &x, const VECTOR_TYPE &y);
+
+/**
+ * \ingroup Math
+ *
+ * \param v The values to apply the error function on.
+ * \returns the error function \f$\mathrm{erf}(v) = \frac{2}{\sqrt\pi}\int_0^v e^{-t^2}dt\f$.
+ *
+ * \note All implementations, including Scalar, use the same algorithm and do not call
+ * the C library.
+ * \note The single-precision implementation is evaluated in double precision and has an error of max. 0.5 ulp (mean 0.17 ulp) in the range [-6, 6].
+ * \note The double-precision implementation has an error of max. 1.8 ulp (mean 0.28 ulp) in the range [-6, 6].
+ */
+VECTOR_TYPE erf(const VECTOR_TYPE &v);
+
+/**
+ * \ingroup Math
+ *
+ * \param v The values to apply the complementary error function on.
+ * \returns \f$1 - \mathrm{erf}(v)\f$, accurate also where the result is small. Results
+ * smaller than the smallest normalized number are flushed to zero.
+ *
+ * \note All implementations, including Scalar, use the same algorithm and do not call
+ * the C library.
+ * \note The single-precision implementation is evaluated in double precision and has an error of max. 0.5 ulp (mean 0.22 ulp) in the range [-6, 9].
+ * \note The double-precision implementation has an error of max. 6.1 ulp (mean 0.66 ulp) in the range [-6, 26.5].
+ */
+VECTOR_TYPE erfc(const VECTOR_TYPE &v);
+
+/**
+ * \ingroup Math
+ *
+ * \param v The values to apply the standard normal cumulative distribution function on.
+ * \returns \f$\Phi(v) = \frac12\mathrm{erfc}(-v/\sqrt2)\f$, accurate also in the lower
+ * tail. Results smaller than the smallest normalized number are flushed to zero.
+ *
+ * \note This function is not part of the C++ standard library and thus not available in
+ * namespace std. The Scalar implementation uses the same algorithm as the SIMD ones.
+ * \note The single-precision implementation is evaluated in double precision and has an error of max. 0.5 ulp (mean 0.21 ulp) in the range [-13, 9].
+ * \note The double-precision implementation has an error of max. 5.9 ulp (mean 0.71 ulp) in the range [-37.5, 9].
+ */
+VECTOR_TYPE normcdf(const VECTOR_TYPE &v);
+
+/**
+ * \ingroup Math
+ *
+ * \param p The probabilities to apply the inverse of normcdf on.
+ * \returns \f$\Phi^{-1}(p)\f$, i.e. the \p p-quantile of the standard normal
+ * distribution. Returns \f$-\infty\f$ for \p p = 0, \f$+\infty\f$ for \p p = 1, and NaN
+ * for \p p outside [0, 1].
+ *
+ * \note This function is not part of the C++ standard library and thus not available in
+ * namespace std. The Scalar implementation uses the same algorithm as the SIMD ones.
+ * \note The single-precision implementation is evaluated in double precision and has an error of max. 0.5 ulp (mean 0.25 ulp) in the range ]0, 1[.
+ * \note The double-precision implementation has an error of max. 3.7 ulp (mean 0.58 ulp) in the range ]0, 1[ and of max. 2.9 ulp (mean 0.28 ulp) for \p p in [2⁻¹⁰⁷⁴, 1].
+ */
+VECTOR_TYPE normcdfinv(const VECTOR_TYPE &p);
+
+/**
+ * \ingroup Math
+ *
+ * \param v The values to apply the log-gamma function on.
+ * \returns the natural logarithm of the absolute value of the gamma function of \p v.
+ * Returns \f$+\infty\f$ for the poles at non-positive integers.
+ *
+ * \note All implementations, including Scalar, use the same algorithm and do not call
+ * the C library.
+ * \note The single-precision implementation is evaluated in double precision and has an error of max. 0.5 ulp (mean 0.25 ulp) in the range ]0, 30].
+ * \note The double-precision implementation has an error of max. 4.5 ulp (mean 0.45 ulp) in the range ]0, 30] and of max. 1.8 ulp (mean 0.34 ulp) in the range [8, 10⁶]. For negative \p v the absolute error is below \f$11\varepsilon\max(1, |\mathrm{lgamma}(v)|)\f$, thus the relative error grows close to the zeros of lgamma.
+ */
+VECTOR_TYPE lgamma(const VECTOR_TYPE &v);
+
+/**
+ * \ingroup Math
+ *
+ * \param v The values to take the cube root of.
+ * \returns the real cube root of \p v (negative for negative \p v).
+ *
+ * \note The single-precision implementation has an error of max. 1 ulp (mean 0.07 ulp) in the range [-10⁶, 10⁶].
+ * \note The double-precision implementation has an error of max. 1 ulp (mean 0.06 ulp) in the range [-10⁶, 10⁶].
+ */
+VECTOR_TYPE cbrt(const VECTOR_TYPE &v);
+
 /**
  * \ingroup Math
  *
@@ -299,6 +299,7 @@ One or more of the following macros will be defined:
 \li \ref Vc_IMPL_SSE4_2
 \li \ref Vc_IMPL_AVX
 \li \ref Vc_IMPL_AVX2
+\li \ref Vc_IMPL_AVX512
 
 You can use these macros to enable target-specific implementations.
 In general, it is better to rely on function overloading or template mechanisms, though.
@@ -339,7 +340,14 @@ You can define the following macros to enable/disable specific features:
 \section set_vc_impl Vc_IMPL
 
 If you want to force compilation against a specific implementation of the vector classes you can set the macro Vc_IMPL to either
-\c Scalar, \c SSE, \c SSE2, \c SSE3, \c SSSE3, \c SSE4_1, \c SSE4_2, \c AVX, \c AVX2, or \c MIC.
+\c Scalar, \c SSE, \c SSE2, \c SSE3, \c SSSE3, \c SSE4_1, \c SSE4_2, \c AVX, \c AVX2, \c AVX512, or \c MIC.
+\c AVX512 keeps the 256-bit AVX2 types as the default Vc::float_v etc., and uses AVX512F/VL/BW/DQ
+instructions for their write-masked stores and scatters.
+The full-width 512-bit types (16 \c float, \c int, or \c uint entries; 8 \c double entries) with
+k-register masks are available as Vc::AVX512::float_v, Vc::AVX512::double_v, Vc::AVX512::int_v, and
+Vc::AVX512::uint_v.
+They support the complete Vector and Mask interface, but not yet SimdArray, simdize, or the
+transcendental functions of the math library.
 Additionally, you may (should) append \c +XOP, \c +FMA4, \c +FMA, \c +SSE4a, \c +F16C, \c +BMI2, and/or \c +POPCNT.
 For example, `-D Vc_IMPL=SSE+XOP+FMA4` tells the Vc library to use the best SSE instructions available for the target (according to the information provided by the compiler) and additionally use XOP and FMA4 instructions (this might be a good choice for some AMD processors, which support AVX but may perform slightly better if only SSE widths are used).
 Setting \c Vc_IMPL to \c SSE forces the SSE instruction set, but lets the headers figure out the exact SSE revision to use, or, if that fails, uses SSE4.1.
@@ -664,6 +672,13 @@ namespace Vc
  * This macro is defined if the current translation unit is compiled with AVX2 instruction support.
  */
 #define Vc_IMPL_AVX2
+/**
+ * This macro is defined if the current translation unit is compiled with AVX512F, AVX512VL,
+ * AVX512BW, and AVX512DQ instruction support. Vc_IMPL_AVX2 is defined as well.
+ * The 512-bit vector types in the Vc::AVX512 namespace are only declared if this macro is
+ * defined.
+ */
+#define Vc_IMPL_AVX512
 //@}
 //@}
 
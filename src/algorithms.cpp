@@ -0,0 +1,56 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include <Vc/global.h>
+#include <cstddef>
+#include <limits>
+#ifdef Vc_IMPL_SSE
+#include <Vc/cpuid.h>
+#endif
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+std::size_t &streaming_store_threshold_storage()
+{
+    static std::size_t threshold = [] {
+#ifdef Vc_IMPL_SSE
+        // writing more than half of the last level cache evicts most of the working set
+        const std::size_t cache = CpuId::L3Data() ? CpuId::L3Data() : CpuId::L2Data();
+        return cache ? cache / 2 : std::size_t(4 * 1024 * 1024);
+#else
+        // the scalar and ARM implementations have no non-temporal stores
+        return std::numeric_limits<std::size_t>::max();
+#endif
+    }();
+    return threshold;
+}
+}  // namespace Detail
+}  // namespace Vc
+
+// vim: foldmethod=marker
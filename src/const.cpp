@@ -486,5 +486,142 @@ namespace SSE
         //floatConstant< 1, 0x001a209a, -2>(), // log10(2)
         //floatConstant< 1, 0x001a209a, -2>(), // log10(2)
     };
+
+    // Indexed by a lane bitmask. Byte i of compress[m] is the lane that moves to position i
+    // when the lanes set in m are packed to the front; byte i of expand[m] is the packed
+    // element lane i receives when the packing is reversed.
+    alignas(64) const unsigned long long c_compress::compress[256] = {
+        0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000001ull, 0x0000000000000100ull,
+        0x0000000000000002ull, 0x0000000000000200ull, 0x0000000000000201ull, 0x0000000000020100ull,
+        0x0000000000000003ull, 0x0000000000000300ull, 0x0000000000000301ull, 0x0000000000030100ull,
+        0x0000000000000302ull, 0x0000000000030200ull, 0x0000000000030201ull, 0x0000000003020100ull,
+        0x0000000000000004ull, 0x0000000000000400ull, 0x0000000000000401ull, 0x0000000000040100ull,
+        0x0000000000000402ull, 0x0000000000040200ull, 0x0000000000040201ull, 0x0000000004020100ull,
+        0x0000000000000403ull, 0x0000000000040300ull, 0x0000000000040301ull, 0x0000000004030100ull,
+        0x0000000000040302ull, 0x0000000004030200ull, 0x0000000004030201ull, 0x0000000403020100ull,
+        0x0000000000000005ull, 0x0000000000000500ull, 0x0000000000000501ull, 0x0000000000050100ull,
+        0x0000000000000502ull, 0x0000000000050200ull, 0x0000000000050201ull, 0x0000000005020100ull,
+        0x0000000000000503ull, 0x0000000000050300ull, 0x0000000000050301ull, 0x0000000005030100ull,
+        0x0000000000050302ull, 0x0000000005030200ull, 0x0000000005030201ull, 0x0000000503020100ull,
+        0x0000000000000504ull, 0x0000000000050400ull, 0x0000000000050401ull, 0x0000000005040100ull,
+        0x0000000000050402ull, 0x0000000005040200ull, 0x0000000005040201ull, 0x0000000504020100ull,
+        0x0000000000050403ull, 0x0000000005040300ull, 0x0000000005040301ull, 0x0000000504030100ull,
+        0x0000000005040302ull, 0x0000000504030200ull, 0x0000000504030201ull, 0x0000050403020100ull,
+        0x0000000000000006ull, 0x0000000000000600ull, 0x0000000000000601ull, 0x0000000000060100ull,
+        0x0000000000000602ull, 0x0000000000060200ull, 0x0000000000060201ull, 0x0000000006020100ull,
+        0x0000000000000603ull, 0x0000000000060300ull, 0x0000000000060301ull, 0x0000000006030100ull,
+        0x0000000000060302ull, 0x0000000006030200ull, 0x0000000006030201ull, 0x0000000603020100ull,
+        0x0000000000000604ull, 0x0000000000060400ull, 0x0000000000060401ull, 0x0000000006040100ull,
+        0x0000000000060402ull, 0x0000000006040200ull, 0x0000000006040201ull, 0x0000000604020100ull,
+        0x0000000000060403ull, 0x0000000006040300ull, 0x0000000006040301ull, 0x0000000604030100ull,
+        0x0000000006040302ull, 0x0000000604030200ull, 0x0000000604030201ull, 0x0000060403020100ull,
+        0x0000000000000605ull, 0x0000000000060500ull, 0x0000000000060501ull, 0x0000000006050100ull,
+        0x0000000000060502ull, 0x0000000006050200ull, 0x0000000006050201ull, 0x0000000605020100ull,
+        0x0000000000060503ull, 0x0000000006050300ull, 0x0000000006050301ull, 0x0000000605030100ull,
+        0x0000000006050302ull, 0x0000000605030200ull, 0x0000000605030201ull, 0x0000060503020100ull,
+        0x0000000000060504ull, 0x0000000006050400ull, 0x0000000006050401ull, 0x0000000605040100ull,
+        0x0000000006050402ull, 0x0000000605040200ull, 0x0000000605040201ull, 0x0000060504020100ull,
+        0x0000000006050403ull, 0x0000000605040300ull, 0x0000000605040301ull, 0x0000060504030100ull,
+        0x0000000605040302ull, 0x0000060504030200ull, 0x0000060504030201ull, 0x0006050403020100ull,
+        0x0000000000000007ull, 0x0000000000000700ull, 0x0000000000000701ull, 0x0000000000070100ull,
+        0x0000000000000702ull, 0x0000000000070200ull, 0x0000000000070201ull, 0x0000000007020100ull,
+        0x0000000000000703ull, 0x0000000000070300ull, 0x0000000000070301ull, 0x0000000007030100ull,
+        0x0000000000070302ull, 0x0000000007030200ull, 0x0000000007030201ull, 0x0000000703020100ull,
+        0x0000000000000704ull, 0x0000000000070400ull, 0x0000000000070401ull, 0x0000000007040100ull,
+        0x0000000000070402ull, 0x0000000007040200ull, 0x0000000007040201ull, 0x0000000704020100ull,
+        0x0000000000070403ull, 0x0000000007040300ull, 0x0000000007040301ull, 0x0000000704030100ull,
+        0x0000000007040302ull, 0x0000000704030200ull, 0x0000000704030201ull, 0x0000070403020100ull,
+        0x0000000000000705ull, 0x0000000000070500ull, 0x0000000000070501ull, 0x0000000007050100ull,
+        0x0000000000070502ull, 0x0000000007050200ull, 0x0000000007050201ull, 0x0000000705020100ull,
+        0x0000000000070503ull, 0x0000000007050300ull, 0x0000000007050301ull, 0x0000000705030100ull,
+        0x0000000007050302ull, 0x0000000705030200ull, 0x0000000705030201ull, 0x0000070503020100ull,
+        0x0000000000070504ull, 0x0000000007050400ull, 0x0000000007050401ull, 0x0000000705040100ull,
+        0x0000000007050402ull, 0x0000000705040200ull, 0x0000000705040201ull, 0x0000070504020100ull,
+        0x0000000007050403ull, 0x0000000705040300ull, 0x0000000705040301ull, 0x0000070504030100ull,
+        0x0000000705040302ull, 0x0000070504030200ull, 0x0000070504030201ull, 0x0007050403020100ull,
+        0x0000000000000706ull, 0x0000000000070600ull, 0x0000000000070601ull, 0x0000000007060100ull,
+        0x0000000000070602ull, 0x0000000007060200ull, 0x0000000007060201ull, 0x0000000706020100ull,
+        0x0000000000070603ull, 0x0000000007060300ull, 0x0000000007060301ull, 0x0000000706030100ull,
+        0x0000000007060302ull, 0x0000000706030200ull, 0x0000000706030201ull, 0x0000070603020100ull,
+        0x0000000000070604ull, 0x0000000007060400ull, 0x0000000007060401ull, 0x0000000706040100ull,
+        0x0000000007060402ull, 0x0000000706040200ull, 0x0000000706040201ull, 0x0000070604020100ull,
+        0x0000000007060403ull, 0x0000000706040300ull, 0x0000000706040301ull, 0x0000070604030100ull,
+        0x0000000706040302ull, 0x0000070604030200ull, 0x0000070604030201ull, 0x0007060403020100ull,
+        0x0000000000070605ull, 0x0000000007060500ull, 0x0000000007060501ull, 0x0000000706050100ull,
+        0x0000000007060502ull, 0x0000000706050200ull, 0x0000000706050201ull, 0x0000070605020100ull,
+        0x0000000007060503ull, 0x0000000706050300ull, 0x0000000706050301ull, 0x0000070605030100ull,
+        0x0000000706050302ull, 0x0000070605030200ull, 0x0000070605030201ull, 0x0007060503020100ull,
+        0x0000000007060504ull, 0x0000000706050400ull, 0x0000000706050401ull, 0x0000070605040100ull,
+        0x0000000706050402ull, 0x0000070605040200ull, 0x0000070605040201ull, 0x0007060504020100ull,
+        0x0000000706050403ull, 0x0000070605040300ull, 0x0000070605040301ull, 0x0007060504030100ull,
+        0x0000070605040302ull, 0x0007060504030200ull, 0x0007060504030201ull, 0x0706050403020100ull,
+    };
+
+    alignas(64) const unsigned long long c_compress::expand[256] = {
+        0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000100ull,
+        0x0000000000000000ull, 0x0000000000010000ull, 0x0000000000010000ull, 0x0000000000020100ull,
+        0x0000000000000000ull, 0x0000000001000000ull, 0x0000000001000000ull, 0x0000000002000100ull,
+        0x0000000001000000ull, 0x0000000002010000ull, 0x0000000002010000ull, 0x0000000003020100ull,
+        0x0000000000000000ull, 0x0000000100000000ull, 0x0000000100000000ull, 0x0000000200000100ull,
+        0x0000000100000000ull, 0x0000000200010000ull, 0x0000000200010000ull, 0x0000000300020100ull,
+        0x0000000100000000ull, 0x0000000201000000ull, 0x0000000201000000ull, 0x0000000302000100ull,
+        0x0000000201000000ull, 0x0000000302010000ull, 0x0000000302010000ull, 0x0000000403020100ull,
+        0x0000000000000000ull, 0x0000010000000000ull, 0x0000010000000000ull, 0x0000020000000100ull,
+        0x0000010000000000ull, 0x0000020000010000ull, 0x0000020000010000ull, 0x0000030000020100ull,
+        0x0000010000000000ull, 0x0000020001000000ull, 0x0000020001000000ull, 0x0000030002000100ull,
+        0x0000020001000000ull, 0x0000030002010000ull, 0x0000030002010000ull, 0x0000040003020100ull,
+        0x0000010000000000ull, 0x0000020100000000ull, 0x0000020100000000ull, 0x0000030200000100ull,
+        0x0000020100000000ull, 0x0000030200010000ull, 0x0000030200010000ull, 0x0000040300020100ull,
+        0x0000020100000000ull, 0x0000030201000000ull, 0x0000030201000000ull, 0x0000040302000100ull,
+        0x0000030201000000ull, 0x0000040302010000ull, 0x0000040302010000ull, 0x0000050403020100ull,
+        0x0000000000000000ull, 0x0001000000000000ull, 0x0001000000000000ull, 0x0002000000000100ull,
+        0x0001000000000000ull, 0x0002000000010000ull, 0x0002000000010000ull, 0x0003000000020100ull,
+        0x0001000000000000ull, 0x0002000001000000ull, 0x0002000001000000ull, 0x0003000002000100ull,
+        0x0002000001000000ull, 0x0003000002010000ull, 0x0003000002010000ull, 0x0004000003020100ull,
+        0x0001000000000000ull, 0x0002000100000000ull, 0x0002000100000000ull, 0x0003000200000100ull,
+        0x0002000100000000ull, 0x0003000200010000ull, 0x0003000200010000ull, 0x0004000300020100ull,
+        0x0002000100000000ull, 0x0003000201000000ull, 0x0003000201000000ull, 0x0004000302000100ull,
+        0x0003000201000000ull, 0x0004000302010000ull, 0x0004000302010000ull, 0x0005000403020100ull,
+        0x0001000000000000ull, 0x0002010000000000ull, 0x0002010000000000ull, 0x0003020000000100ull,
+        0x0002010000000000ull, 0x0003020000010000ull, 0x0003020000010000ull, 0x0004030000020100ull,
+        0x0002010000000000ull, 0x0003020001000000ull, 0x0003020001000000ull, 0x0004030002000100ull,
+        0x0003020001000000ull, 0x0004030002010000ull, 0x0004030002010000ull, 0x0005040003020100ull,
+        0x0002010000000000ull, 0x0003020100000000ull, 0x0003020100000000ull, 0x0004030200000100ull,
+        0x0003020100000000ull, 0x0004030200010000ull, 0x0004030200010000ull, 0x0005040300020100ull,
+        0x0003020100000000ull, 0x0004030201000000ull, 0x0004030201000000ull, 0x0005040302000100ull,
+        0x0004030201000000ull, 0x0005040302010000ull, 0x0005040302010000ull, 0x0006050403020100ull,
+        0x0000000000000000ull, 0x0100000000000000ull, 0x0100000000000000ull, 0x0200000000000100ull,
+        0x0100000000000000ull, 0x0200000000010000ull, 0x0200000000010000ull, 0x0300000000020100ull,
+        0x0100000000000000ull, 0x0200000001000000ull, 0x0200000001000000ull, 0x0300000002000100ull,
+        0x0200000001000000ull, 0x0300000002010000ull, 0x0300000002010000ull, 0x0400000003020100ull,
+        0x0100000000000000ull, 0x0200000100000000ull, 0x0200000100000000ull, 0x0300000200000100ull,
+        0x0200000100000000ull, 0x0300000200010000ull, 0x0300000200010000ull, 0x0400000300020100ull,
+        0x0200000100000000ull, 0x0300000201000000ull, 0x0300000201000000ull, 0x0400000302000100ull,
+        0x0300000201000000ull, 0x0400000302010000ull, 0x0400000302010000ull, 0x0500000403020100ull,
+        0x0100000000000000ull, 0x0200010000000000ull, 0x0200010000000000ull, 0x0300020000000100ull,
+        0x0200010000000000ull, 0x0300020000010000ull, 0x0300020000010000ull, 0x0400030000020100ull,
+        0x0200010000000000ull, 0x0300020001000000ull, 0x0300020001000000ull, 0x0400030002000100ull,
+        0x0300020001000000ull, 0x0400030002010000ull, 0x0400030002010000ull, 0x0500040003020100ull,
+        0x0200010000000000ull, 0x0300020100000000ull, 0x0300020100000000ull, 0x0400030200000100ull,
+        0x0300020100000000ull, 0x0400030200010000ull, 0x0400030200010000ull, 0x0500040300020100ull,
+        0x0300020100000000ull, 0x0400030201000000ull, 0x0400030201000000ull, 0x0500040302000100ull,
+        0x0400030201000000ull, 0x0500040302010000ull, 0x0500040302010000ull, 0x0600050403020100ull,
+        0x0100000000000000ull, 0x0201000000000000ull, 0x0201000000000000ull, 0x0302000000000100ull,
+        0x0201000000000000ull, 0x0302000000010000ull, 0x0302000000010000ull, 0x0403000000020100ull,
+        0x0201000000000000ull, 0x0302000001000000ull, 0x0302000001000000ull, 0x0403000002000100ull,
+        0x0302000001000000ull, 0x0403000002010000ull, 0x0403000002010000ull, 0x0504000003020100ull,
+        0x0201000000000000ull, 0x0302000100000000ull, 0x0302000100000000ull, 0x0403000200000100ull,
+        0x0302000100000000ull, 0x0403000200010000ull, 0x0403000200010000ull, 0x0504000300020100ull,
+        0x0302000100000000ull, 0x0403000201000000ull, 0x0403000201000000ull, 0x0504000302000100ull,
+        0x0403000201000000ull, 0x0504000302010000ull, 0x0504000302010000ull, 0x0605000403020100ull,
+        0x0201000000000000ull, 0x0302010000000000ull, 0x0302010000000000ull, 0x0403020000000100ull,
+        0x0302010000000000ull, 0x0403020000010000ull, 0x0403020000010000ull, 0x0504030000020100ull,
+        0x0302010000000000ull, 0x0403020001000000ull, 0x0403020001000000ull, 0x0504030002000100ull,
+        0x0403020001000000ull, 0x0504030002010000ull, 0x0504030002010000ull, 0x0605040003020100ull,
+        0x0302010000000000ull, 0x0403020100000000ull, 0x0403020100000000ull, 0x0504030200000100ull,
+        0x0403020100000000ull, 0x0504030200010000ull, 0x0504030200010000ull, 0x0605040300020100ull,
+        0x0403020100000000ull, 0x0504030201000000ull, 0x0504030201000000ull, 0x0605040302000100ull,
+        0x0504030201000000ull, 0x0605040302010000ull, 0x0605040302010000ull, 0x0706050403020100ull,
+    };
 }
 }
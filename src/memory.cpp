@@ -0,0 +1,58 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include <Vc/Memory>
+#include <algorithm>
+#ifdef Vc_IMPL_SSE
+#include <Vc/cpuid.h>
+#endif
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+// Defined in the library, so that all translation units share the distances regardless
+// of the implementation they are compiled for.
+MemoryPrefetch MemoryPrefetch::tuned()
+{
+    static const MemoryPrefetch distance = [] {
+#ifdef Vc_IMPL_SSE
+        const size_t stride = CpuId::prefetch() ? CpuId::prefetch() : 64;
+        const size_t l1 = CpuId::L1Data() ? CpuId::L1Data() : 32 * 1024;
+        const size_t l2 = CpuId::L2Data() ? CpuId::L2Data() : 256 * 1024;
+        return MemoryPrefetch(std::min(4 * stride, l1 / 16),
+                              std::min(64 * stride, l2 / 64));
+#else
+        return MemoryPrefetch(4 * 64, 64 * 64);
+#endif
+    }();
+    return distance;
+}
+}  // namespace Common
+}  // namespace Vc
+
+// vim: foldmethod=marker
@@ -0,0 +1,129 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include <Vc/global.h>
+#include <Vc/vector.h>
+#include <Vc/common/numa.h>
+
+#ifdef __linux__
+#include <dirent.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#endif
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace
+{
+#if defined __linux__ && defined SYS_mbind
+// from <numaif.h>, which is only available with libnuma
+constexpr int MPOL_BIND_ = 2;
+constexpr int MPOL_INTERLEAVE_ = 3;
+constexpr unsigned MPOL_MF_MOVE_ = 1u << 1;
+
+constexpr std::size_t BitsPerWord = 8 * sizeof(unsigned long);
+
+// Applies the memory policy \p mode with the given node mask to the whole pages inside
+// [ptr, ptr + bytes).
+bool mbindPages(void *ptr, std::size_t bytes, int mode,
+                const std::vector<unsigned long> &nodemask)
+{
+    const std::uintptr_t page = Common::pageSize();
+    const std::uintptr_t first =
+        (reinterpret_cast<std::uintptr_t>(ptr) + page - 1) & ~(page - 1);
+    const std::uintptr_t last =
+        (reinterpret_cast<std::uintptr_t>(ptr) + bytes) & ~(page - 1);
+    if (ptr == nullptr || last <= first) {
+        return false;
+    }
+    // the kernel expects the number of bits in the mask plus one
+    return 0 == syscall(SYS_mbind, first, last - first, mode, nodemask.data(),
+                        nodemask.size() * BitsPerWord + 1, MPOL_MF_MOVE_);
+}
+#endif
+}  // unnamed namespace
+
+std::size_t numa_node_count()
+{
+#ifdef __linux__
+    static const std::size_t count = [] {
+        std::size_t n = 0;
+        if (DIR *dir = opendir("/sys/devices/system/node")) {
+            while (const dirent *entry = readdir(dir)) {
+                if (0 == std::strncmp(entry->d_name, "node", 4) &&
+                    entry->d_name[4] >= '0' && entry->d_name[4] <= '9') {
+                    n = std::max<std::size_t>(n, std::atoi(entry->d_name + 4) + 1);
+                }
+            }
+            closedir(dir);
+        }
+        return n > 0 ? n : std::size_t(1);
+    }();
+    return count;
+#else
+    return 1;
+#endif
+}
+
+bool numa_bind(void *ptr, std::size_t bytes, int node)
+{
+#if defined __linux__ && defined SYS_mbind
+    if (node < 0) {
+        return false;
+    }
+    std::vector<unsigned long> nodemask(node / BitsPerWord + 1);
+    nodemask[node / BitsPerWord] = 1ul << (node % BitsPerWord);
+    return mbindPages(ptr, bytes, MPOL_BIND_, nodemask);
+#else
+    (void)ptr;
+    (void)bytes;
+    (void)node;
+    return false;
+#endif
+}
+
+bool numa_interleave(void *ptr, std::size_t bytes)
+{
+#if defined __linux__ && defined SYS_mbind
+    const std::size_t nodes = numa_node_count();
+    std::vector<unsigned long> nodemask((nodes + BitsPerWord - 1) / BitsPerWord);
+    for (std::size_t i = 0; i < nodes; ++i) {
+        nodemask[i / BitsPerWord] |= 1ul << (i % BitsPerWord);
+    }
+    return mbindPages(ptr, bytes, MPOL_INTERLEAVE_, nodemask);
+#else
+    (void)ptr;
+    (void)bytes;
+    return false;
+#endif
+}
+}  // namespace Vc
+
+// vim: foldmethod=marker
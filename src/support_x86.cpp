@@ -80,6 +80,10 @@ bool isImplementationSupported(Implementation impl)
         return CpuId::hasOsxsave() && CpuId::hasAvx() && xgetbvCheck(0x6);
     case AVX2Impl:
         return CpuId::hasOsxsave() && CpuId::hasAvx2() && xgetbvCheck(0x6);
+    case AVX512Impl:
+        return CpuId::hasOsxsave() && CpuId::hasAvx2() && CpuId::hasAvx512f() &&
+               CpuId::hasAvx512vl() && CpuId::hasAvx512bw() && CpuId::hasAvx512dq() &&
+               xgetbvCheck(0xe6);
     case MICImpl:
         return CpuId::processorFamily() == 0xB && CpuId::processorModel() == 0x1
             && CpuId::isIntel();
@@ -105,6 +109,10 @@ Vc::Implementation bestImplementationSupported()
     if (!CpuId::hasSse42()) return Vc::SSE41Impl;
     if (CpuId::hasAvx() && CpuId::hasOsxsave() && xgetbvCheck(0x6)) {
         if (!CpuId::hasAvx2()) return Vc::AVXImpl;
+        if (CpuId::hasAvx512f() && CpuId::hasAvx512vl() && CpuId::hasAvx512bw() &&
+            CpuId::hasAvx512dq() && xgetbvCheck(0xe6)) {
+            return Vc::AVX512Impl;
+        }
         return Vc::AVX2Impl;
     }
     return Vc::SSE42Impl;
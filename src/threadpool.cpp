@@ -0,0 +1,170 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include <Vc/global.h>
+#include <Vc/common/threadpool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+namespace
+{
+// set while the current thread executes work of the pool; nested calls run serially
+thread_local bool t_insidePool = false;
+
+class ThreadPool
+{
+public:
+    static ThreadPool &instance()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    std::size_t concurrency() const { return m_workers.size() + 1; }
+
+    void run(std::size_t n, void (*fn)(void *, std::size_t), void *ctx)
+    {
+        if (n <= 1 || m_workers.empty() || t_insidePool || !m_submit.try_lock()) {
+            for (std::size_t i = 0; i < n; ++i) {
+                fn(ctx, i);
+            }
+            return;
+        }
+        std::lock_guard<std::mutex> submitLock(m_submit, std::adopt_lock);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_fn = fn;
+            m_ctx = ctx;
+            m_size = n;
+            m_next.store(0, std::memory_order_relaxed);
+            m_active = m_workers.size();
+            m_error = nullptr;
+            ++m_generation;
+        }
+        m_wakeup.notify_all();
+        execute();
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [this] { return m_active == 0; });
+        if (m_error) {
+            std::rethrow_exception(m_error);
+        }
+    }
+
+private:
+    ThreadPool()
+    {
+        const unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+        m_workers.reserve(hw - 1);
+        for (unsigned i = 1; i < hw; ++i) {
+            m_workers.emplace_back([this] { workerLoop(); });
+        }
+    }
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_wakeup.notify_all();
+        for (auto &t : m_workers) {
+            t.join();
+        }
+    }
+
+    void workerLoop()
+    {
+        std::size_t seen = 0;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for (;;) {
+            m_wakeup.wait(lock, [&] { return m_stopping || m_generation != seen; });
+            if (m_stopping) {
+                return;
+            }
+            seen = m_generation;
+            lock.unlock();
+            execute();
+            lock.lock();
+            if (--m_active == 0) {
+                m_done.notify_one();
+            }
+        }
+    }
+
+    void execute()
+    {
+        t_insidePool = true;
+        for (std::size_t i = m_next.fetch_add(1, std::memory_order_relaxed); i < m_size;
+             i = m_next.fetch_add(1, std::memory_order_relaxed)) {
+            try {
+                m_fn(m_ctx, i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (!m_error) {
+                    m_error = std::current_exception();
+                }
+            }
+        }
+        t_insidePool = false;
+    }
+
+    std::vector<std::thread> m_workers;
+    std::mutex m_submit;
+    std::mutex m_mutex;
+    std::condition_variable m_wakeup;
+    std::condition_variable m_done;
+    void (*m_fn)(void *, std::size_t) = nullptr;
+    void *m_ctx = nullptr;
+    std::size_t m_size = 0;
+    std::atomic<std::size_t> m_next{0};
+    std::size_t m_active = 0;
+    std::size_t m_generation = 0;
+    std::exception_ptr m_error;
+    bool m_stopping = false;
+};
+}  // unnamed namespace
+
+std::size_t parallel_concurrency() { return ThreadPool::instance().concurrency(); }
+
+void parallel_for_impl(std::size_t n, void (*fn)(void *, std::size_t), void *ctx)
+{
+    ThreadPool::instance().run(n, fn, ctx);
+}
+}  // namespace Detail
+}  // namespace Vc
+
+// vim: foldmethod=marker
@@ -255,6 +255,115 @@ static Vc_ALWAYS_INLINE folded<double, Abi> foldInput(const Vector<double, Abi>
     return r;
 }
 
+/**\internal
+ * tan(x) via the sine and cosine series of the folded input:
+ * quadrant 0 and 2: tan(x) =  sin(r) / cos(r)
+ * quadrant 1 and 3: tan(x) = -cos(r) / sin(r)
+ */
+template <typename V> static Vc_ALWAYS_INLINE V tanImpl(const V &x)
+{
+    const auto f = foldInput(x);
+    const V sin_s = sinSeries(f.x);
+    const V cos_s = cosSeries(f.x);
+    const auto odd = f.quadrant == V(1) || f.quadrant == V(3);
+    V r = iif(odd, -cos_s, sin_s) / iif(odd, sin_s, cos_s);
+    r(isnegative(x)) = -r;
+    return r;
+}
+
+/**\internal
+ * The hyperbolic functions are calculated via expm1, exp, log1p, and log. Above the
+ * returned threshold (just below the overflow of exp), ½eˣ is calculated as ½e^(x/2) *
+ * e^(x/2), because sinh and cosh overflow only at x ≈ ln(2 * max).
+ */
+template <typename V> static Vc_ALWAYS_INLINE V expOverflowThreshold()
+{
+    using T = typename V::EntryType;
+    return T(std::numeric_limits<T>::max_exponent - 3) * T(0.693147180559945309417232121458176568);
+}
+
+template <typename V> static Vc_ALWAYS_INLINE V sinhImpl(const V &x)
+{
+    using T = typename V::EntryType;
+    const V a = abs(x);
+    // sinh(a) = ½(eᵃ - e⁻ᵃ) = ½(E + E / (E + 1)) with E = eᵃ - 1 does not cancel for small a
+    const V e = expm1(a);
+    V r = T(0.5) * (e + e / (e + V::One()));
+    const auto large = a > expOverflowThreshold<V>();
+    if (Vc_IS_UNLIKELY(any_of(large))) {
+        const V h = exp(T(0.5) * a);
+        r(large) = (T(0.5) * h) * h;
+    }
+    r(isnegative(x)) = -r;
+    return r;
+}
+
+template <typename V> static Vc_ALWAYS_INLINE V coshImpl(const V &x)
+{
+    using T = typename V::EntryType;
+    const V a = abs(x);
+    const V e = exp(a);
+    V r = T(0.5) * e + T(0.5) / e;
+    const auto large = a > expOverflowThreshold<V>();
+    if (Vc_IS_UNLIKELY(any_of(large))) {
+        const V h = exp(T(0.5) * a);
+        r(large) = (T(0.5) * h) * h;
+    }
+    return r;
+}
+
+template <typename V> static Vc_ALWAYS_INLINE V tanhImpl(const V &x)
+{
+    using T = typename V::EntryType;
+    const V a = abs(x);
+    // tanh(a) = (e²ᵃ - 1) / (e²ᵃ + 1) = E / (E + 2) with E = e²ᵃ - 1
+    const V e = expm1(a + a);
+    V r = e / (e + T(2));
+    // tanh(a) = 1 - 2e⁻²ᵃ rounds to 1 for a > ½ln(2) * (digits + 2)
+    r(a > T(0.34657359027997265471) * T(std::numeric_limits<T>::digits + 2)) = V::One();
+    r(isnegative(x)) = -r;
+    return r;
+}
+
+template <typename V> static Vc_ALWAYS_INLINE V asinhImpl(const V &x)
+{
+    using T = typename V::EntryType;
+    const V a = abs(x);
+    const V a2 = a * a;
+    // a < 2:  asinh(a) = ln(1 + a + a² / (1 + √(1 + a²)))
+    // a ≥ 2:  asinh(a) = ln(2a + 1 / (a + √(a² + 1)))
+    // a ≥ 1/ε: asinh(a) = ln(a) + ln(2)
+    V r = log1p(a + a2 / (V::One() + sqrt(V::One() + a2)));
+    const auto large = a >= T(2);
+    if (Vc_IS_UNLIKELY(any_of(large))) {
+        const auto huge = a >= T(1) / std::numeric_limits<T>::epsilon();
+        V y = a + a + V::One() / (a + sqrt(a2 + V::One()));
+        y(huge) = a;
+        V l = log(y);
+        l(huge) += T(0.693147180559945309417232121458176568);
+        r(large) = l;
+        r(isinf(a)) = a;
+    }
+    r(isnegative(x)) = -r;
+    r(isnan(x)) = x;  // log(NaN) is finite with SSE2
+    return r;
+}
+
+template <typename V> static Vc_ALWAYS_INLINE V atanhImpl(const V &x)
+{
+    using T = typename V::EntryType;
+    const V a = abs(x);
+    // atanh(a) = ½ln((1 + a) / (1 - a)) = ½ln(1 + 2a / (1 - a))
+    // For a < ½ the argument is rewritten as 2a + 2a² / (1 - a) to keep the relative
+    // error of the sum small.
+    const V t = a + a;
+    V y = t / (V::One() - a);
+    y(a < T(0.5)) = t + t * a / (V::One() - a);
+    V r = T(0.5) * log1p(y);
+    r(isnegative(x)) = -r;
+    return r;
+}
+
 constexpr double signmask = -0.;
 constexpr float signmaskf = -0.f;
 } // anonymous namespace
@@ -608,6 +717,86 @@ template<> template<> Vc::double_v Trigonometric<Vc::Detail::TrigonometricImplem
     return a;
 }
 
+template <>
+template <>
+Vc::double_v Trigonometric<Vc::Detail::TrigonometricImplementation<
+    Vc::CurrentImplementation::current()>>::tan(const Vc::double_v &x)
+{
+    return tanImpl(x);
+}
+
+template <>
+template <>
+Vc::float_v Trigonometric<Vc::Detail::TrigonometricImplementation<
+    Vc::CurrentImplementation::current()>>::tan(const Vc::float_v &x)
+{
+    // The quotient of the single-precision series and the amplification of the reduction
+    // error close to the poles would cost several ulp. Double precision yields a correctly
+    // rounded result in almost all cases.
+    return simd_cast<Vc::float_v>(tan(simd_cast<Vc::double_v, 0>(x)),
+                                  tan(simd_cast<Vc::double_v, 1>(x)));
+}
+
+/*
+ * algorithm for arccosine:
+ * |x| ≤ ½: acos(x) = π/2 - asin(x)
+ * |x| > ½: acos(x) = 2 asin(√((1 - |x|) / 2)), mirrored to π - acos(-x) for x < 0
+ * The second form avoids the cancellation of π/2 - asin(x) close to π/2.
+ */
+template <>
+template <>
+Vc::float_v Trigonometric<Vc::Detail::TrigonometricImplementation<
+    Vc::CurrentImplementation::current()>>::acos(const Vc::float_v &x)
+{
+    typedef Vc::float_v V;
+    typedef Const<float, V::abi> C;
+
+    const V a = abs(x);
+    const V s = asin(sqrt((V::One() - a) * C::_1_2()));
+    V r = s + s;
+    r(x < V::Zero()) = (C::_pi() - r) + (C::_pi_2_rem() + C::_pi_2_rem());
+    r(a <= C::_1_2()) = (C::_pi_2() - asin(x)) + C::_pi_2_rem();
+    return r;
+}
+
+template <>
+template <>
+Vc::double_v Trigonometric<Vc::Detail::TrigonometricImplementation<
+    Vc::CurrentImplementation::current()>>::acos(const Vc::double_v &x)
+{
+    typedef Vc::double_v V;
+    typedef Const<double, V::abi> C;
+
+    const V a = abs(x);
+    const V s = asin(sqrt((V::One() - a) * C::_1_2()));
+    V r = s + s;
+    r(x < V::Zero()) = (C::_pi() - r) + (C::_pi_2_rem() + C::_pi_2_rem());
+    r(a <= C::_1_2()) = (C::_pi_2() - asin(x)) + C::_pi_2_rem();
+    return r;
+}
+
+#define Vc_HYPERBOLIC_(name_)                                                            \
+    template <>                                                                          \
+    template <>                                                                          \
+    Vc::float_v Trigonometric<Vc::Detail::TrigonometricImplementation<                   \
+        Vc::CurrentImplementation::current()>>::name_(const Vc::float_v &x)              \
+    {                                                                                    \
+        return name_##Impl(x);                                                           \
+    }                                                                                    \
+    template <>                                                                          \
+    template <>                                                                          \
+    Vc::double_v Trigonometric<Vc::Detail::TrigonometricImplementation<                  \
+        Vc::CurrentImplementation::current()>>::name_(const Vc::double_v &x)             \
+    {                                                                                    \
+        return name_##Impl(x);                                                           \
+    }
+Vc_HYPERBOLIC_(sinh)
+Vc_HYPERBOLIC_(cosh)
+Vc_HYPERBOLIC_(tanh)
+Vc_HYPERBOLIC_(asinh)
+Vc_HYPERBOLIC_(atanh)
+#undef Vc_HYPERBOLIC_
+
 }
 }
 
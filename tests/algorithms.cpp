@@ -0,0 +1,596 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <algorithm>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using AlgorithmVectors = vir::Typelist<Vc::float_v, Vc::double_v, Vc::int_v, Vc::uint_v>;
+
+// sizes around the vector width and around the chunk size of the parallel algorithms
+template <class V> std::vector<std::size_t> testSizes()
+{
+    using T = typename V::value_type;
+    const std::size_t chunk = Vc::Detail::simd_chunk_size<T>();
+    return {0, 1, V::size() - 1, V::size(), V::size() + 1, 1000, chunk - 1, chunk,
+            3 * chunk + V::size() + 1};
+}
+
+template <class T> std::vector<T> iotaModulo(std::size_t n, std::size_t modulo = 97)
+{
+    std::vector<T> data(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        data[i] = T(i % modulo);
+    }
+    return data;
+}
+
+struct Twice {
+    template <class V> void operator()(V &v) const { v += v; }
+};
+struct Square {
+    template <class V> V operator()(const V &v) const { return v * v; }
+};
+struct Maximum {
+    template <class V> V operator()(const V &a, const V &b) const { return Vc::max(a, b); }
+};
+
+TEST_TYPES(V, simdTransform, AlgorithmVectors)  //{{{1
+{
+    using T = typename V::value_type;
+    for (std::size_t n : testSizes<V>()) {
+        const auto data = iotaModulo<T>(n);
+        std::vector<T> out(n);
+        COMPARE(Vc::simd_transform(data.begin(), data.end(), out.begin(), Square()) -
+                    out.begin(),
+                std::ptrdiff_t(n));
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i], data[i] * data[i]) << "n = " << n << ", i = " << i;
+        }
+    }
+}
+
+TEST_TYPES(V, streamingStores, AlgorithmVectors)  //{{{1
+{
+    using T = typename V::value_type;
+    const std::size_t defaultThreshold = Vc::streaming_store_threshold();
+    VERIFY(defaultThreshold > 0);
+    // 0 forces the non-temporal stores for every non-empty range
+    for (std::size_t threshold : {std::size_t(0), defaultThreshold}) {
+        Vc::set_streaming_store_threshold(threshold);
+        for (std::size_t n : testSizes<V>()) {
+            // all offsets from an aligned address, for unaligned heads
+            for (std::size_t offset = 0; offset < V::size(); ++offset) {
+                const auto data = iotaModulo<T>(n + offset);
+                std::vector<T, Vc::Allocator<T>> out(n + offset + 1, T(-1));
+                COMPARE(Vc::simd_copy(data.begin() + offset, data.end(),
+                                      out.begin() + offset) -
+                            out.begin(),
+                        std::ptrdiff_t(n + offset));
+                for (std::size_t i = 0; i < n; ++i) {
+                    COMPARE(out[i + offset], data[i + offset])
+                        << "n = " << n << ", offset = " << offset << ", i = " << i;
+                }
+                COMPARE(out[n + offset], T(-1)) << "n = " << n << ", offset = " << offset;
+
+                Vc::simd_fill(out.begin() + offset, out.end() - 1, T(3));
+                COMPARE(std::count(out.begin() + offset, out.end(), T(3)),
+                        std::ptrdiff_t(n))
+                    << "n = " << n << ", offset = " << offset;
+
+                Vc::simd_transform(data.begin() + offset, data.end(),
+                                   out.begin() + offset, Square());
+                for (std::size_t i = 0; i < n; ++i) {
+                    COMPARE(out[i + offset], data[i + offset] * data[i + offset])
+                        << "n = " << n << ", offset = " << offset << ", i = " << i;
+                }
+                COMPARE(out[n + offset], T(-1)) << "n = " << n << ", offset = " << offset;
+            }
+        }
+    }
+
+    // std::deque iterators are random access but not contiguous; its blocks must not be
+    // written with non-temporal stores even above the threshold
+    Vc::set_streaming_store_threshold(0);
+    const auto data = iotaModulo<T>(10000);
+    std::deque<T> deq(data.size(), T(-1));
+    Vc::simd_copy(data.begin(), data.end(), deq.begin());
+    VERIFY(std::equal(data.begin(), data.end(), deq.begin()));
+    Vc::simd_fill(deq.begin(), deq.end(), T(3));
+    COMPARE(std::count(deq.begin(), deq.end(), T(3)), std::ptrdiff_t(deq.size()));
+    std::vector<T> out(data.size());
+    Vc::simd_copy(deq.begin(), deq.end(), out.begin());
+    COMPARE(std::count(out.begin(), out.end(), T(3)), std::ptrdiff_t(out.size()));
+    Vc::set_streaming_store_threshold(defaultThreshold);
+
+    // non-arithmetic and non-contiguous ranges fall back to std::copy and std::fill
+    std::list<std::string> strings(3);
+    Vc::simd_fill(strings.begin(), strings.end(), std::string("x"));
+    std::vector<std::string> copies(3);
+    Vc::simd_copy(strings.begin(), strings.end(), copies.begin());
+    COMPARE(copies[2], std::string("x"));
+}
+
+TEST_TYPES(V, simdReduce, AlgorithmVectors)  //{{{1
+{
+    using T = typename V::value_type;
+    for (std::size_t n : testSizes<V>()) {
+        const auto data = iotaModulo<T>(n);
+        const T sum = std::accumulate(data.begin(), data.end(), T(3));
+        COMPARE(Vc::simd_reduce(data.begin(), data.end(), T(3)), sum) << "n = " << n;
+        const T max = n == 0 ? T(200) : std::max(T(n > 97 ? 96 : n - 1), T(0));
+        COMPARE(Vc::simd_reduce(data.begin(), data.end(), n == 0 ? T(200) : T(0),
+                                Maximum()),
+                max)
+            << "n = " << n;
+    }
+}
+
+TEST_TYPES(V, simdReduceUnaligned, AlgorithmVectors)  //{{{1
+{
+    using T = typename V::value_type;
+    const auto data = iotaModulo<T>(3 * V::size() + 1000);
+    for (std::size_t offset = 0; offset < V::size(); ++offset) {
+        for (std::size_t n : testSizes<V>()) {
+            if (offset + n > data.size()) {
+                continue;
+            }
+            const auto first = data.begin() + offset;
+            const T sum = std::accumulate(first, first + n, T());
+            COMPARE(Vc::simd_reduce(first, first + n, T()), sum)
+                << "offset = " << offset << ", n = " << n;
+            COMPARE(Vc::simd_reduce(first, first + n, T(), Vc::Summation::Pairwise), sum)
+                << "offset = " << offset << ", n = " << n;
+            COMPARE(Vc::simd_reduce(first, first + n, T(), Vc::Summation::Kahan), sum)
+                << "offset = " << offset << ", n = " << n;
+        }
+    }
+}
+
+TEST_TYPES(T, compensatedSummation, vir::Typelist<float, double>)  //{{{1
+{
+    // 1 followed by many values that are lost when added to 1 one by one
+    const std::size_t n = 1000001;
+    const T small = std::numeric_limits<T>::epsilon() / 4;
+    std::vector<T> data(n, small);
+    data[0] = 1;
+    const T exact = 1 + T(n - 1) * small;
+    vir::test::setFuzzyness<T>(1);
+    FUZZY_COMPARE(Vc::simd_reduce(data.begin(), data.end(), T(), Vc::Summation::Kahan),
+                  exact);
+    // pairwise summation only loses the small values within one leaf block
+    const T pairwise =
+        Vc::simd_reduce(data.begin(), data.end(), T(), Vc::Summation::Pairwise);
+    VERIFY(std::abs(pairwise - exact) <=
+           T(Vc::Detail::simd_pairwise_block_registers) * small +
+               std::numeric_limits<T>::epsilon())
+        << pairwise << " vs. " << exact;
+}
+
+TEST_TYPES(V, simdTransformReduce, AlgorithmVectors)  //{{{1
+{
+    using T = typename V::value_type;
+    for (std::size_t n : testSizes<V>()) {
+        // small values keep all sums exactly representable
+        const auto a = iotaModulo<T>(n + 1, 7);
+        const auto b = iotaModulo<T>(n, 7);
+        const T dot = std::inner_product(a.begin() + 1, a.end(), b.begin(), T(1));
+        COMPARE(Vc::simd_transform_reduce(a.begin() + 1, a.end(), b.begin(), T(1)), dot)
+            << "n = " << n;
+        COMPARE(Vc::simd_transform_reduce(a.begin() + 1, a.end(), b.begin(), T(1),
+                                          Vc::Detail::simd_plus(),
+                                          Vc::Detail::simd_multiplies()),
+                dot)
+            << "n = " << n;
+        const T sumOfSquares = std::inner_product(b.begin(), b.end(), b.begin(), T(1));
+        COMPARE(Vc::simd_transform_reduce(b.begin(), b.end(), T(1),
+                                          Vc::Detail::simd_plus(), Square()),
+                sumOfSquares)
+            << "n = " << n;
+    }
+}
+
+TEST(simdReduceWidening)  //{{{1
+{
+    // the sum exceeds the range of short, thus it must be accumulated in the type of init
+    const std::vector<short> data(40000, 1);
+    COMPARE(Vc::simd_reduce(data.begin(), data.end(), 0), 40000);
+    COMPARE(Vc::simd_reduce(data.begin(), data.end(), 0, Vc::Summation::Pairwise), 40000);
+    COMPARE(Vc::simd_reduce(data.begin(), data.end(), 0, Vc::Summation::Kahan), 40000);
+    COMPARE(Vc::simd_reduce(data.begin(), data.end(), 0L), 40000L);
+    COMPARE(Vc::simd_transform_reduce(data.begin(), data.end(), data.begin(), 0), 40000);
+    COMPARE(Vc::simd_transform_reduce(data.begin(), data.end(), data.begin(), 0L), 40000L);
+}
+
+TEST_TYPES(V, simdMinmaxElement, AlgorithmVectors)  //{{{1
+{
+    using T = typename V::value_type;
+    for (std::size_t n : testSizes<V>()) {
+        auto data = iotaModulo<T>(n);
+        if (n > 5) {
+            data[n / 2] = T(200);
+            data[n / 3] = T(200);
+        }
+        const auto reference = std::minmax_element(data.begin(), data.end());
+        const auto result = Vc::simd_minmax_element(data.begin(), data.end());
+        COMPARE(result.first - data.begin(), reference.first - data.begin())
+            << "n = " << n;
+        COMPARE(result.second - data.begin(), reference.second - data.begin())
+            << "n = " << n;
+    }
+}
+
+struct GreaterThan {
+    int limit;
+    template <class V> auto operator()(const V &v) const -> decltype(v > v)
+    {
+        return v > V(limit);
+    }
+};
+
+TEST_TYPES(V, simdFind, AlgorithmVectors)  //{{{1
+{
+    using T = typename V::value_type;
+    for (std::size_t n : testSizes<V>()) {
+        const auto data = iotaModulo<T>(n);
+        for (T value : {T(0), T(5), T(96), T(100)}) {
+            COMPARE(Vc::simd_find(data.begin(), data.end(), value) - data.begin(),
+                    std::find(data.begin(), data.end(), value) - data.begin())
+                << "n = " << n << ", value = " << value;
+            COMPARE(Vc::simd_count(data.begin(), data.end(), value),
+                    std::count(data.begin(), data.end(), value))
+                << "n = " << n << ", value = " << value;
+        }
+        // a match in each lane position of the unrolled loop
+        for (std::size_t pos = 0; pos < n && pos < 5 * V::size(); ++pos) {
+            auto modified = data;
+            modified[pos] = T(120);
+            COMPARE(Vc::simd_find(modified.begin(), modified.end(), T(120)) -
+                        modified.begin(),
+                    std::ptrdiff_t(pos));
+        }
+    }
+}
+
+TEST_TYPES(V, simdFindIf, AlgorithmVectors)  //{{{1
+{
+    using T = typename V::value_type;
+    for (std::size_t n : testSizes<V>()) {
+        const auto data = iotaModulo<T>(n);
+        for (int limit : {-1, 3, 90, 96}) {
+            const GreaterThan pred{limit};
+            auto scalarPred = [&](T x) { return x > T(limit); };
+            COMPARE(Vc::simd_find_if(data.begin(), data.end(), pred) - data.begin(),
+                    std::find_if(data.begin(), data.end(), scalarPred) - data.begin())
+                << "n = " << n << ", limit = " << limit;
+            COMPARE(Vc::simd_count_if(data.begin(), data.end(), pred),
+                    std::count_if(data.begin(), data.end(), scalarPred))
+                << "n = " << n << ", limit = " << limit;
+            COMPARE(Vc::simd_any_of(data.begin(), data.end(), pred),
+                    std::any_of(data.begin(), data.end(), scalarPred));
+            COMPARE(Vc::simd_all_of(data.begin(), data.end(), pred),
+                    std::all_of(data.begin(), data.end(), scalarPred));
+            COMPARE(Vc::simd_none_of(data.begin(), data.end(), pred),
+                    std::none_of(data.begin(), data.end(), scalarPred));
+        }
+    }
+}
+
+TEST_TYPES(V, simdMismatch, AlgorithmVectors)  //{{{1
+{
+    using T = typename V::value_type;
+    for (std::size_t n : testSizes<V>()) {
+        const auto a = iotaModulo<T>(n);
+        auto r = Vc::simd_mismatch(a.begin(), a.end(), a.begin());
+        COMPARE(r.first - a.begin(), std::ptrdiff_t(n));
+        COMPARE(r.second - a.begin(), std::ptrdiff_t(n));
+        for (std::size_t pos = n > 3 * V::size() ? n - 3 * V::size() : 0; pos < n;
+             ++pos) {
+            auto b = a;
+            b[pos] = T(120);
+            r = Vc::simd_mismatch(a.begin(), a.end(), b.begin());
+            COMPARE(r.first - a.begin(), std::ptrdiff_t(pos)) << "n = " << n;
+            COMPARE(r.second - b.begin(), std::ptrdiff_t(pos)) << "n = " << n;
+        }
+    }
+}
+
+TEST_TYPES(V, simdCopyIf, AlgorithmVectors)  //{{{1
+{
+    using T = typename V::value_type;
+    for (std::size_t n : testSizes<V>()) {
+        const auto data = iotaModulo<T>(n);
+        for (int limit : {-1, 3, 90, 96}) {
+            const GreaterThan pred{limit};
+            auto scalarPred = [&](T x) { return x > T(limit); };
+            std::vector<T> reference;
+            std::copy_if(data.begin(), data.end(), std::back_inserter(reference), scalarPred);
+            std::vector<T> copied(n + 1, T(-2));
+            auto end = Vc::simd_copy_if(data.begin(), data.end(), copied.begin(), pred);
+            COMPARE(end - copied.begin(), std::ptrdiff_t(reference.size()))
+                << "n = " << n << ", limit = " << limit;
+            VERIFY(std::equal(reference.begin(), reference.end(), copied.begin()));
+            VERIFY(std::all_of(end, copied.end(), [](T x) { return x == T(-2); }));
+
+            auto removed = data;
+            end = Vc::simd_remove_if(removed.begin(), removed.end(), pred);
+            reference.clear();
+            std::remove_copy_if(data.begin(), data.end(), std::back_inserter(reference),
+                                scalarPred);
+            COMPARE(end - removed.begin(), std::ptrdiff_t(reference.size()))
+                << "n = " << n << ", limit = " << limit;
+            VERIFY(std::equal(reference.begin(), reference.end(), removed.begin()));
+        }
+    }
+}
+
+TEST_TYPES(V, simdPartition, AlgorithmVectors)  //{{{1
+{
+    using T = typename V::value_type;
+    auto sizes = testSizes<V>();
+    for (std::size_t n : {2 * V::size() - 1, 2 * V::size(), 2 * V::size() + 1,
+                          3 * V::size() + 2}) {
+        sizes.push_back(n);
+    }
+    for (std::size_t n : sizes) {
+        auto data = iotaModulo<T>(n);
+        std::reverse(data.begin() + n / 3, data.end());
+        for (int limit : {-1, 3, 50, 96}) {
+            const GreaterThan pred{limit};
+            auto scalarPred = [&](T x) { return x > T(limit); };
+            auto partitioned = data;
+            const auto mid =
+                Vc::simd_partition(partitioned.begin(), partitioned.end(), pred);
+            COMPARE(mid - partitioned.begin(),
+                    std::count_if(data.begin(), data.end(), scalarPred))
+                << "n = " << n << ", limit = " << limit;
+            VERIFY(std::all_of(partitioned.begin(), mid, scalarPred));
+            VERIFY(std::none_of(mid, partitioned.end(), scalarPred));
+            std::sort(partitioned.begin(), partitioned.end());
+            auto sorted = data;
+            std::sort(sorted.begin(), sorted.end());
+            VERIFY(sorted == partitioned) << "n = " << n << ", limit = " << limit;
+        }
+    }
+}
+
+// op(a, b) = b is associative but not commutative
+struct Last {
+    template <class V> V operator()(const V &, const V &b) const { return b; }
+};
+
+TEST_TYPES(V, simdScan, AlgorithmVectors)  //{{{1
+{
+    using T = typename V::value_type;
+    for (std::size_t n : testSizes<V>()) {
+        const auto data = iotaModulo<T>(n);
+        std::vector<T> reference(n);
+        std::partial_sum(data.begin(), data.end(), reference.begin());
+        std::vector<T> out(n);
+        auto end = Vc::simd_inclusive_scan(data.begin(), data.end(), out.begin());
+        COMPARE(end - out.begin(), std::ptrdiff_t(n));
+        VERIFY(out == reference) << "n = " << n;
+
+        for (std::size_t i = 0; i < n; ++i) {
+            reference[i] = std::max(T(20), *std::max_element(data.begin(), data.begin() + i + 1));
+        }
+        Vc::simd_inclusive_scan(data.begin(), data.end(), out.begin(), Maximum(), T(20));
+        VERIFY(out == reference) << "n = " << n;
+
+        end = Vc::simd_exclusive_scan(data.begin(), data.end(), out.begin(), T(5), Last());
+        COMPARE(end - out.begin(), std::ptrdiff_t(n));
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i], i == 0 ? T(5) : data[i - 1]) << "n = " << n << ", i = " << i;
+        }
+
+        // in place
+        out = data;
+        Vc::simd_exclusive_scan(out.begin(), out.end(), out.begin(), T(5));
+        T sum = 5;
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i], sum) << "n = " << n << ", i = " << i;
+            sum += data[i];
+        }
+    }
+}
+
+TEST_TYPES(V, parallelScan, AlgorithmVectors)  //{{{1
+{
+    using T = typename V::value_type;
+    for (std::size_t n : testSizes<V>()) {
+        const auto data = iotaModulo<T>(n);
+        std::vector<T> reference(n);
+        std::partial_sum(data.begin(), data.end(), reference.begin());
+        std::vector<T> out(n);
+        auto end = Vc::simd_inclusive_scan(Vc::execution::par_simd, data.begin(),
+                                           data.end(), out.begin());
+        COMPARE(end - out.begin(), std::ptrdiff_t(n));
+        VERIFY(out == reference) << "n = " << n;
+
+        out = data;
+        Vc::simd_exclusive_scan(Vc::execution::par_simd, out.begin(), out.end(),
+                                out.begin(), T(5));
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i], T(5) + (i == 0 ? T(0) : reference[i - 1]))
+                << "n = " << n << ", i = " << i;
+        }
+
+        Vc::simd_inclusive_scan(Vc::execution::par_simd, data.begin(), data.end(),
+                                out.begin(), Last(), T(5));
+        VERIFY(out == data) << "n = " << n;
+        Vc::simd_exclusive_scan(Vc::execution::par_simd, data.begin(), data.end(),
+                                out.begin(), T(5), Last());
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i], i == 0 ? T(5) : data[i - 1]) << "n = " << n << ", i = " << i;
+        }
+    }
+}
+
+TEST_TYPES(V, parallelForEach, AlgorithmVectors)  //{{{1
+{
+    using T = typename V::value_type;
+    for (std::size_t n : testSizes<V>()) {
+        const auto reference = iotaModulo<T>(n);
+        auto data = reference;
+        Vc::simd_for_each(Vc::execution::par_simd, data.begin(), data.end(), Twice());
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(data[i], T(2 * reference[i])) << "n = " << n << ", i = " << i;
+        }
+    }
+}
+
+TEST_TYPES(V, parallelTransform, AlgorithmVectors)  //{{{1
+{
+    using T = typename V::value_type;
+    for (std::size_t n : testSizes<V>()) {
+        const auto data = iotaModulo<T>(n);
+        std::vector<T> out(n);
+        COMPARE(Vc::simd_transform(Vc::execution::par_simd, data.begin(), data.end(),
+                                   out.begin(), Square()) -
+                    out.begin(),
+                std::ptrdiff_t(n));
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i], data[i] * data[i]) << "n = " << n << ", i = " << i;
+        }
+    }
+}
+
+TEST_TYPES(V, parallelReduce, AlgorithmVectors)  //{{{1
+{
+    using T = typename V::value_type;
+    for (std::size_t n : testSizes<V>()) {
+        const auto data = iotaModulo<T>(n);
+        const T sum = std::accumulate(data.begin(), data.end(), T(3));
+        COMPARE(Vc::simd_reduce(Vc::execution::par_simd, data.begin(), data.end(), T(3),
+                                Vc::Detail::simd_plus()),
+                sum)
+            << "n = " << n;
+    }
+}
+
+// stores every gathered vector at the offset it was gathered for
+template <class T> struct StoreGathered {
+    T *out;
+    template <class V> void operator()(const V &x, std::size_t i) const
+    {
+        x.store(out + i, Vc::Unaligned);
+    }
+};
+
+TEST_TYPES(V, simdGatherForEach, AlgorithmVectors)  //{{{1
+{
+    using T = typename V::value_type;
+    const auto table = iotaModulo<T>(1000, 1000);
+    const Vc::GatherPrefetch distances[] = {{0, 0}, {1, 0}, {0, 1}, {8, 0}, {2, 5}};
+    for (std::size_t n : testSizes<V>()) {
+        std::vector<int> indexes(n);
+        std::vector<unsigned short> shortIndexes(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            indexes[i] = int(i * 7919 % 1000);
+            shortIndexes[i] = indexes[i];
+        }
+        for (const auto prefetch : distances) {
+            std::vector<T> out(n);
+            Vc::simd_gather_for_each<V>(table.data(), indexes.data(), n,
+                                        StoreGathered<T>{out.data()}, prefetch);
+            for (std::size_t i = 0; i < n; ++i) {
+                COMPARE(out[i], table[indexes[i]]) << "n = " << n << ", i = " << i;
+            }
+            std::fill(out.begin(), out.end(), T());
+            Vc::simd_gather_for_each<V>(table.data(), shortIndexes.data(), n,
+                                        StoreGathered<T>{out.data()}, prefetch);
+            for (std::size_t i = 0; i < n; ++i) {
+                COMPARE(out[i], table[indexes[i]]) << "n = " << n << ", i = " << i;
+            }
+        }
+    }
+}
+
+TEST_TYPES(T, simdHistogram, vir::Typelist<int, uint, short, ushort>)  //{{{1
+{
+    std::default_random_engine engine(1);
+    // the first bin counts are below and the last above the private table limit
+    for (std::size_t nbins : {1, 7, 100, 1000, 30000}) {
+        for (std::size_t n : {0, 1, 5, 100, 10000}) {
+            // includes values below and above the bins
+            std::uniform_int_distribution<int> dist(
+                std::is_signed<T>::value ? -3 : 0,
+                int(std::min<std::size_t>(nbins + 3, std::numeric_limits<T>::max())));
+            std::vector<T> data(n);
+            for (auto &x : data) {
+                x = T(dist(engine));
+            }
+            std::vector<uint> reference(nbins, 1u);
+            for (T x : data) {
+                if (x >= 0 && std::size_t(x) < nbins) {
+                    ++reference[x];
+                }
+            }
+            std::vector<uint> bins(nbins, 1u);
+            std::vector<float> floatBins(nbins, 1.f);
+            Vc::simd_histogram(data.begin(), data.end(), bins.begin(), bins.end());
+            Vc::simd_histogram(data.begin(), data.end(), floatBins.begin(),
+                               floatBins.end());
+            for (std::size_t b = 0; b < nbins; ++b) {
+                COMPARE(bins[b], reference[b])
+                    << "n = " << n << ", nbins = " << nbins << ", b = " << b;
+                COMPARE(floatBins[b], float(reference[b]))
+                    << "n = " << n << ", nbins = " << nbins << ", b = " << b;
+            }
+        }
+    }
+}
+
+TEST_TYPES(T, simdHistogramNegative, vir::Typelist<int, short>)  //{{{1
+{
+    // more bins than short has values: negative values must not wrap around to valid
+    // bins, in particular not in the scalar tail
+    const std::size_t nbins = 70000;
+    std::default_random_engine engine(1);
+    std::uniform_int_distribution<int> dist(std::numeric_limits<short>::min(), -1);
+    for (std::size_t n : {1, 5, 100, 10003}) {
+        std::vector<T> data(n);
+        for (auto &x : data) {
+            x = T(dist(engine));
+        }
+        data[n / 2] = 3;
+        // one guard counter before and after the bins
+        std::vector<uint> bins(nbins + 2, 0u);
+        Vc::simd_histogram(data.begin(), data.end(), bins.begin() + 1, bins.end() - 1);
+        for (std::size_t b = 0; b < nbins + 2; ++b) {
+            COMPARE(bins[b], b == 4 ? 1u : 0u) << "n = " << n << ", b = " << b;
+        }
+    }
+}
+
+// vim: foldmethod=marker
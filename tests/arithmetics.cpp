@@ -32,6 +32,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "../Vc/common/const.h"
 #include "../Vc/common/macros.h"
 #include <random>
+#include <vector>
 
 using namespace Vc;
 
@@ -296,6 +297,61 @@ TEST_TYPES(V, testModulo, concat<IntSimdArrays<32>, OddIntSimdArrays<31>, IntVec
     }
 }
 
+// testDivider{{{1
+TEST_TYPES(V, testDivider, IntVectors)
+{
+    using T = typename V::EntryType;
+    using L = std::numeric_limits<T>;
+    std::vector<T> divisors = {L::max(), T(L::max() - 1), T(L::max() / 2 + 1),
+                               T(L::max() / 2 + 2), T(L::max() / 3)};
+    for (int d : {1, 2, 3, 5, 7, 10, 64, 100, 641, 1000, 4096, 6700417}) {
+        if (d <= int(L::max())) {
+            divisors.push_back(T(d));
+        }
+    }
+    if (std::is_signed<T>::value) {
+        for (std::size_t i = 0, n = divisors.size(); i < n; ++i) {
+            divisors.push_back(T(-divisors[i]));
+        }
+        divisors.push_back(L::min());
+        divisors.push_back(T(L::min() + 1));
+    }
+    for (int i = 0; i < 100; ++i) {
+        const T d = V::Random()[0];
+        if (d != 0) {
+            divisors.push_back(d);
+        }
+    }
+    for (const T d : divisors) {
+        const Vc::Divider<T> divider(d);
+        COMPARE(divider.divisor(), d);
+        const auto check = [&](const V x) {
+            const V reference = V::generate([&](std::size_t i) {
+                // the builtin operator is undefined for min / -1
+                return std::is_signed<T>::value && d == T(-1) ? T(0u - unsigned(x[i]))
+                                                                : T(x[i] / d);
+            });
+            COMPARE(x / divider, reference) << ", x: " << x << ", d: " << d;
+            COMPARE(x % divider, x - reference * d) << ", x: " << x << ", d: " << d;
+            for (std::size_t i = 0; i < V::Size; ++i) {
+                COMPARE(x[i] / divider, reference[i]) << ", x: " << x[i] << ", d: " << d;
+            }
+        };
+        check(V(L::min()));
+        check(V(L::max()));
+        check(V(T(L::min() + 1)));
+        check(V(T(L::max() - 1)));
+        check(V(d));
+        check(V(T(d - 1)));
+        check(V(T(d + 1)));
+        check(V::IndexesFromZero());
+        check(-V::IndexesFromZero());
+        for (int repetition = 0; repetition < 200; ++repetition) {
+            check(V::Random());
+        }
+    }
+}
+
 // testAnd{{{1
 TEST_TYPES(Vec, testAnd, int_v, ushort_v, uint_v, short_v)
 {
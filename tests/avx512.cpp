@@ -0,0 +1,211 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+
+#ifdef Vc_IMPL_AVX512
+using Avx512Vectors = vir::Typelist<Vc::AVX512::double_v, Vc::AVX512::float_v,
+                                    Vc::AVX512::int_v, Vc::AVX512::uint_v>;
+
+TEST_TYPES(V, sizes, Avx512Vectors)  // {{{1
+{
+    using T = typename V::EntryType;
+    COMPARE(V::Size, 64 / sizeof(T));
+    COMPARE(sizeof(V), 64u);
+    COMPARE(V::Mask::Size, V::Size);
+}
+
+TEST_TYPES(V, arithmetics, Avx512Vectors)  // {{{1
+{
+    using T = typename V::EntryType;
+    constexpr int N = V::Size;
+    const V a = V::IndexesFromZero();
+    const V b = a + V(T(N));
+    for (int i = 0; i < N; ++i) {
+        COMPARE(a[i], T(i));
+        COMPARE(b[i], T(i + N));
+    }
+    COMPARE(b - a, V(T(N)));
+    COMPARE(a * V(T(2)), a + a);
+    for (int i = 0; i < N; ++i) {
+        COMPARE((b / V(T(2)))[i], T(i + N) / T(2));
+    }
+    COMPARE(-(-a), a);
+    COMPARE(min(a, b), a);
+    COMPARE(max(a, b), b);
+    COMPARE(a.sum(), T(N * (N - 1) / 2));
+    COMPARE(a.min(), T(0));
+    COMPARE(a.max(), T(N - 1));
+    const V ps = a.partialSum();
+    for (int i = 0; i < N; ++i) {
+        COMPARE(ps[i], T(i * (i + 1) / 2));
+    }
+}
+
+TEST_TYPES(V, masks, Avx512Vectors)  // {{{1
+{
+    using T = typename V::EntryType;
+    constexpr int N = V::Size;
+    const V a = V::IndexesFromZero();
+    const auto m = a < V(T(3));
+    COMPARE(m.count(), 3);
+    COMPARE(m.firstOne(), 0);
+    VERIFY(m.isMix());
+    VERIFY((m & !m).isEmpty());
+    VERIFY((m | !m).isFull());
+    VERIFY(all_of(a <= a));
+    VERIFY(none_of(a != a));
+
+    V d = a;
+    where(m) | d = V(T(42));
+    for (int i = 0; i < N; ++i) {
+        COMPARE(d[i], i < 3 ? T(42) : T(i));
+    }
+    COMPARE(a.sum(m), T(3));
+    COMPARE((a + V(T(1))).product(m), T(6));
+
+    bool mem[V::Size];
+    m.store(mem);
+    for (int i = 0; i < N; ++i) {
+        COMPARE(mem[i], i < 3);
+    }
+    COMPARE(typename V::Mask(mem), m);
+}
+
+TEST_TYPES(V, loadStore, Avx512Vectors)  // {{{1
+{
+    using T = typename V::EntryType;
+    constexpr int N = V::Size;
+    alignas(64) T mem[2 * V::Size];
+    for (int i = 0; i < 2 * N; ++i) {
+        mem[i] = T(i);
+    }
+    const V a(mem, Vc::Aligned);
+    const V b(mem + 1, Vc::Unaligned);
+    COMPARE(b - a, V(T(1)));
+
+    short shorts[V::Size];
+    for (int i = 0; i < N; ++i) {
+        shorts[i] = short(i - 4);
+    }
+    COMPARE(V(shorts), a - V(T(4)));
+
+    alignas(64) T out[V::Size] = {};
+    a.store(out, a < V(T(2)));
+    COMPARE(out[1], T(1));
+    COMPARE(out[2], T(0));
+
+    T compressed[V::Size] = {};
+    COMPARE(a.compress_store(compressed, a >= V(T(N - 2))), 2);
+    COMPARE(compressed[0], T(N - 2));
+    COMPARE(compressed[1], T(N - 1));
+
+    V e(T(1));
+    COMPARE(e.expand_load(mem + 5, a < V(T(3))), 3);
+    COMPARE(e[0], T(5));
+    COMPARE(e[2], T(7));
+    COMPARE(e[3], T(1));
+}
+
+TEST_TYPES(V, gatherScatter, Avx512Vectors)  // {{{1
+{
+    using T = typename V::EntryType;
+    constexpr int N = V::Size;
+    T mem[3 * V::Size];
+    for (int i = 0; i < 3 * N; ++i) {
+        mem[i] = T(i);
+    }
+    const Vc::AVX512::int_v idx = Vc::AVX512::int_v::IndexesFromZero() * 3;
+    const V a = V::IndexesFromZero();
+    COMPARE(V(mem, idx), a * V(T(3)));
+    COMPARE(V(mem, typename V::IndexType(Vc::IndexesFromZero)), a);
+
+    V g = V::Zero();
+    const auto m = a < V(T(3));
+    g.gather(mem, idx, m);
+    for (int i = 0; i < N; ++i) {
+        COMPARE(g[i], i < 3 ? T(3 * i) : T(0));
+    }
+
+    T out[3 * V::Size] = {};
+    a.scatter(out, idx, m);
+    COMPARE(out[3], T(1));
+    COMPARE(out[6], T(2));
+    COMPARE(out[9], T(0));
+    a.scatter(out, idx);
+    for (int i = 0; i < N; ++i) {
+        COMPARE(out[3 * i], T(i));
+    }
+}
+
+TEST_TYPES(V, permutations, Avx512Vectors)  // {{{1
+{
+    using T = typename V::EntryType;
+    constexpr int N = V::Size;
+    const V a = V::IndexesFromZero();
+    const V b = a + V(T(N));
+    for (int i = 0; i < N; ++i) {
+        COMPARE(a.shifted(1)[i], i + 1 < N ? T(i + 1) : T(0));
+        COMPARE(a.shifted(-2)[i], i >= 2 ? T(i - 2) : T(0));
+        COMPARE(a.shifted(3, b)[i], T(i + 3));
+        COMPARE(a.shifted(-3, b)[i], i >= 3 ? T(i - 3) : T(2 * N + i - 3));
+        COMPARE(a.rotated(2)[i], T((i + 2) % N));
+        COMPARE(a.reversed()[i], T(N - 1 - i));
+        COMPARE(a.interleaveLow(b)[i], i % 2 ? T(N + i / 2) : T(i / 2));
+        COMPARE(a.interleaveHigh(b)[i], i % 2 ? T(N + N / 2 + i / 2) : T(N / 2 + i / 2));
+    }
+    COMPARE(a.reversed().sorted(), a);
+}
+
+TEST(math)  // {{{1
+{
+    using Vc::AVX512::float_v;
+    using Vc::AVX512::double_v;
+    using Vc::AVX512::int_v;
+    const float_v x(-2.5f);
+    COMPARE(abs(x), float_v(2.5f));
+    COMPARE(floor(x), float_v(-3.f));
+    COMPARE(ceil(x), float_v(-2.f));
+    COMPARE(round(x), float_v(-2.f));
+    COMPARE(trunc(x), float_v(-2.f));
+    COMPARE(sqrt(float_v(4.f)), float_v(2.f));
+    COMPARE(copysign(float_v(3.f), x), float_v(-3.f));
+    COMPARE(fma(x, x, x), float_v(3.75f));
+    COMPARE(exponent(double_v(8.)), double_v(3.));
+    VERIFY(all_of(isnan(float_v(std::numeric_limits<float>::quiet_NaN()))));
+    VERIFY(all_of(isinf(double_v(-std::numeric_limits<double>::infinity()))));
+    VERIFY(none_of(isfinite(double_v(std::numeric_limits<double>::infinity()))));
+
+    const int_v i = int_v::IndexesFromZero();
+    COMPARE(i << 2, i * 4);
+    COMPARE(~i, -i - 1);
+    COMPARE(i % int_v(3), i - i / 3 * 3);
+    COMPARE(Vc::simd_cast<int_v>(Vc::simd_cast<float_v>(i)), i);
+}
+#endif  // Vc_IMPL_AVX512
+
+// vim: foldmethod=marker
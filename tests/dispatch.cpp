@@ -0,0 +1,66 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include "dispatch_kernel.h"
+
+using SaxpyDispatch = Vc::Dispatch<Saxpy, Vc::ScalarImpl, Vc::SSE2Impl, Vc::SSE41Impl,
+                                   Vc::AVXImpl, Vc::AVX2Impl>;
+
+TEST(selectsBestSupported)
+{
+    Vc::Implementation expected = Vc::ScalarImpl;
+    for (auto impl : {Vc::SSE2Impl, Vc::SSE41Impl, Vc::AVXImpl, Vc::AVX2Impl}) {
+        if (Vc::isImplementationSupported(impl)) {
+            expected = impl;
+        }
+    }
+    COMPARE(SaxpyDispatch::selected(), expected);
+
+    float x[37], y[37];
+    for (int i = 0; i < 37; ++i) {
+        x[i] = i;
+        y[i] = 1;
+    }
+    // the first call resolves, the second one calls through the cached pointer
+    COMPARE(SaxpyDispatch::call(2.f, x, y, 37), expected);
+    COMPARE(SaxpyDispatch::call(1.f, x, y, 37), expected);
+    for (int i = 0; i < 37; ++i) {
+        COMPARE(y[i], 3.f * i + 1.f) << "i = " << i;
+    }
+}
+
+TEST(singleVariant)
+{
+    using D = Vc::Dispatch<Saxpy, Vc::ScalarImpl>;
+    COMPARE(D::selected(), Vc::ScalarImpl);
+    float x = 2, y = 1;
+    COMPARE(D::call(3.f, &x, &y, 1), Vc::ScalarImpl);
+    COMPARE(y, 7.f);
+}
+
+// vim: foldmethod=marker
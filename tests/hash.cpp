@@ -0,0 +1,188 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using HashVectors = vir::Typelist<Vc::uint_v, Vc::ushort_v, Vc::SimdArray<Vc::uint, 16>,
+                                  Vc::SimdArray<Vc::ushort, 7>>;
+
+// scalar references {{{1
+Vc::uint fmixReference(Vc::uint h)
+{
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+Vc::uint rotl(Vc::uint x, int n) { return (x << n) | (x >> (32 - n)); }
+
+// XXH32 of short inputs, byte by byte
+Vc::uint xxh32Reference(const unsigned char *p, std::size_t len, Vc::uint seed)
+{
+    const Vc::uint prime1 = 2654435761u, prime2 = 2246822519u, prime3 = 3266489917u,
+                   prime4 = 668265263u, prime5 = 374761393u;
+    Vc::uint h = seed + prime5 + Vc::uint(len);
+    for (; len >= 4; p += 4, len -= 4) {
+        h += (p[0] | p[1] << 8 | p[2] << 16 | Vc::uint(p[3]) << 24) * prime3;
+        h = rotl(h, 17) * prime4;
+    }
+    for (; len > 0; ++p, --len) {
+        h += *p * prime5;
+        h = rotl(h, 11) * prime1;
+    }
+    h ^= h >> 15;
+    h *= prime2;
+    h ^= h >> 13;
+    h *= prime3;
+    h ^= h >> 16;
+    return h;
+}
+
+Vc::uint crc32cReference(const unsigned char *p, std::size_t len, Vc::uint crc)
+{
+    crc = ~crc;
+    for (; len > 0; ++p, --len) {
+        crc ^= *p;
+        for (int i = 0; i < 8; ++i) {
+            crc = (crc >> 1) ^ (crc & 1 ? 0x82F63B78u : 0u);
+        }
+    }
+    return ~crc;
+}
+
+template <class T> std::vector<unsigned char> bytes(T x)
+{
+    std::vector<unsigned char> r;
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        r.push_back((x >> (8 * i)) & 0xff);
+    }
+    return r;
+}
+
+TEST_TYPES(V, hashFunctions, HashVectors)  //{{{1
+{
+    using T = typename V::EntryType;
+    {
+        // known answers: CRC-32C of "123456789" and of four zero bytes
+        const Vc::uint c = Vc::hash_crc32c(0x34333231u, 0u);
+        COMPARE(Vc::hash_crc32c(0x38373635u, c) ^ 0, crc32cReference(
+                    reinterpret_cast<const unsigned char *>("123456789"), 8, 0u));
+        COMPARE(crc32cReference(reinterpret_cast<const unsigned char *>("123456789"), 9, 0u),
+                0xe3069283u);
+        COMPARE(Vc::hash_crc32c(0u), 0x48674bc7u);
+    }
+    for (Vc::uint seed : {0u, 1u, 0x9747b28cu}) {
+        for (int repetition = 0; repetition < 1000; ++repetition) {
+            V keys = V::Random();
+            if (repetition == 0) {
+                keys = 0;
+            } else if (repetition == 1) {
+                keys = T(~T());
+            }
+            const auto murmur = Vc::hash_murmur3(keys);
+            const auto xxh = Vc::hash_xxh32(keys, seed);
+            const auto crc = Vc::hash_crc32c(keys, seed);
+            COMPARE(murmur.size(), V::size());
+            for (std::size_t i = 0; i < V::size(); ++i) {
+                const T key = keys[i];
+                const auto b = bytes(key);
+                COMPARE(murmur[i], fmixReference(key)) << "key: " << key;
+                COMPARE(xxh[i], xxh32Reference(b.data(), b.size(), seed)) << "key: " << key;
+                COMPARE(crc[i], crc32cReference(b.data(), b.size(), seed)) << "key: " << key;
+                COMPARE(Vc::hash_murmur3(key), murmur[i]);
+                COMPARE(Vc::hash_xxh32(key, seed), xxh[i]);
+                COMPARE(Vc::hash_crc32c(key, seed), crc[i]);
+            }
+        }
+    }
+}
+
+// simd_hash_table {{{1
+template <class Value> void testHashTable()
+{
+    std::default_random_engine engine;
+    std::uniform_int_distribution<Vc::uint> keyDist(0, 50000);
+    std::unordered_map<Vc::uint, Value> reference;
+    Vc::simd_hash_table<Value> table;
+    for (int i = 0; i < 20000; ++i) {
+        const Vc::uint key = keyDist(engine);
+        const Value value = Value(i);
+        COMPARE(table.insert(key, value), reference.count(key) == 0);
+        reference[key] = value;
+    }
+    COMPARE(table.size(), reference.size());
+    VERIFY(table.bucket_count() >= 2 * table.size());
+
+    using KeyV = Vc::uint_v;
+    using ValueV = Vc::SimdArray<Value, KeyV::Size>;
+    for (int repetition = 0; repetition < 2000; ++repetition) {
+        KeyV keys = KeyV::Random() % 60000;
+        if (repetition == 0) {
+            keys[0] = table.empty_key();
+        }
+        ValueV values = Value(-1);
+        const auto found = table.find(keys, values);
+        for (std::size_t i = 0; i < KeyV::Size; ++i) {
+            const auto it = reference.find(keys[i]);
+            COMPARE(found[i], it != reference.end()) << "key: " << keys[i];
+            COMPARE(values[i], it != reference.end() ? it->second : Value(-1))
+                << "key: " << keys[i];
+        }
+    }
+
+    std::vector<Vc::uint> keys(1000 + KeyV::Size - 1);
+    for (auto &k : keys) {
+        k = keyDist(engine);
+    }
+    std::vector<Value> values(keys.size());
+    std::size_t expectedCount = 0;
+    for (auto k : keys) {
+        expectedCount += reference.count(k);
+    }
+    COMPARE(table.find(keys.data(), keys.size(), values.data(), Value(-2)), expectedCount);
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        const auto it = reference.find(keys[i]);
+        COMPARE(values[i], it != reference.end() ? it->second : Value(-2))
+            << "key: " << keys[i];
+    }
+}
+
+TEST(hashTable)
+{
+    testHashTable<int>();
+    testHashTable<float>();
+    testHashTable<double>();
+    testHashTable<short>();
+}
+
+// vim: foldmethod=marker
@@ -220,3 +220,30 @@ TEST_TYPES(
         }
     }
 }
+
+TEST_TYPES(Vec, expandLoad, AllTypes)
+{
+    typedef typename Vec::EntryType T;
+    typedef typename Vec::Mask M;
+    T data[Vec::Size];
+    for (std::size_t i = 0; i < Vec::Size; ++i) {
+        data[i] = T(i + 1);
+    }
+    auto check = [&](const M &mask) {
+        Vec v(T(100));
+        const int n = v.expand_load(data, mask);
+        COMPARE(n, mask.count()) << mask;
+        int k = 0;
+        for (std::size_t i = 0; i < Vec::Size; ++i) {
+            const T expected = mask[i] ? data[k++] : T(100);
+            COMPARE(v[i], expected) << ", i: " << i << ", mask: " << mask;
+        }
+    };
+    if (Vec::Size <= 8) {
+        for (std::size_t i = 0; i < (std::size_t(1) << Vec::Size); ++i) {
+            check(allMasks<Vec>(i));
+        }
+    } else {
+        withRandomMask<Vec, 1000>(check);
+    }
+}
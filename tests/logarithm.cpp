@@ -140,5 +140,30 @@ TEST_TYPES(V, testLog10, RealTypes) //{{{1
     });
 }
 
+TEST_TYPES(V, testLog1p, RealTypes) //{{{1
+{
+    setFuzzyness<float>(2);
+    setFuzzyness<double>(2);
+    typedef typename V::EntryType T;
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        // uniformly distributed in ]-1, 10] and logarithmically distributed around 0
+        const V x = (V::Random() - T(0.1)) * T(11);
+        V ref = x.apply([](T _x) { return T(std::log1p(static_cast<long double>(_x))); });
+        FUZZY_COMPARE(Vc::log1p(x), ref) << ", x = " << x << ", i = " << i;
+        const V y = Vc::exp((V::Random() - T(1)) * T(60)) * Vc::copysign(V::One(), V::Random() - T(0.5));
+        ref = y.apply([](T _x) { return T(std::log1p(static_cast<long double>(_x))); });
+        FUZZY_COMPARE(Vc::log1p(y), ref) << ", y = " << y << ", i = " << i;
+    }
+
+    COMPARE(Vc::log1p(V(0)), V(0));
+    COMPARE(Vc::log1p(V(-1)), V(-std::numeric_limits<T>::infinity()));
+    COMPARE(Vc::log1p(V(std::numeric_limits<T>::infinity())),
+            V(std::numeric_limits<T>::infinity()));
+    VERIFY(all_of(Vc::isnan(Vc::log1p(V(-2)))));
+    testAllDenormals<V>([](const V x) {
+        COMPARE(Vc::log1p(x), x) << ", x = " << x;
+    });
+}
+
 //}}}1
 // vim: foldmethod=marker
@@ -123,6 +123,101 @@ TEST_TYPES(V, testExp, RealTypes) //{{{1
     COMPARE(Vc::exp(V(0)), V(1));
 }
 
+TEST_TYPES(V, testExp2, RealTypes) //{{{1
+{
+    setFuzzyness<float>(1);
+    setFuzzyness<double>(2);
+    typedef typename V::EntryType T;
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        V x = (V::Random() - T(0.5)) * T(240);
+        V reference = x.apply([](T _x) { return T(std::exp2(static_cast<long double>(_x))); });
+        FUZZY_COMPARE(Vc::exp2(x), reference) << ", x = " << x << ", i = " << i;
+    }
+    typedef std::numeric_limits<T> L;
+    COMPARE(Vc::exp2(V(0)), V(1));
+    COMPARE(Vc::exp2(V(10)), V(1024));
+    COMPARE(Vc::exp2(V(-1)), V(T(0.5)));
+    COMPARE(Vc::exp2(V(L::min_exponent - L::digits)), V(L::denorm_min()));
+    COMPARE(Vc::exp2(V(L::max_exponent)), V(L::infinity()));
+    COMPARE(Vc::exp2(V(-L::infinity())), V(0));
+    VERIFY(all_of(Vc::isnan(Vc::exp2(V(L::quiet_NaN())))));
+    V x = V::IndexesFromZero();
+    x(x == V(1)) = L::quiet_NaN();
+    COMPARE(Vc::isnan(Vc::exp2(x)), Vc::isnan(x));
+}
+
+TEST_TYPES(V, testExpm1, RealTypes) //{{{1
+{
+    setFuzzyness<float>(2);
+    setFuzzyness<double>(2);
+    typedef typename V::EntryType T;
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        V x = (V::Random() - T(0.4)) * T(140);
+        V reference = x.apply([](T _x) { return T(std::expm1(static_cast<long double>(_x))); });
+        FUZZY_COMPARE(Vc::expm1(x), reference) << ", x = " << x << ", i = " << i;
+        x = (V::Random() - T(0.5)) * T(1.4);
+        reference = x.apply([](T _x) { return T(std::expm1(static_cast<long double>(_x))); });
+        FUZZY_COMPARE(Vc::expm1(x), reference) << ", x = " << x << ", i = " << i;
+    }
+    typedef std::numeric_limits<T> L;
+    COMPARE(Vc::expm1(V(0)), V(0));
+    COMPARE(Vc::expm1(V(L::min())), V(L::min()));
+    COMPARE(Vc::expm1(V(-L::infinity())), V(-1));
+    COMPARE(Vc::expm1(V(L::infinity())), V(L::infinity()));
+}
+
+TEST_TYPES(V, testCbrt, RealTypes) //{{{1
+{
+    setFuzzyness<float>(2);
+    setFuzzyness<double>(4);  // the Scalar implementation uses std::cbrt (glibc: up to 4 ulp)
+    typedef typename V::EntryType T;
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        V x = (V::Random() - T(0.5)) * T(2e6);
+        V reference = x.apply([](T _x) { return T(std::cbrt(static_cast<long double>(_x))); });
+        FUZZY_COMPARE(Vc::cbrt(x), reference) << ", x = " << x << ", i = " << i;
+        x = Vc::exp((V::Random() - T(0.5)) * T(160));
+        reference = x.apply([](T _x) { return T(std::cbrt(static_cast<long double>(_x))); });
+        FUZZY_COMPARE(Vc::cbrt(x), reference) << ", x = " << x << ", i = " << i;
+    }
+    typedef std::numeric_limits<T> L;
+    COMPARE(Vc::cbrt(V(0)), V(0));
+    FUZZY_COMPARE(Vc::cbrt(V(-27)), V(-3));
+    FUZZY_COMPARE(Vc::cbrt(V(64)), V(4));
+    COMPARE(Vc::cbrt(V(-L::infinity())), V(-L::infinity()));
+    FUZZY_COMPARE(Vc::cbrt(V(L::denorm_min())), V(std::cbrt(L::denorm_min())));
+}
+
+TEST_TYPES(V, testPow, RealTypes) //{{{1
+{
+    setFuzzyness<float>(1);
+    setFuzzyness<double>(2);
+    typedef typename V::EntryType T;
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        const V x = V::Random() * T(30);
+        const V y = (V::Random() - T(0.5)) * T(60);
+        V reference;
+        for (size_t j = 0; j < V::Size; ++j) {
+            reference[j] = T(std::pow(static_cast<long double>(x[j]),
+                                      static_cast<long double>(y[j])));
+        }
+        FUZZY_COMPARE(Vc::pow(x, y), reference) << ", x = " << x << ", y = " << y
+                                                << ", i = " << i;
+    }
+    typedef std::numeric_limits<T> L;
+    COMPARE(Vc::pow(V(2), V(10)), V(1024));
+    COMPARE(Vc::pow(V(-2), V(3)), V(-8));
+    COMPARE(Vc::pow(V(-2), V(-2)), V(T(0.25)));
+    COMPARE(Vc::pow(V(T(-0.)), V(-3)), V(-L::infinity()));
+    COMPARE(Vc::pow(V(0), V(3)), V(0));
+    COMPARE(Vc::pow(V(-L::infinity()), V(3)), V(-L::infinity()));
+    COMPARE(Vc::pow(V(L::infinity()), V(-1)), V(0));
+    COMPARE(Vc::pow(V(1), V(L::quiet_NaN())), V(1));
+    COMPARE(Vc::pow(V(L::quiet_NaN()), V(0)), V(1));
+    COMPARE(Vc::pow(V(-1), V(L::infinity())), V(1));
+    VERIFY(all_of(Vc::isnan(Vc::pow(V(-2), V(T(0.5))))));
+    VERIFY(all_of(Vc::isnan(Vc::pow(V(L::quiet_NaN()), V(1)))));
+}
+
 TEST_TYPES(V, testMax, AllTypes) //{{{1
 {
     typedef typename V::EntryType T;
@@ -373,6 +468,267 @@ TEST_TYPES(V, testCopysign, RealTypes)
     COMPARE(z, V::generate([&](int i) { return std::copysign(x[i], y[i]); }));
 }
 
+
+// fast {{{1
+// checks the ulp of Vc::fast::name_(x) for uniformly distributed x in [lo_, hi_[ (or 2^x if
+// log_ is true), compared to the long double result rounded to T.
+#define Vc_FAST_MATH_CHECK_(name_, lo_, hi_, log_, bound_)                                \
+    {                                                                                    \
+        for (size_t i = 0; i < 100000 / V::Size; ++i) {                                  \
+            V x = V::Random() * T((hi_) - (lo_)) + T(lo_);                               \
+            if (log_) {                                                                  \
+                x = x.apply([](T _x) { return std::exp2(_x); });                         \
+            }                                                                            \
+            const V result = Vc::fast::name_(x);                                         \
+            const V reference = x.apply(                                                 \
+                [](T _x) { return T(std::name_(static_cast<long double>(_x))); });       \
+            const V ulp = ulpDiffToReference(result, reference);                         \
+            VERIFY(all_of(ulp <= T(bound_)))                                             \
+                << #name_ "(" << x << ") = " << result << " vs. " << reference           \
+                << ", ulp: " << ulp;                                                     \
+        }                                                                                \
+    }
+
+// The bounds are the documented ones plus ½ ulp for the rounding of the reference.
+TEST_TYPES(V, testFastMath, RealTypes)
+{
+    typedef typename V::EntryType T;
+    const bool isFloat = std::is_same<T, float>::value;
+    const double expBound = isFloat ? 2.7 : 4.2;
+    const double logBound = isFloat ? 1.8 : 2.8;
+    const double log2Bound = isFloat ? 2.9 : 3.7;
+    const double log10Bound = isFloat ? 3.1 : 3.8;
+    // ulpDiffToReference needs a normalized difference, i.e. eˣ ≥ 2⁻¹⁰⁰ (float)
+    Vc_FAST_MATH_CHECK_(exp, isFloat ? -69 : -650, isFloat ? 88 : 709, false, expBound);
+    Vc_FAST_MATH_CHECK_(exp, -1, 1, false, expBound);
+    Vc_FAST_MATH_CHECK_(log, isFloat ? -125 : -1021, isFloat ? 127 : 1023, true,
+                        logBound);
+    Vc_FAST_MATH_CHECK_(log, 0.5, 2, false, logBound);
+    Vc_FAST_MATH_CHECK_(log2, 0.5, 2, false, log2Bound);
+    Vc_FAST_MATH_CHECK_(log10, 0.5, 2, false, log10Bound);
+    Vc_FAST_MATH_CHECK_(log10, 1, 1e6, false, log10Bound);
+    Vc_FAST_MATH_CHECK_(sin, -8192, 8192, false, 3);
+    Vc_FAST_MATH_CHECK_(cos, -8192, 8192, false, 3);
+    Vc_FAST_MATH_CHECK_(sin, -4, 4, false, 3);
+    Vc_FAST_MATH_CHECK_(cos, -4, 4, false, 3);
+
+    V s, c;
+    const V x = (V::Random() - T(0.5)) * T(100);
+    Vc::fast::sincos(x, &s, &c);
+    COMPARE(s, Vc::fast::sin(x));
+    COMPARE(c, Vc::fast::cos(x));
+    COMPARE(Vc::fast::sin(V::Zero()), V::Zero());
+    COMPARE(Vc::fast::cos(V::Zero()), V::One());
+    COMPARE(Vc::fast::exp(V::Zero()), V::One());
+    COMPARE(Vc::fast::log(V::One()), V::Zero());
+
+    // out-of-range exponents are clamped
+    const T inf = std::numeric_limits<T>::infinity();
+    COMPARE(Vc::fast::exp(V(-800)), V::Zero());
+    COMPARE(Vc::fast::exp(V(800)), V(inf));
+    COMPARE(Vc::fast::log(V::Zero()), V(-inf));
+    COMPARE(Vc::fast::log2(V::Zero()), V(-inf));
+    COMPARE(Vc::fast::log10(V::Zero()), V(-inf));
+    VERIFY(all_of(isnan(Vc::fast::log(V(-1)))));
+    VERIFY(all_of(isnan(Vc::fast::log2(V(-1)))));
+    VERIFY(all_of(isnan(Vc::fast::log10(V(-1)))));
+}
+#undef Vc_FAST_MATH_CHECK_
+
+// erf, erfc, normcdf, normcdfinv, lgamma {{{1
+// checks that every entry of expr_ is within bound_ ulp of reference_, which is an
+// expression in the long double variable _x (the corresponding entry of x).
+#define Vc_REFERENCE_CHECK_(x, expr_, reference_, bound_)                                \
+    {                                                                                    \
+        const V result = expr_;                                                          \
+        for (size_t j = 0; j < V::Size; ++j) {                                           \
+            const long double _x = x[j];                                                 \
+            const T reference = T(reference_);                                           \
+            const T ulp = ulpDiffToReference(T(result[j]), reference);                   \
+            VERIFY(ulp <= T(bound_)) << #expr_ " at " << x[j] << " = " << result[j]      \
+                                     << " vs. " << reference << ", ulp: " << ulp;        \
+        }                                                                                \
+    }
+
+// reference values computed with 113-bit floating-point arithmetic
+struct SpecialFunctionReference {
+    double x, f;
+};
+
+static long double normcdfReference(long double x)
+{
+    return 0.5L * std::erfc(-x / std::sqrt(2.L));
+}
+
+// The ulp bounds are the documented ones plus ½ ulp for the rounding of the reference.
+TEST_TYPES(V, testErf, RealTypes)
+{
+    typedef typename V::EntryType T;
+    typedef std::numeric_limits<T> L;
+    const bool isFloat = std::is_same<T, float>::value;
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        const V x = (V::Random() - T(0.5)) * T(12);
+        Vc_REFERENCE_CHECK_(x, Vc::erf(x), std::erf(_x), isFloat ? 1 : 2.3);
+        Vc_REFERENCE_CHECK_(x, Vc::erfc(x), std::erfc(_x), isFloat ? 1 : 6.6);
+        // erfc(y) ≥ 2⁻¹²¹ (float) or 2⁻¹⁰⁰⁰ (double)
+        const V y = V::Random() * T(isFloat ? 9 : 26.5);
+        Vc_REFERENCE_CHECK_(y, Vc::erfc(y), std::erfc(_x), isFloat ? 1 : 6.6);
+    }
+
+    const SpecialFunctionReference erfTable[] = {
+        {-2, -0.99532226501895271},  {-1, -0.84270079294971489},
+        {-0.5, -0.52049987781304652}, {-0.125, -0.1403162048013338},
+        {0.25, 0.27632639016823696},  {0.75, 0.71115563365351508},
+        {1.5, 0.96610514647531076},   {3.5, 0.99999925690162761}};
+    const SpecialFunctionReference erfcTable[] = {
+        {-1, 1.8427007929497148},       {-0.125, 1.1403162048013338},
+        {0.25, 0.7236736098317631},     {1, 0.15729920705028513},
+        {2, 0.0046777349810472662},     {3.5, 7.4309837234141278e-07},
+        {5, 1.5374597944280349e-12},    {10, 2.0884875837625449e-45},
+        {20, 5.3958656116079012e-176},  {26, 5.6631924088561432e-296}};
+    for (const auto &ref : erfTable) {
+        Vc_REFERENCE_CHECK_(V(T(ref.x)), Vc::erf(V(T(ref.x))), ref.f, isFloat ? 1 : 2.3);
+    }
+    for (const auto &ref : erfcTable) {
+        if (!isFloat || ref.x < 9) {
+            Vc_REFERENCE_CHECK_(V(T(ref.x)), Vc::erfc(V(T(ref.x))), ref.f, isFloat ? 1 : 6.6);
+        }
+    }
+
+    COMPARE(Vc::erf(V::Zero()), V::Zero());
+    COMPARE(Vc::erf(V(L::infinity())), V::One());
+    COMPARE(Vc::erf(V(-L::infinity())), V(-1));
+    COMPARE(Vc::erfc(V::Zero()), V::One());
+    COMPARE(Vc::erfc(V(L::infinity())), V::Zero());
+    COMPARE(Vc::erfc(V(-L::infinity())), V(2));
+    VERIFY(all_of(Vc::isnan(Vc::erf(V(L::quiet_NaN())))));
+    VERIFY(all_of(Vc::isnan(Vc::erfc(V(L::quiet_NaN())))));
+}
+
+TEST_TYPES(V, testNormcdf, RealTypes)
+{
+    typedef typename V::EntryType T;
+    typedef std::numeric_limits<T> L;
+    const bool isFloat = std::is_same<T, float>::value;
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        // Φ(x) ≥ 2⁻¹²⁰ (float) or 2⁻¹⁰⁰⁰ (double)
+        const V x = V::Random() * T(isFloat ? 22 : 46) - T(isFloat ? 13 : 37);
+        Vc_REFERENCE_CHECK_(x, Vc::normcdf(x), normcdfReference(_x), isFloat ? 1 : 6.5);
+    }
+
+    const SpecialFunctionReference table[] = {
+        {-37, 5.7255712225245771e-300}, {-20, 2.7536241186062337e-89},
+        {-8, 6.2209605742717839e-16},   {-3, 0.0013498980316300946},
+        {-1.5, 0.066807201268858071},   {-0.5, 0.30853753872598688},
+        {0.25, 0.5987063256829237},     {1, 0.84134474606854293},
+        {2.5, 0.99379033467422384},     {6, 0.9999999990134123}};
+    for (const auto &ref : table) {
+        if (!isFloat || ref.x > -13) {
+            Vc_REFERENCE_CHECK_(V(T(ref.x)), Vc::normcdf(V(T(ref.x))), ref.f, isFloat ? 1 : 6.5);
+        }
+    }
+
+    COMPARE(Vc::normcdf(V::Zero()), V(T(0.5)));
+    COMPARE(Vc::normcdf(V(L::infinity())), V::One());
+    COMPARE(Vc::normcdf(V(-L::infinity())), V::Zero());
+    VERIFY(all_of(Vc::isnan(Vc::normcdf(V(L::quiet_NaN())))));
+}
+
+TEST_TYPES(V, testNormcdfinv, RealTypes)
+{
+    typedef typename V::EntryType T;
+    typedef std::numeric_limits<T> L;
+    const bool isFloat = std::is_same<T, float>::value;
+    // The reference is one Newton step in long double from the result x:
+    // x - (Φ(x) - p) / φ(x). That is exact to the precision of long double, since the
+    // result is accurate to a few ulp.
+    const auto newtonStep = [](long double x, long double p) {
+        const long double phi = std::exp(-0.5L * x * x) / std::sqrt(2 * 3.14159265358979323846L);
+        return x - (normcdfReference(x) - p) / phi;
+    };
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        V p = V::Random();
+        p(p == V::Zero()) = T(0.5);
+        V x = Vc::normcdfinv(p);
+        Vc_REFERENCE_CHECK_(p, x, newtonStep(x[j], _x), isFloat ? 1 : 4.5);
+        // the lower tail down to 2⁻¹²⁰ (float) or 2⁻¹⁰⁰⁰ (double)
+        p = Vc::exp2(-V::Random() * T(isFloat ? 120 : 1000));
+        p(p == V::One()) = T(0.5);
+        x = Vc::normcdfinv(p);
+        Vc_REFERENCE_CHECK_(p, x, newtonStep(x[j], _x), isFloat ? 1 : 4.5);
+        // the upper tail: 1 - p is exact
+        p = T(1) - Vc::exp2(-V::Random() * T(isFloat ? 24 : 53));
+        p(p == V::Zero()) = T(0.5);
+        x = Vc::normcdfinv(p);
+        Vc_REFERENCE_CHECK_(p, x, newtonStep(x[j], _x), isFloat ? 1 : 4.5);
+    }
+
+    const SpecialFunctionReference table[] = {
+        {1e-300, -37.047096299361201}, {1e-20, -9.262340089798407},
+        {1e-08, -5.6120012441747891},  {0.001, -3.0902323061678136},
+        {0.025, -1.9599639845400543},  {0.1, -1.2815515655446004},
+        {0.3, -0.52440051270804078},   {0.6, 0.25334710313579972},
+        {0.9, 1.2815515655446006},     {0.975, 1.9599639845400538},
+        {0.999999, 4.7534243088170873}};
+    for (const auto &ref : table) {
+        // the float references differ, since they are computed for p rounded to float
+        if (!isFloat) {
+            Vc_REFERENCE_CHECK_(V(T(ref.x)), Vc::normcdfinv(V(T(ref.x))), ref.f, 4.5);
+        }
+    }
+
+    COMPARE(Vc::normcdfinv(V(T(0.5))), V::Zero());
+    COMPARE(Vc::normcdfinv(V::Zero()), V(-L::infinity()));
+    COMPARE(Vc::normcdfinv(V::One()), V(L::infinity()));
+    VERIFY(all_of(Vc::isnan(Vc::normcdfinv(V(-1)))));
+    VERIFY(all_of(Vc::isnan(Vc::normcdfinv(V(2)))));
+    VERIFY(all_of(Vc::isnan(Vc::normcdfinv(V(L::quiet_NaN())))));
+}
+
+TEST_TYPES(V, testLgamma, RealTypes)
+{
+    typedef typename V::EntryType T;
+    typedef std::numeric_limits<T> L;
+    const bool isFloat = std::is_same<T, float>::value;
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        V x = V::Random() * T(30);
+        x(x == V::Zero()) = T(1);
+        Vc_REFERENCE_CHECK_(x, Vc::lgamma(x), std::lgamma(_x), isFloat ? 1 : 5);
+        x = Vc::exp((V::Random() - T(0.5)) * T(isFloat ? 160 : 1400));
+        Vc_REFERENCE_CHECK_(x, Vc::lgamma(x), std::lgamma(_x), isFloat ? 1 : 5);
+        // for x < 0 the error is bounded relative to max(1, |lgamma(x)|)
+        x = -V::Random() * T(170);
+        const V result = Vc::lgamma(x);
+        for (size_t j = 0; j < V::Size; ++j) {
+            const long double reference = std::lgamma(static_cast<long double>(x[j]));
+            const long double scale = std::max(1.L, std::abs(reference));
+            VERIFY(result[j] == reference ||  // poles
+                   std::abs(result[j] - reference) <= 12 * L::epsilon() * scale)
+                << "lgamma(" << x[j] << ") = " << result[j] << " vs. " << T(reference);
+        }
+    }
+
+    const SpecialFunctionReference table[] = {
+        {0.0625, 2.7396316219462036}, {0.5, 0.57236494292470008},
+        {1.25, -0.098271836421813155}, {2.5, 0.28468287047291918},
+        {3, 0.69314718055994529},      {7.75, 8.0254583963159831},
+        {8.5, 9.5492672573009969},     {100, 359.1342053695754},
+        {1e+10, 220258509288.81058},   {-0.5, 1.2655121234846454},
+        {-1.5, 0.86004701537648098},   {-100.5, -364.90096830942736}};
+    for (const auto &ref : table) {
+        Vc_REFERENCE_CHECK_(V(T(ref.x)), Vc::lgamma(V(T(ref.x))), ref.f, isFloat ? 1 : 5);
+    }
+
+    COMPARE(Vc::lgamma(V::One()), V::Zero());
+    COMPARE(Vc::lgamma(V(2)), V::Zero());
+    COMPARE(Vc::lgamma(V::Zero()), V(L::infinity()));
+    COMPARE(Vc::lgamma(V(-3)), V(L::infinity()));
+    COMPARE(Vc::lgamma(V(L::infinity())), V(L::infinity()));
+    COMPARE(Vc::lgamma(V(-L::infinity())), V(L::infinity()));
+    VERIFY(all_of(Vc::isnan(Vc::lgamma(V(L::quiet_NaN())))));
+}
+#undef Vc_REFERENCE_CHECK_
+
 //}}}1
 
 // vim: foldmethod=marker
@@ -26,6 +26,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 }}}*/
 
 #include "unittest.h"
+#include <cstdint>
+#include <numeric>
+#include <unistd.h>
 
 using namespace Vc;
 
@@ -319,3 +322,118 @@ TEST_TYPES(V, testCopyAssignment, AllVectors)
         COMPARE(m1[i], T(1));
     }
 }
+
+TEST_TYPES(V, hugePageMemory, AllVectors)
+{
+    using T = typename V::EntryType;
+    Memory<V> m(1000, Vc::AlignOnHugePage);
+    VERIFY(reinterpret_cast<std::uintptr_t>(m.entries()) % (2 * 1024 * 1024) == 0);
+    V padding = m.lastVector();
+    COMPARE(padding, V(0));
+    for (size_t i = 0; i < m.entriesCount(); ++i) {
+        m[i] = T(i);
+    }
+    for (size_t i = 0; i < m.entriesCount(); ++i) {
+        COMPARE(m[i], T(i));
+    }
+}
+
+TEST(mallocAlignment)
+{
+    const auto check = [](float *p, std::size_t alignment) {
+        VERIFY(p != nullptr);
+        VERIFY(reinterpret_cast<std::uintptr_t>(p) % alignment == 0);
+        Vc::free(p);
+    };
+    check(Vc::malloc<float, Vc::AlignOnVector>(3), Vc::VectorAlignment);
+    check(Vc::malloc<float, Vc::AlignOnCacheline>(3), 64);
+    check(Vc::malloc<float, Vc::AlignOnPage>(3), sysconf(_SC_PAGESIZE));
+    check(Vc::malloc<float, Vc::AlignOnHugePage>(3), 2 * 1024 * 1024);
+
+    std::vector<float, Vc::MallocAllocator<float, Vc::AlignOnHugePage>> v(1000, 1.f);
+    VERIFY(reinterpret_cast<std::uintptr_t>(v.data()) % (2 * 1024 * 1024) == 0);
+    COMPARE(std::accumulate(v.begin(), v.end(), 0.f), 1000.f);
+}
+
+TEST(numaPlacement)
+{
+    // three huge pages plus a partial one
+    const std::size_t n = 7 * 1024 * 1024 / sizeof(int) + 3;
+    int *p = Vc::malloc<int, Vc::AlignOnHugePage>(n);
+    VERIFY(numa_node_count() >= 1u);
+    // the kernel may refuse (e.g. in containers); the memory must stay usable
+    numa_interleave(p, n * sizeof(int));
+    VERIFY(!numa_bind(p, n * sizeof(int), -1));
+    VERIFY(!numa_bind(p, n * sizeof(int), int(numa_node_count()) + 64));
+    first_touch(p, n, 3);
+    for (std::size_t i = 0; i < n; ++i) {
+        if (p[i] != 3) {
+            FAIL() << "p[" << i << "] = " << p[i];
+        }
+    }
+    Vc::free(p);
+}
+
+TEST_TYPES(V, arenaMemory, AllVectors)
+{
+    using T = typename V::EntryType;
+    Vc::Arena arena(1024);
+    for (int round = 0; round < 3; ++round) {
+        for (size_t n : {1, 13, 100, 1000}) {
+            Memory<V> m(n, arena);
+            VERIFY(reinterpret_cast<std::uintptr_t>(m.entries()) % V::MemoryAlignment == 0);
+            V padding = m.lastVector();
+            COMPARE(padding, V(0));
+            for (size_t i = 0; i < m.entriesCount(); ++i) {
+                m[i] = T(i);
+            }
+            Memory<V> copy(m);
+            for (size_t i = 0; i < m.entriesCount(); ++i) {
+                COMPARE(copy[i], T(i));
+            }
+        }
+        arena.reset();
+    }
+
+    // cache line alignment and larger alignments than the block provides
+    for (std::size_t alignment : {64, 4096}) {
+        void *p = arena.allocate(3, alignment);
+        VERIFY(reinterpret_cast<std::uintptr_t>(p) % alignment == 0);
+    }
+    arena.release();
+    COMPARE(arena.capacity(), 0u);
+}
+
+TEST_TYPES(V, prefetchingIteration, AllVectors)
+{
+    using T = typename V::EntryType;
+    const MemoryPrefetch tuned = MemoryPrefetch::tuned();
+    VERIFY(tuned.close > 0);
+    VERIFY(tuned.mid >= tuned.close);
+
+    Memory<V> m(1000);
+    for (size_t i = 0; i < m.entriesCount(); ++i) {
+        m[i] = T(i % 100);
+    }
+    size_t i = 0;
+    for (auto &x : m.prefetching()) {
+        COMPARE(V(x), m.vector(i));
+        x += V(1);
+        ++i;
+    }
+    COMPARE(i, m.vectorsCount());
+    for (i = 0; i < m.entriesCount(); ++i) {
+        COMPARE(m[i], T(i % 100 + 1));
+    }
+
+    const Memory<V> &cm = m;
+    i = 0;
+    for (const auto &x : cm.template prefetching<64, 1024>()) {
+        COMPARE(V(x), cm.vector(i));
+        ++i;
+    }
+    COMPARE(i, cm.vectorsCount());
+    COMPARE(std::distance(cm.prefetching(MemoryPrefetch(0, 0)).begin(),
+                          cm.prefetching(MemoryPrefetch(0, 0)).end()),
+            std::ptrdiff_t(cm.vectorsCount()));
+}
@@ -26,6 +26,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 }}}*/
 
 #include "unittest.h"
+#include <array>
+#include <cstdint>
+#include <vector>
 
 #ifdef _WIN32
 void bzero(void *p, size_t n) { memset(p, 0, n); }
@@ -133,4 +136,191 @@ template <> void Random_<double_v>::run()
 }
 }  // namespace Tests
 
+// engines {{{1
+// scalar Philox4x32-10 for one counter
+std::array<Vc::uint, 4> philoxReference(std::array<Vc::uint, 4> c, Vc::uint k0, Vc::uint k1)
+{
+    for (int round = 0; round < 10; ++round) {
+        const std::uint64_t p0 = std::uint64_t(0xD2511F53u) * c[0];
+        const std::uint64_t p1 = std::uint64_t(0xCD9E8D57u) * c[2];
+        c = {{Vc::uint(p1 >> 32) ^ c[1] ^ k0, Vc::uint(p1), Vc::uint(p0 >> 32) ^ c[3] ^ k1,
+              Vc::uint(p0)}};
+        k0 += 0x9E3779B9u;
+        k1 += 0xBB67AE85u;
+    }
+    return c;
+}
+
+TEST(philox4x32)
+{
+    using Vc::uint_v;
+    {
+        // known-answer test of the Random123 distribution: zero counter and key
+        Vc::Philox4x32_v engine;
+        for (Vc::uint ref : {0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u}) {
+            const uint_v x = engine();
+            COMPARE(x[0], ref);
+        }
+    }
+    for (std::uint64_t seed : {std::uint64_t(0), std::uint64_t(0x0123456789abcdefull)}) {
+        for (Vc::uint stream : {0u, 1u, 12345u}) {
+            Vc::Philox4x32_v engine(seed, stream);
+            for (std::uint64_t block = 0; block < 10; ++block) {
+                std::array<uint_v, 4> x = {{engine(), engine(), engine(), engine()}};
+                for (Vc::uint lane = 0; lane < uint_v::Size; ++lane) {
+                    const auto ref = philoxReference(
+                        {{Vc::uint(block), Vc::uint(block >> 32), lane, stream}},
+                        Vc::uint(seed), Vc::uint(seed >> 32));
+                    for (int i = 0; i < 4; ++i) {
+                        COMPARE(x[i][lane], ref[i]) << "block: " << block << ", stream: "
+                                                    << stream << ", seed: " << seed;
+                    }
+                }
+            }
+        }
+    }
+    for (std::uint64_t skip : {0, 1, 3, 4, 5, 7, 8, 11, 12, 17}) {
+        Vc::Philox4x32_v a(42), b(42);
+        a();
+        b();
+        a.discard(skip);
+        for (std::uint64_t i = 0; i < skip; ++i) {
+            b();
+        }
+        for (int i = 0; i < 9; ++i) {
+            const uint_v x = a();
+            const uint_v y = b();
+            COMPARE(x, y) << "skip: " << skip;
+        }
+    }
+}
+
+// scalar xoshiro128** seeded with SplitMix64
+struct XoshiroReference {
+    Vc::uint s[4];
+    explicit XoshiroReference(std::uint64_t seed)
+    {
+        for (int i = 0; i < 4; i += 2) {
+            std::uint64_t z = (seed += 0x9e3779b97f4a7c15ull);
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+            z ^= z >> 31;
+            s[i] = Vc::uint(z);
+            s[i + 1] = Vc::uint(z >> 32);
+        }
+    }
+    static Vc::uint rotl(Vc::uint x, int k) { return (x << k) | (x >> (32 - k)); }
+    Vc::uint operator()()
+    {
+        const Vc::uint result = rotl(s[1] * 5, 7) * 9;
+        const Vc::uint t = s[1] << 9;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 11);
+        return result;
+    }
+    void jump(const Vc::uint (&polynomial)[4])
+    {
+        Vc::uint r[4] = {0, 0, 0, 0};
+        for (Vc::uint p : polynomial) {
+            for (int b = 0; b < 32; ++b) {
+                if (p & (1u << b)) {
+                    for (int k = 0; k < 4; ++k) {
+                        r[k] ^= s[k];
+                    }
+                }
+                operator()();
+            }
+        }
+        std::copy(r, r + 4, s);
+    }
+};
+
+TEST(xoshiro128)
+{
+    using Vc::uint_v;
+    for (std::uint64_t seed : {std::uint64_t(0), std::uint64_t(0x0123456789abcdefull)}) {
+        for (Vc::uint stream : {0u, 1u, 3u}) {
+            Vc::Xoshiro128_v engine(seed, stream);
+            std::vector<XoshiroReference> lanes;
+            XoshiroReference ref(seed);
+            for (Vc::uint i = 0; i < stream; ++i) {
+                ref.jump({0xb523952e, 0x0b6f099f, 0xccf5a0ef, 0x1c580662});
+            }
+            for (std::size_t lane = 0; lane < uint_v::Size; ++lane) {
+                lanes.push_back(ref);
+                ref.jump({0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b});
+            }
+            for (int i = 0; i < 1000; ++i) {
+                const uint_v x = engine();
+                for (std::size_t lane = 0; lane < uint_v::Size; ++lane) {
+                    const Vc::uint ref = lanes[lane]();
+                    COMPARE(x[lane], ref) << "i: " << i << ", stream: " << stream
+                                                    << ", seed: " << seed;
+                }
+            }
+        }
+    }
+    Vc::Xoshiro128_v a(7), b(7);
+    a.discard(5);
+    for (int i = 0; i < 5; ++i) {
+        b();
+    }
+    const uint_v x = a();
+    const uint_v y = b();
+    COMPARE(x, y);
+}
+
+// distributions {{{1
+// Sample mean and variance of n values from the distribution must be within 5 standard
+// errors of the expected values.
+template <typename V, typename Engine, typename Distribution, typename Check>
+void checkMoments(Engine &engine, Distribution &distribution, double mean, double variance,
+                  double fourthCentralMoment, Check &&check)
+{
+    constexpr std::size_t n = 1 << 20;
+    double sum = 0, sum2 = 0;
+    for (std::size_t i = 0; i < n; i += V::Size) {
+        const V x = distribution(engine);
+        check(x);
+        for (std::size_t k = 0; k < V::Size; ++k) {
+            sum += x[k];
+            sum2 += (x[k] - mean) * (x[k] - mean);
+        }
+    }
+    const double count = n / V::Size * V::Size;
+    VERIFY(std::abs(sum / count - mean) < 5 * std::sqrt(variance / count))
+        << "mean: " << sum / count << ", expected: " << mean;
+    VERIFY(std::abs(sum2 / count - variance) <
+           5 * std::sqrt((fourthCentralMoment - variance * variance) / count))
+        << "variance: " << sum2 / count << ", expected: " << variance;
+}
+
+template <typename V, typename Engine> void testDistributions()
+{
+    using T = typename V::EntryType;
+    Engine engine(1234, 5);
+    Vc::UniformDistribution<V> uniform(-1, 3);
+    checkMoments<V>(engine, uniform, 1, 16. / 12, 256. / 80, [](const V &x) {
+        VERIFY(all_of(x >= V(-1) && x < V(3))) << x;
+    });
+    Vc::NormalDistribution<V> normal(2, 0.5);
+    checkMoments<V>(engine, normal, 2, 0.25, 3 * 0.25 * 0.25, [](const V &x) {
+        VERIFY(all_of(abs(x - V(2)) < V(T(0.5 * 8.7)))) << x;
+    });
+    Vc::ExponentialDistribution<V> exponential(4);
+    checkMoments<V>(engine, exponential, 0.25, 1. / 16, 9. / 256, [](const V &x) {
+        VERIFY(all_of(x >= V(0) && isfinite(x))) << x;
+    });
+}
+
+TEST_TYPES(V, distributions, concat<RealVectors, RealSimdArrays<7>>)
+{
+    testDistributions<V, Vc::Philox4x32_v>();
+    testDistributions<V, Vc::Xoshiro128_v>();
+}
+
 // vim: foldmethod=marker
@@ -100,6 +100,47 @@ TEST_TYPES(Vec, maskedScatterArray, AllTypes) //{{{1
     });
 }
 
+TEST_TYPES(Vec, scatterAdd, AllTypes) //{{{1
+{
+    typedef typename Vec::IndexType It;
+    typedef typename Vec::EntryType T;
+    constexpr int N = 5;
+
+    const Vec v = Vec([](T n) { return n + 1; });
+    // duplicate indexes, all equal indexes, and unique indexes
+    for (const It idx : {It([](int n) { return n * 3 % N; }), It(2),
+                         It([](int n) { return n; })}) {
+        Vc::array<T, Vec::Size + N> mem;
+        Vc::array<T, Vec::Size + N> reference;
+        for (std::size_t i = 0; i < mem.size(); ++i) {
+            mem[i] = reference[i] = T(i);
+        }
+        for (std::size_t i = 0; i < Vec::Size; ++i) {
+            reference[idx[i]] += v[i];
+        }
+        Vc::scatter_add(&mem[0], idx, v);
+        for (std::size_t i = 0; i < mem.size(); ++i) {
+            COMPARE(mem[i], reference[i]) << "i = " << i << ", idx = " << idx;
+        }
+
+        withRandomMask<Vec>([&](typename Vec::mask_type m) {
+            for (std::size_t i = 0; i < mem.size(); ++i) {
+                mem[i] = reference[i] = T(i);
+            }
+            for (std::size_t i = 0; i < Vec::Size; ++i) {
+                if (m[i]) {
+                    reference[idx[i]] += v[i];
+                }
+            }
+            Vc::scatter_add(&mem[0], idx, v, m);
+            for (std::size_t i = 0; i < mem.size(); ++i) {
+                COMPARE(mem[i], reference[i]) << "i = " << i << ", idx = " << idx
+                                              << ", m = " << m;
+            }
+        });
+    }
+}
+
 //struct Struct {{{1
 template <typename T, size_t Align = std::is_arithmetic<T>::value ? sizeof(T) : alignof(T)>
 struct alignas(Align > alignof(short) ? Align : alignof(short)) Struct
@@ -672,4 +672,60 @@ TEST_TYPES(T, generator, float, short, std::array<float, 3>, std::tuple<double,
     }
 }
 
+TEST_TYPES(T, simd_vector, float, short, std::array<float, 3>, std::tuple<double, int>)
+{
+    using C = Vc::simd_vector<T>;
+    constexpr std::size_t L = C::lanes();
+    C c;
+    for (int i = 0; i < int(3 * L + 1); ++i) {
+        c.push_back(create<T>(i));
+        COMPARE(c.size(), std::size_t(i + 1));
+        COMPARE(c.vectorsCount(), (c.size() + L - 1) / L);
+    }
+    for (std::size_t i = 0; i < c.size(); ++i) {
+        COMPARE(T(c[i]), create<T>(i)) << "i = " << i;
+    }
+    // the blocks store the objects in order, and the tail lanes hold T()
+    for (std::size_t j = 0; j < c.vectorsCount(); ++j) {
+        const auto &block = Vc::decorate(c.vector(j));
+        for (std::size_t i = 0; i < L; ++i) {
+            COMPARE(block[i], j * L + i < c.size() ? create<T>(j * L + i) : T());
+        }
+    }
+    COMPARE(std::size_t(c.end() - c.begin()), c.vectorsCount());
+
+    c[1] = create<T>(100);
+    COMPARE(T(c[1]), create<T>(100));
+    swap(c[0], c[1]);
+    COMPARE(T(c[0]), create<T>(100));
+    COMPARE(T(c[1]), create<T>(0));
+    c[1] = c[0];
+    COMPARE(T(c.at(1)), create<T>(100));
+    COMPARE(T(c.back()), create<T>(3 * L));
+
+    c.pop_back();
+    COMPARE(c.size(), 3 * L);
+    COMPARE(c.vectorsCount(), 3u);
+    c.resize(L + 1);
+    COMPARE(c.vectorsCount(), 2u);
+    if (L > 1) {
+        COMPARE(Vc::extract(c.vector(1), 1), T());
+    }
+    c.resize(4 * L - 1, create<T>(7));
+    for (std::size_t i = L + 1; i < c.size(); ++i) {
+        COMPARE(T(c[i]), create<T>(7)) << "i = " << i;
+    }
+    if (L > 1) {
+        COMPARE(Vc::extract(c.vector(3), L - 1), T());
+    }
+
+    const C c2(5, create<T>(3));
+    COMPARE(c2.size(), 5u);
+    COMPARE(c2[4], create<T>(3));
+    COMPARE(c2.front(), create<T>(3));
+    c.clear();
+    COMPARE(c.size(), 0u);
+    VERIFY(c.empty());
+}
+
 // vim: foldmethod=marker
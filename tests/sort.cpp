@@ -0,0 +1,185 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 The Vc developers
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using SortVectors = vir::Typelist<Vc::float_v, Vc::double_v, Vc::int_v, Vc::uint_v>;
+
+template <class T> std::vector<T> randomData(std::size_t n)
+{
+    std::default_random_engine engine;
+    std::uniform_int_distribution<int> dist(-1000, 1000);  // many duplicates
+    std::vector<T> data(n);
+    for (auto &x : data) {
+        x = T(dist(engine));
+    }
+    return data;
+}
+
+// sizes around the register width, the tile size, and the parallel threshold
+template <class V> std::vector<std::size_t> testSizes()
+{
+    return {0,
+            1,
+            2,
+            V::size() - 1,
+            V::size(),
+            V::size() + 1,
+            3 * V::size() + 1,
+            1000,
+            V::size() * Vc::Detail::simd_sort_tile_registers + 3,
+            Vc::Detail::simd_sort_parallel_threshold + 5};
+}
+
+TEST_TYPES(V, sortKeys, SortVectors)  //{{{1
+{
+    using T = typename V::value_type;
+    for (std::size_t n : testSizes<V>()) {
+        auto data = randomData<T>(n);
+        auto reference = data;
+        std::sort(reference.begin(), reference.end());
+        Vc::simd_sort(data.begin(), data.end());
+        VERIFY(data == reference) << "n = " << n;
+    }
+}
+
+TEST_TYPES(V, sortSpecialValues, SortVectors)  //{{{1
+{
+    using T = typename V::value_type;
+    using L = std::numeric_limits<T>;
+    std::vector<T> data = {L::max(), L::lowest(), T(), L::max(), T(1), L::lowest(),
+                           L::max(), T(),         T(2), L::min(), L::max()};
+    if (L::has_infinity) {
+        data.push_back(L::infinity());
+        data.push_back(-L::infinity());
+    }
+    auto reference = data;
+    std::sort(reference.begin(), reference.end());
+    Vc::simd_sort(data.begin(), data.end());
+    VERIFY(data == reference);
+}
+
+TEST_TYPES(V, sortPartitioned, SortVectors)  //{{{1
+{
+    // above the parallel threshold the range is partitioned around sampled pivots;
+    // check few distinct, all equal, and already sorted keys
+    using T = typename V::value_type;
+    const std::size_t n = 4 * Vc::Detail::simd_sort_parallel_threshold + 7;
+    std::vector<T> data(n);
+    for (int distinct : {3, 1}) {
+        for (std::size_t i = 0; i < n; ++i) {
+            data[i] = T((i * 7919) % distinct);
+        }
+        auto reference = data;
+        std::sort(reference.begin(), reference.end());
+        Vc::simd_sort(data.begin(), data.end());
+        VERIFY(data == reference) << "distinct = " << distinct;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        data[i] = T(i % 1000);
+    }
+    std::sort(data.begin(), data.end());
+    auto reference = data;
+    Vc::simd_sort(data.begin(), data.end());
+    VERIFY(data == reference);
+}
+
+TEST_TYPES(V, sortNaN, vir::Typelist<Vc::float_v, Vc::double_v>)  //{{{1
+{
+    using T = typename V::value_type;
+    const T nan = std::numeric_limits<T>::quiet_NaN();
+    for (std::size_t n : testSizes<V>()) {
+        auto data = randomData<T>(n);
+        for (std::size_t i = 0; i < n; i += 7) {
+            data[i] = nan;
+        }
+        const std::size_t nans = (n + 6) / 7;
+        auto keys = data;
+        std::vector<unsigned> values(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            values[i] = i;
+        }
+        std::vector<int> indexes(n);
+        Vc::simd_argsort(data.begin(), data.end(), indexes.begin());
+        Vc::simd_sort(keys.begin(), keys.end(), values.begin());
+        Vc::simd_sort(data.begin(), data.end());
+
+        // the non-NaN keys are sorted and followed by all NaNs
+        VERIFY(std::is_sorted(data.begin(), data.end() - nans)) << "n = " << n;
+        VERIFY(std::all_of(data.end() - nans, data.end(), [](T x) { return x != x; }));
+        VERIFY(std::is_sorted(keys.begin(), keys.end() - nans)) << "n = " << n;
+        for (std::size_t i = 0; i < n; ++i) {
+            VERIFY((keys[i] != keys[i]) == (i >= n - nans)) << "n = " << n;
+            VERIFY((values[i] % 7 == 0) == (i >= n - nans)) << "n = " << n;
+            VERIFY((indexes[i] % 7 == 0) == (i >= n - nans)) << "n = " << n;
+        }
+    }
+}
+
+TEST_TYPES(V, sortKeyValue, SortVectors)  //{{{1
+{
+    using T = typename V::value_type;
+    for (std::size_t n : testSizes<V>()) {
+        const auto original = randomData<T>(n);
+        auto keys = original;
+        std::vector<unsigned> values(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            values[i] = i;
+        }
+        Vc::simd_sort(keys.begin(), keys.end(), values.begin());
+        VERIFY(std::is_sorted(keys.begin(), keys.end())) << "n = " << n;
+        std::vector<bool> seen(n, false);
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(keys[i], original[values[i]]) << "n = " << n << ", i = " << i;
+            VERIFY(!seen[values[i]]);
+            seen[values[i]] = true;
+        }
+    }
+}
+
+TEST_TYPES(V, argsort, SortVectors)  //{{{1
+{
+    using T = typename V::value_type;
+    for (std::size_t n : testSizes<V>()) {
+        const auto keys = randomData<T>(n);
+        std::vector<int> indexes(n);
+        Vc::simd_argsort(keys.begin(), keys.end(), indexes.begin());
+        std::vector<bool> seen(n, false);
+        for (std::size_t i = 0; i < n; ++i) {
+            VERIFY(!seen[indexes[i]]);
+            seen[indexes[i]] = true;
+            if (i > 0) {
+                VERIFY(!(keys[indexes[i]] < keys[indexes[i - 1]])) << "n = " << n;
+            }
+        }
+    }
+}
+
+// vim: foldmethod=marker
@@ -28,6 +28,7 @@
 #include <forward_list>
 #include <list>
 #include <deque>
+#include <numeric>
 
 #include "../Vc/common/macros.h"
 
@@ -70,6 +71,38 @@ TEST_TYPES(V, stdVectorAlignment, AllVectors)
     }
 }
 
+TEST_TYPES(V, arenaAllocator, AllVectors)
+{
+    typedef typename V::EntryType T;
+    Vc::Arena arena(256);
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 1; i < 100; ++i) {
+            std::vector<T, Vc::ArenaAllocator<T>> v(i, T(1), Vc::ArenaAllocator<T>(arena));
+            COMPARE(reinterpret_cast<std::uintptr_t>(v.data()) % Vc::VectorAlignment, 0u);
+            // the allocation is padded to whole vectors
+            const std::size_t padded = (i + V::Size - 1) / V::Size * V::Size;
+            for (std::size_t j = 0; j < padded; j += V::Size) {
+                V x(v.data() + j, Vc::Aligned);
+                x.store(v.data() + j, Vc::Aligned);
+            }
+            v.push_back(T(2));
+            COMPARE(std::accumulate(v.begin(), v.end(), T(0)), T(i + 2));
+        }
+        const std::size_t capacity = arena.capacity();
+        arena.reset();
+        // a reset consolidates the blocks and the next round needs no new ones
+        if (round > 0) {
+            COMPARE(arena.capacity(), capacity);
+        }
+    }
+
+    std::vector<V, Vc::ArenaAllocator<V>> v2(11);
+    COMPARE(&v2.get_allocator().arena(), &Vc::thread_arena());
+    for (int i = 0; i < 11; ++i) {
+        COMPARE(reinterpret_cast<std::uintptr_t>(&v2[i]) % alignof(V), 0u);
+    }
+}
+
 template <typename V, typename Container, std::size_t... Indexes>
 void listInitializationImpl(Vc::index_sequence<Indexes...>)
 {
@@ -195,3 +195,32 @@ TEST_TYPES(Vec, maskedStore, AllVectors)
         }
     }
 }
+
+TEST_TYPES(Vec, compressStore, AllTypes)
+{
+    typedef typename Vec::EntryType T;
+    typedef typename Vec::Mask M;
+    const Vec x([](int i) { return T(i + 1); });
+    auto check = [&](const M &mask) {
+        T mem[Vec::Size + 1] = {};
+        const int n = x.compress_store(mem, mask);
+        COMPARE(n, mask.count()) << mask;
+        int k = 0;
+        for (std::size_t i = 0; i < Vec::Size; ++i) {
+            if (mask[i]) {
+                COMPARE(mem[k], x[i]) << ", i: " << i << ", mask: " << mask;
+                ++k;
+            }
+        }
+        for (; k <= int(Vec::Size); ++k) {
+            COMPARE(mem[k], T(0)) << ", k: " << k << ", mask: " << mask;
+        }
+    };
+    if (Vec::Size <= 8) {
+        for (std::size_t i = 0; i < (std::size_t(1) << Vec::Size); ++i) {
+            check(allMasks<Vec>(i));
+        }
+    } else {
+        withRandomMask<Vec, 1000>(check);
+    }
+}
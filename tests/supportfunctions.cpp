@@ -40,6 +40,9 @@ TEST(testIsSupported)
     COMPARE(Vc::isImplementationSupported(Vc::SSE42Impl), CpuId::hasSse42());
     COMPARE(Vc::isImplementationSupported(Vc::AVXImpl  ), CpuId::hasOsxsave() && CpuId::hasAvx());
     COMPARE(Vc::isImplementationSupported(Vc::AVX2Impl ), CpuId::hasOsxsave() && CpuId::hasAvx2());
+    COMPARE(Vc::isImplementationSupported(Vc::AVX512Impl),
+            CpuId::hasOsxsave() && CpuId::hasAvx2() && CpuId::hasAvx512f() &&
+                CpuId::hasAvx512vl() && CpuId::hasAvx512bw() && CpuId::hasAvx512dq());
 }
 
 TEST(testBestImplementation)
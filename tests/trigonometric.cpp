@@ -237,5 +237,109 @@ TEST_TYPES(V, testAtan2, RealTypes) //{{{1
     }
 }
 
+template <typename V, typename F> V referenceLD(const V &x, F &&f) //{{{1
+{
+    // reference values from the long double implementation of the C library
+    using T = typename V::EntryType;
+    return x.apply([&](T _x) { return T(f(static_cast<long double>(_x))); });
+}
+
+TEST_TYPES(V, testTan, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(1);
+    setFuzzyness<double>(4);
+    const auto ref = [](long double x) { return std::tan(x); };
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        const V x = (V::Random() - T(0.5)) * T(16384);
+        FUZZY_COMPARE(Vc::tan(x), referenceLD(x, ref)) << " x = " << x << ", i = " << i;
+        const V y = (V::Random() - T(0.5)) * T(4);
+        FUZZY_COMPARE(Vc::tan(y), referenceLD(y, ref)) << " y = " << y << ", i = " << i;
+    }
+    COMPARE(Vc::tan(V(0)), V(0));
+    VERIFY(all_of(isnegative(Vc::tan(V(T(-0.))))));
+    VERIFY(all_of(Vc::isnan(Vc::tan(V(std::numeric_limits<T>::infinity())))));
+}
+
+TEST_TYPES(V, testAcos, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(2);
+    setFuzzyness<double>(2);
+    const auto ref = [](long double x) { return std::acos(x); };
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        const V x = (V::Random() - T(0.5)) * T(2);
+        FUZZY_COMPARE(Vc::acos(x), referenceLD(x, ref)) << " x = " << x << ", i = " << i;
+    }
+    COMPARE(Vc::acos(V(1)), V(0));
+    FUZZY_COMPARE(Vc::acos(V(-1)), V(T(doubleConstant<1, 0x921fb54442d18ull, 1>())));
+    VERIFY(all_of(Vc::isnan(Vc::acos(V(T(1.5))))));
+}
+
+TEST_TYPES(V, testSinhCosh, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(3);
+    setFuzzyness<double>(4);
+    const T range = std::is_same<T, float>::value ? 88 : 709;
+    const auto sinhRef = [](long double x) { return std::sinh(x); };
+    const auto coshRef = [](long double x) { return std::cosh(x); };
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        const V x = (V::Random() - T(0.5)) * (range + range);
+        FUZZY_COMPARE(Vc::sinh(x), referenceLD(x, sinhRef)) << " x = " << x << ", i = " << i;
+        FUZZY_COMPARE(Vc::cosh(x), referenceLD(x, coshRef)) << " x = " << x << ", i = " << i;
+        const V y = (V::Random() - T(0.5)) * T(4);
+        FUZZY_COMPARE(Vc::sinh(y), referenceLD(y, sinhRef)) << " y = " << y << ", i = " << i;
+        FUZZY_COMPARE(Vc::cosh(y), referenceLD(y, coshRef)) << " y = " << y << ", i = " << i;
+    }
+    const V inf = std::numeric_limits<T>::infinity();
+    COMPARE(Vc::sinh(V(0)), V(0));
+    COMPARE(Vc::cosh(V(0)), V(1));
+    COMPARE(Vc::sinh(-inf), -inf);
+    COMPARE(Vc::cosh(-inf), inf);
+}
+
+TEST_TYPES(V, testTanh, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(3);
+    setFuzzyness<double>(3);
+    const auto ref = [](long double x) { return std::tanh(x); };
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        const V x = (V::Random() - T(0.5)) * T(50);
+        FUZZY_COMPARE(Vc::tanh(x), referenceLD(x, ref)) << " x = " << x << ", i = " << i;
+        const V y = (V::Random() - T(0.5)) * T(2);
+        FUZZY_COMPARE(Vc::tanh(y), referenceLD(y, ref)) << " y = " << y << ", i = " << i;
+    }
+    COMPARE(Vc::tanh(V(0)), V(0));
+    COMPARE(Vc::tanh(V(-std::numeric_limits<T>::infinity())), V(-1));
+}
+
+TEST_TYPES(V, testAsinhAtanh, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(2);
+    setFuzzyness<double>(3);
+    const auto asinhRef = [](long double x) { return std::asinh(x); };
+    const auto atanhRef = [](long double x) { return std::atanh(x); };
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        const V x = (V::Random() - T(0.5)) * T(2);
+        FUZZY_COMPARE(Vc::asinh(x), referenceLD(x, asinhRef)) << " x = " << x << ", i = " << i;
+        FUZZY_COMPARE(Vc::atanh(x), referenceLD(x, atanhRef)) << " x = " << x << ", i = " << i;
+        const V y = Vc::exp((V::Random() - T(0.5)) * T(160));
+        FUZZY_COMPARE(Vc::asinh(y), referenceLD(y, asinhRef)) << " y = " << y << ", i = " << i;
+    }
+    const V inf = std::numeric_limits<T>::infinity();
+    COMPARE(Vc::asinh(V(0)), V(0));
+    COMPARE(Vc::asinh(-inf), -inf);
+    COMPARE(Vc::atanh(V(1)), inf);
+    COMPARE(Vc::atanh(V(-1)), -inf);
+    VERIFY(all_of(Vc::isnan(Vc::atanh(V(2)))));
+    const V nan = std::numeric_limits<T>::quiet_NaN();
+    VERIFY(all_of(Vc::isnan(Vc::asinh(nan))));
+    VERIFY(all_of(Vc::isnan(Vc::asinh(-nan))));
+    VERIFY(all_of(Vc::isnan(Vc::atanh(nan))));
+}
+
 //}}}1
 // vim: foldmethod=marker